@@ -0,0 +1,138 @@
+#pragma once
+
+/**
+ * @file benchmark_utils.h
+ * @brief Shared input generators and statistics for the benchmark suite
+ */
+
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace cpp_template {
+namespace benchmarks {
+
+/**
+ * @brief Seed for every generator, so runs of different versions see the same inputs
+ */
+constexpr uint32_t kSeed = 42;
+
+/**
+ * @brief Make a mixed-case alphanumeric string
+ *
+ * @param length Number of characters
+ * @param seed Generator seed
+ * @return std::string The string
+ */
+inline std::string makeText(size_t length, uint32_t seed = kSeed) {
+    static constexpr char kAlphabet[] =
+        "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789";
+    std::mt19937 generator(seed);
+    std::uniform_int_distribution<size_t> pick(0, sizeof(kAlphabet) - 2);
+    std::string text(length, ' ');
+    for (char& character : text) {
+        character = kAlphabet[pick(generator)];
+    }
+    return text;
+}
+
+/**
+ * @brief Make a list of strings of the same length
+ *
+ * @param count Number of strings
+ * @param length Length of each string
+ * @return std::vector<std::string> The strings
+ */
+inline std::vector<std::string> makeItems(size_t count, size_t length) {
+    std::vector<std::string> items;
+    items.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        items.push_back(makeText(length, kSeed + static_cast<uint32_t>(i)));
+    }
+    return items;
+}
+
+/**
+ * @brief Make a delimited line of fields
+ *
+ * @param fields Number of fields
+ * @param field_length Length of each field
+ * @param delimiter Character placed between fields
+ * @return std::string The line
+ */
+inline std::string makeDelimited(size_t fields, size_t field_length, char delimiter) {
+    std::string line;
+    line.reserve(fields * (field_length + 1));
+    for (const std::string& field : makeItems(fields, field_length)) {
+        if (!line.empty()) {
+            line.push_back(delimiter);
+        }
+        line += field;
+    }
+    return line;
+}
+
+/**
+ * @brief Make email addresses, roughly one in four of them malformed
+ *
+ * @param count Number of addresses
+ * @return std::vector<std::string> The addresses
+ */
+inline std::vector<std::string> makeEmails(size_t count) {
+    static const char* const kMalformed[] = {"missing.at.example.com", "two@@example.com",
+                                             "user@nodot", "@example.com"};
+    std::vector<std::string> emails;
+    emails.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        if (i % 4 == 3) {
+            emails.emplace_back(kMalformed[(i / 4) % 4]);
+        } else {
+            emails.push_back(makeText(8 + i % 8, kSeed + static_cast<uint32_t>(i)) + "@" +
+                             makeText(6, kSeed + static_cast<uint32_t>(i) + 1) + ".com");
+        }
+    }
+    return emails;
+}
+
+/**
+ * @brief Nearest-rank percentile of repetition results
+ *
+ * @param values One value per repetition
+ * @param fraction The percentile as a fraction in [0, 1]
+ * @return double The percentile, or 0 for no values
+ */
+inline double percentile(std::vector<double> values, double fraction) {
+    if (values.empty()) {
+        return 0.0;
+    }
+    auto rank = static_cast<size_t>(fraction * static_cast<double>(values.size() - 1) + 0.5);
+    std::nth_element(values.begin(), values.begin() + rank, values.end());
+    return values[rank];
+}
+
+/**
+ * @brief Report p50/p90/p99 across repetitions in addition to mean, median and stddev
+ *
+ * Aggregates are only computed when a benchmark runs more than once, e.g.
+ * with `--benchmark_repetitions=10`. Use with `->Apply(addPercentiles)`.
+ *
+ * @param benchmark The benchmark being registered
+ */
+inline void addPercentiles(benchmark::internal::Benchmark* benchmark) {
+    benchmark->ComputeStatistics("p50", [](const std::vector<double>& v) {
+        return percentile(v, 0.50);
+    });
+    benchmark->ComputeStatistics("p90", [](const std::vector<double>& v) {
+        return percentile(v, 0.90);
+    });
+    benchmark->ComputeStatistics("p99", [](const std::vector<double>& v) {
+        return percentile(v, 0.99);
+    });
+}
+
+}  // namespace benchmarks
+}  // namespace cpp_template
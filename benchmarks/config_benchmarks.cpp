@@ -0,0 +1,162 @@
+/**
+ * @file config_benchmarks.cpp
+ * @brief Benchmarks for ConfigManager lookups, updates and file and image loading
+ */
+
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+#include "benchmark_utils.h"
+#include "modules/config_image.h"
+#include "modules/config_manager.h"
+
+namespace {
+
+using namespace cpp_template::benchmarks;
+using cpp_template::modules::ConfigImage;
+using cpp_template::modules::ConfigManager;
+using cpp_template::modules::ConfigSnapshot;
+using cpp_template::modules::ConfigStorage;
+
+std::string keyFor(size_t index) {
+    return "section." + std::to_string(index % 64) + ".key." + std::to_string(index);
+}
+
+// Every setValue() publishes a new snapshot, so setup is quadratic in the key count
+std::unique_ptr<ConfigManager> makeConfig(ConfigStorage storage, size_t keys) {
+    auto config = std::make_unique<ConfigManager>(storage);
+    for (size_t i = 0; i < keys; ++i) {
+        config->setValue(keyFor(i), "value" + std::to_string(i));
+    }
+    return config;
+}
+
+std::vector<std::string> makeKeys(size_t keys) {
+    std::vector<std::string> names;
+    names.reserve(keys);
+    for (size_t i = 0; i < keys; ++i) {
+        names.push_back(keyFor(i));
+    }
+    return names;
+}
+
+// Arguments: number of keys, storage (0 = SORTED, 1 = HASH)
+void BM_ConfigGetValue(benchmark::State& state) {
+    const auto keys = static_cast<size_t>(state.range(0));
+    const auto config = makeConfig(static_cast<ConfigStorage>(state.range(1)), keys);
+    const std::vector<std::string> names = makeKeys(keys);
+    size_t index = 0;
+    for (auto _ : state) {
+        std::string value = config->getValue(names[index]);
+        benchmark::DoNotOptimize(value);
+        index = (index + 1) % keys;
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+BENCHMARK(BM_ConfigGetValue)
+    ->ArgsProduct({{16, 256, 4096}, {0, 1}})
+    ->ArgNames({"keys", "hash"})
+    ->Apply(addPercentiles);
+
+// Concurrent readers of one shared manager; lookups go through the published snapshot
+void BM_ConfigGetValueThreaded(benchmark::State& state) {
+    static const auto config = makeConfig(ConfigStorage::HASH, 1024);
+    static const std::vector<std::string> names = makeKeys(1024);
+    size_t index = static_cast<size_t>(state.thread_index()) * 97;
+    for (auto _ : state) {
+        std::string value = config->getValue(names[index % names.size()]);
+        benchmark::DoNotOptimize(value);
+        ++index;
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+BENCHMARK(BM_ConfigGetValueThreaded)->ThreadRange(1, 8)->UseRealTime()->Apply(addPercentiles);
+
+// Each update publishes a new snapshot; the argument is the number of existing keys
+void BM_ConfigSetValue(benchmark::State& state) {
+    const auto keys = static_cast<size_t>(state.range(0));
+    const auto config = makeConfig(ConfigStorage::HASH, keys);
+    const std::vector<std::string> names = makeKeys(keys);
+    size_t index = 0;
+    for (auto _ : state) {
+        config->setValue(names[index], "updated");
+        index = (index + 1) % keys;
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+BENCHMARK(BM_ConfigSetValue)->RangeMultiplier(8)->Range(16, 4096)->Apply(addPercentiles);
+
+// The argument is the number of key=value lines in the file
+void BM_ConfigLoadFromFile(benchmark::State& state) {
+    const auto lines = static_cast<size_t>(state.range(0));
+    const std::filesystem::path path = std::filesystem::temp_directory_path() /
+                                       ("cpp_template_bench_" + std::to_string(lines) + ".conf");
+    {
+        std::ofstream file(path);
+        file << "# Generated benchmark configuration\n";
+        for (size_t i = 0; i < lines; ++i) {
+            file << keyFor(i) << " = value" << i << "\n";
+        }
+    }
+
+    ConfigManager config;
+    for (auto _ : state) {
+        if (!config.loadFromFile(path.string())) {
+            state.SkipWithError("Failed to load the generated configuration");
+            break;
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                            static_cast<int64_t>(std::filesystem::file_size(path)));
+    std::filesystem::remove(path);
+}
+BENCHMARK(BM_ConfigLoadFromFile)
+    ->RangeMultiplier(16)
+    ->Range(64, 64 << 10)
+    ->Unit(benchmark::kMicrosecond)
+    ->Apply(addPercentiles);
+
+
+// Same configurations as BM_ConfigLoadFromFile, precompiled into a config image
+void BM_ConfigLoadFromImage(benchmark::State& state) {
+    const auto lines = static_cast<size_t>(state.range(0));
+    const std::filesystem::path path = std::filesystem::temp_directory_path() /
+                                       ("cpp_template_bench_" + std::to_string(lines) + ".cfgimg");
+    {
+        std::vector<ConfigSnapshot::Entry> entries;
+        std::vector<std::string> values;
+        std::vector<std::string> names = makeKeys(lines);
+        for (size_t i = 0; i < lines; ++i) {
+            values.push_back("value" + std::to_string(i));
+        }
+        for (size_t i = 0; i < lines; ++i) {
+            entries.push_back({names[i], values[i]});
+        }
+        if (!ConfigImage::write(ConfigSnapshot(std::move(entries), 1), path.string())) {
+            state.SkipWithError("Failed to write the config image");
+            return;
+        }
+    }
+
+    ConfigManager config;
+    for (auto _ : state) {
+        if (!config.loadFromImage(path.string())) {
+            state.SkipWithError("Failed to load the generated config image");
+            break;
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                            static_cast<int64_t>(std::filesystem::file_size(path)));
+    std::filesystem::remove(path);
+}
+BENCHMARK(BM_ConfigLoadFromImage)
+    ->RangeMultiplier(16)
+    ->Range(64, 64 << 10)
+    ->Unit(benchmark::kMicrosecond)
+    ->Apply(addPercentiles);
+
+}  // namespace
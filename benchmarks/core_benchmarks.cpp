@@ -0,0 +1,62 @@
+/**
+ * @file core_benchmarks.cpp
+ * @brief Benchmarks for the public cpp_template::Core
+ */
+
+#include <cpp-template/core.h>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "benchmark_utils.h"
+
+namespace {
+
+using namespace cpp_template::benchmarks;
+
+cpp_template::Core makeCore() {
+    cpp_template::Core core("benchmark");
+    core.initialize();
+    return core;
+}
+
+// The argument is the input length in bytes
+void BM_CoreProcess(benchmark::State& state) {
+    const cpp_template::Core core = makeCore();
+    const std::string input = makeText(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        std::string output = core.process(input);
+        benchmark::DoNotOptimize(output);
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(BM_CoreProcess)->RangeMultiplier(8)->Range(16, 16 << 10)->Apply(addPercentiles);
+
+// The argument is the number of 32-byte inputs per call
+void BM_CoreProcessMany(benchmark::State& state) {
+    const cpp_template::Core core = makeCore();
+    const std::vector<std::string> items = makeItems(static_cast<size_t>(state.range(0)), 32);
+    const std::vector<std::string_view> inputs(items.begin(), items.end());
+    size_t total = 0;
+    for (auto _ : state) {
+        core.processMany(inputs, [&total](std::string_view processed) {
+            total += processed.size();
+        });
+    }
+    benchmark::DoNotOptimize(total);
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(BM_CoreProcessMany)->RangeMultiplier(8)->Range(1, 4096)->Apply(addPercentiles);
+
+// Independent cores, one per thread; shows whether process() scales with threads
+void BM_CoreProcessThreaded(benchmark::State& state) {
+    const cpp_template::Core core = makeCore();
+    const std::string input = makeText(256);
+    for (auto _ : state) {
+        std::string output = core.process(input);
+        benchmark::DoNotOptimize(output);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+BENCHMARK(BM_CoreProcessThreaded)->ThreadRange(1, 8)->UseRealTime()->Apply(addPercentiles);
+
+}  // namespace
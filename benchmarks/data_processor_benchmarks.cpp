@@ -0,0 +1,136 @@
+/**
+ * @file data_processor_benchmarks.cpp
+ * @brief Benchmarks for DataProcessor in every mode, batch size and thread count
+ */
+
+#include <memory>
+#include <string>
+#include <vector>
+#include "benchmark_utils.h"
+#include "core/string_batch.h"
+#include "modules/config_manager.h"
+#include "modules/data_processor.h"
+#include "modules/processing_context.h"
+
+namespace {
+
+using namespace cpp_template::benchmarks;
+using cpp_template::core::utils::string::StringBatch;
+using cpp_template::modules::ConfigManager;
+using cpp_template::modules::DataProcessor;
+using cpp_template::modules::ProcessingContext;
+using cpp_template::modules::ProcessingMode;
+
+constexpr size_t kItemLength = 64;
+
+// Batch size limit and thread count are the only settings changed from the defaults
+std::unique_ptr<DataProcessor> makeProcessor(int threads = 1) {
+    auto processor = std::make_unique<DataProcessor>(std::make_shared<ConfigManager>());
+    processor->setProcessingConfig("batch_size", "1000000");
+    processor->setProcessingConfig("threads", std::to_string(threads));
+    return processor;
+}
+
+// Arguments: mode (0 = SIMPLE, 1 = ADVANCED, 2 = BATCH), input length
+void BM_ProcessItem(benchmark::State& state) {
+    const auto processor = makeProcessor();
+    const auto mode = static_cast<ProcessingMode>(state.range(0));
+    const std::string input = makeText(static_cast<size_t>(state.range(1)));
+    for (auto _ : state) {
+        auto result = processor->processItem(input, mode);
+        benchmark::DoNotOptimize(result);
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * state.range(1));
+}
+BENCHMARK(BM_ProcessItem)
+    ->ArgsProduct({{0, 1, 2}, {16, 1024}})
+    ->ArgNames({"mode", "length"})
+    ->Apply(addPercentiles);
+
+// Arguments: mode, number of items per batch
+void BM_ProcessBatch(benchmark::State& state) {
+    const auto processor = makeProcessor();
+    const auto mode = static_cast<ProcessingMode>(state.range(0));
+    const std::vector<std::string> inputs =
+        makeItems(static_cast<size_t>(state.range(1)), kItemLength);
+    for (auto _ : state) {
+        auto result = processor->processBatch(inputs, mode);
+        benchmark::DoNotOptimize(result);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(1));
+}
+BENCHMARK(BM_ProcessBatch)
+    ->ArgsProduct({{0, 1, 2}, {10, 100, 1000, 10000}})
+    ->ArgNames({"mode", "items"})
+    ->Apply(addPercentiles);
+
+// Arena variant; the context is reset between batches as a request loop would
+void BM_ProcessBatchArena(benchmark::State& state) {
+    const auto processor = makeProcessor();
+    const auto mode = static_cast<ProcessingMode>(state.range(0));
+    const std::vector<std::string> inputs =
+        makeItems(static_cast<size_t>(state.range(1)), kItemLength);
+    ProcessingContext context;
+    for (auto _ : state) {
+        context.reset();
+        auto result = processor->processBatch(inputs, mode, context);
+        benchmark::DoNotOptimize(result);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(1));
+}
+BENCHMARK(BM_ProcessBatchArena)
+    ->ArgsProduct({{0, 1, 2}, {10, 100, 1000, 10000}})
+    ->ArgNames({"mode", "items"})
+    ->Apply(addPercentiles);
+
+// Columnar variant; the output batch keeps its buffers between batches
+void BM_ProcessBatchColumnar(benchmark::State& state) {
+    const auto processor = makeProcessor();
+    const auto mode = static_cast<ProcessingMode>(state.range(0));
+    const StringBatch inputs(makeItems(static_cast<size_t>(state.range(1)), kItemLength));
+    StringBatch outputs;
+    for (auto _ : state) {
+        auto result = processor->processBatch(inputs, mode, outputs);
+        benchmark::DoNotOptimize(result);
+        benchmark::DoNotOptimize(outputs.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(1));
+}
+BENCHMARK(BM_ProcessBatchColumnar)
+    ->ArgsProduct({{0, 1, 2}, {10, 100, 1000, 10000}})
+    ->ArgNames({"mode", "items"})
+    ->Apply(addPercentiles);
+
+// Scaling of one large batch over processing.threads; the argument is the thread count
+void BM_ProcessBatchParallel(benchmark::State& state) {
+    const auto processor = makeProcessor(static_cast<int>(state.range(0)));
+    processor->setProcessingConfig("chunk_size", "1024");
+    const std::vector<std::string> inputs = makeItems(100000, kItemLength);
+    for (auto _ : state) {
+        auto result = processor->processBatch(inputs, ProcessingMode::BATCH);
+        benchmark::DoNotOptimize(result);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                            static_cast<int64_t>(inputs.size()));
+}
+BENCHMARK(BM_ProcessBatchParallel)
+    ->RangeMultiplier(2)
+    ->Range(1, 8)
+    ->ArgName("threads")
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond)
+    ->Apply(addPercentiles);
+
+// Many callers sharing one processor; statistics counters are sharded, so this should scale
+void BM_ProcessItemShared(benchmark::State& state) {
+    static const auto processor = makeProcessor();
+    const std::string input = makeText(256, kSeed + static_cast<uint32_t>(state.thread_index()));
+    for (auto _ : state) {
+        auto result = processor->processItem(input, ProcessingMode::ADVANCED);
+        benchmark::DoNotOptimize(result);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+BENCHMARK(BM_ProcessItemShared)->ThreadRange(1, 8)->UseRealTime()->Apply(addPercentiles);
+
+}  // namespace
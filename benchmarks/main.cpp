@@ -0,0 +1,64 @@
+/**
+ * @file main.cpp
+ * @brief Benchmark suite entry point with allocation reporting
+ *
+ * The suite links core-memory-hooks, so after the timed repetitions of
+ * every benchmark Google Benchmark makes one more short run with a memory
+ * manager attached. Its allocation count per iteration and peak bytes are
+ * written to the JSON output as "allocs_per_iter" and "max_bytes_used".
+ * The measurement covers the whole benchmark function, so allocations made
+ * by its setup are spread over the iterations of that run. Counting is
+ * paused during the timed runs.
+ */
+
+#include <benchmark/benchmark.h>
+#include <core/memory_tracking.h>
+#include <cstdint>
+
+namespace {
+
+namespace memory = cpp_template::core::memory;
+
+class TrackingMemoryManager : public benchmark::MemoryManager {
+  public:
+    void Start() override {
+        memory::resetStatistics();
+        start_bytes_ = memory::totalStatistics().current_bytes;
+        memory::setCountingEnabled(true);
+    }
+
+    void Stop(Result& result) override {
+        memory::setCountingEnabled(false);
+        memory::AllocationStatistics stats = memory::totalStatistics();
+        result.num_allocs = static_cast<int64_t>(stats.allocations);
+        result.max_bytes_used = static_cast<int64_t>(stats.peak_bytes - start_bytes_);
+        result.total_allocated_bytes = static_cast<int64_t>(stats.bytes_allocated);
+        result.net_heap_growth =
+            static_cast<int64_t>(stats.bytes_allocated) - static_cast<int64_t>(stats.bytes_freed);
+    }
+
+    // Required by Google Benchmark 1.7, which still declares the pointer overload pure
+    void Stop(Result* result) override { Stop(*result); }
+
+  private:
+    uint64_t start_bytes_ = 0;
+};
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    memory::setCountingEnabled(false);
+    TrackingMemoryManager memory_manager;
+    if (memory::trackingActive()) {
+        benchmark::RegisterMemoryManager(&memory_manager);
+    }
+
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    benchmark::RegisterMemoryManager(nullptr);
+    return 0;
+}
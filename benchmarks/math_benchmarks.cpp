@@ -0,0 +1,113 @@
+/**
+ * @file math_benchmarks.cpp
+ * @brief Sample aggregation: scalar against lane reductions, stored samples against sketches
+ */
+
+#include <mathutils/mathutils.h>
+#include <mathutils/streaming.h>
+#include "benchmark_utils.h"
+#include <numeric>
+
+namespace {
+
+using namespace cpp_template::benchmarks;
+
+// Latency-like samples in nanoseconds
+std::vector<double> makeSamples(size_t count) {
+    std::mt19937 generator(kSeed);
+    std::lognormal_distribution<double> latency(10.0, 1.0);
+    std::vector<double> samples(count);
+    for (double& sample : samples) {
+        sample = latency(generator);
+    }
+    return samples;
+}
+
+void setItems(benchmark::State& state, size_t count) {
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                            static_cast<int64_t>(count));
+}
+
+// The reduction mathutils::mean used before: one std::accumulate chain
+void BM_MeanAccumulate(benchmark::State& state) {
+    const std::vector<double> samples = makeSamples(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        double mean = std::accumulate(samples.begin(), samples.end(), 0.0) /
+                      static_cast<double>(samples.size());
+        benchmark::DoNotOptimize(mean);
+    }
+    setItems(state, samples.size());
+}
+BENCHMARK(BM_MeanAccumulate)->RangeMultiplier(32)->Range(1 << 10, 1 << 20)->Apply(addPercentiles);
+
+void BM_MeanLanes(benchmark::State& state) {
+    const std::vector<double> samples = makeSamples(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(mathutils::mean(samples));
+    }
+    setItems(state, samples.size());
+}
+BENCHMARK(BM_MeanLanes)->RangeMultiplier(32)->Range(1 << 10, 1 << 20)->Apply(addPercentiles);
+
+void BM_StddevLanes(benchmark::State& state) {
+    const std::vector<double> samples = makeSamples(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(mathutils::standard_deviation(samples));
+    }
+    setItems(state, samples.size());
+}
+BENCHMARK(BM_StddevLanes)->RangeMultiplier(32)->Range(1 << 10, 1 << 20)->Apply(addPercentiles);
+
+// Welford one value at a time, as a recorder on a hot path would feed it
+void BM_RunningStatsAdd(benchmark::State& state) {
+    const std::vector<double> samples = makeSamples(1 << 16);
+    for (auto _ : state) {
+        mathutils::running_stats<double> stats;
+        for (double sample : samples) {
+            stats.add(sample);
+        }
+        benchmark::DoNotOptimize(stats.variance());
+    }
+    setItems(state, samples.size());
+}
+BENCHMARK(BM_RunningStatsAdd)->Apply(addPercentiles);
+
+void BM_RunningStatsAddRange(benchmark::State& state) {
+    const std::vector<double> samples = makeSamples(1 << 16);
+    for (auto _ : state) {
+        mathutils::running_stats<double> stats;
+        stats.add(samples.data(), samples.size());
+        benchmark::DoNotOptimize(stats.variance());
+    }
+    setItems(state, samples.size());
+}
+BENCHMARK(BM_RunningStatsAddRange)->Apply(addPercentiles);
+
+// p99 by keeping every sample and selecting, against a 1% relative-error sketch
+void BM_P99StoredSamples(benchmark::State& state) {
+    const std::vector<double> samples = makeSamples(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        std::vector<double> stored;
+        for (double sample : samples) {
+            stored.push_back(sample);
+        }
+        benchmark::DoNotOptimize(percentile(std::move(stored), 0.99));
+    }
+    setItems(state, samples.size());
+}
+BENCHMARK(BM_P99StoredSamples)->Arg(1 << 16)->Arg(1 << 20)->Apply(addPercentiles);
+
+void BM_P99Sketch(benchmark::State& state) {
+    const std::vector<double> samples = makeSamples(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        mathutils::quantile_sketch sketch(0.01);
+        for (double sample : samples) {
+            sketch.add(sample);
+        }
+        benchmark::DoNotOptimize(sketch.quantile(0.99));
+    }
+    setItems(state, samples.size());
+}
+BENCHMARK(BM_P99Sketch)->Arg(1 << 16)->Arg(1 << 20)->Apply(addPercentiles);
+
+}  // namespace
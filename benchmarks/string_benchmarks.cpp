@@ -0,0 +1,208 @@
+/**
+ * @file string_benchmarks.cpp
+ * @brief Benchmarks for core::utils::string and core::utils::validation
+ */
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include "benchmark_utils.h"
+#include "core/string_batch.h"
+#include "core/string_builder.h"
+#include "core/tokenizer.h"
+#include "core/utils.h"
+
+namespace {
+
+using namespace cpp_template::benchmarks;
+namespace string_utils = cpp_template::core::utils::string;
+namespace validation = cpp_template::core::utils::validation;
+
+// ---------------------------------------------------------------------------
+// Case conversion; the argument is the input length in bytes
+// ---------------------------------------------------------------------------
+
+void BM_ToUpper(benchmark::State& state) {
+    const std::string input = makeText(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        std::string output = string_utils::toUpper(input);
+        benchmark::DoNotOptimize(output);
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(BM_ToUpper)->RangeMultiplier(8)->Range(16, 64 << 10)->Apply(addPercentiles);
+
+void BM_ToUpperInto(benchmark::State& state) {
+    const std::string input = makeText(static_cast<size_t>(state.range(0)));
+    std::string output;
+    for (auto _ : state) {
+        string_utils::toUpper(input, output);
+        benchmark::DoNotOptimize(output.data());
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(BM_ToUpperInto)->RangeMultiplier(8)->Range(16, 64 << 10)->Apply(addPercentiles);
+
+void BM_ToLowerInPlace(benchmark::State& state) {
+    std::string text = makeText(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        string_utils::toLowerInPlace(text);
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(BM_ToLowerInPlace)->RangeMultiplier(8)->Range(16, 64 << 10)->Apply(addPercentiles);
+
+// ---------------------------------------------------------------------------
+// Splitting and joining; the argument is the number of fields
+// ---------------------------------------------------------------------------
+
+void BM_Split(benchmark::State& state) {
+    const std::string line = makeDelimited(static_cast<size_t>(state.range(0)), 12, ',');
+    for (auto _ : state) {
+        std::vector<std::string> parts = string_utils::split(line, ',');
+        benchmark::DoNotOptimize(parts);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(BM_Split)->RangeMultiplier(8)->Range(8, 4096)->Apply(addPercentiles);
+
+void BM_SplitViews(benchmark::State& state) {
+    const std::string line = makeDelimited(static_cast<size_t>(state.range(0)), 12, ',');
+    std::vector<std::string_view> parts;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(string_utils::split(line, ',', parts));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(BM_SplitViews)->RangeMultiplier(8)->Range(8, 4096)->Apply(addPercentiles);
+
+void BM_Tokens(benchmark::State& state) {
+    const std::string line = makeDelimited(static_cast<size_t>(state.range(0)), 12, ',');
+    for (auto _ : state) {
+        size_t total = 0;
+        for (std::string_view token : string_utils::tokens(line, ',')) {
+            total += token.size();
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(BM_Tokens)->RangeMultiplier(8)->Range(8, 4096)->Apply(addPercentiles);
+
+// Whitespace-style set delimiter over 1024 fields of the given length
+void BM_TokensAnyOf(benchmark::State& state) {
+    const std::string line = makeDelimited(1024, static_cast<size_t>(state.range(0)), '\t');
+    const auto whitespace = string_utils::Delimiter::anyOf(" \t\n");
+    for (auto _ : state) {
+        size_t total = 0;
+        for (std::string_view token : string_utils::tokens(line, whitespace)) {
+            total += token.size();
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                            static_cast<int64_t>(line.size()));
+}
+BENCHMARK(BM_TokensAnyOf)->Arg(12)->Arg(200)->Apply(addPercentiles);
+
+void BM_Join(benchmark::State& state) {
+    const std::vector<std::string> parts = makeItems(static_cast<size_t>(state.range(0)), 12);
+    for (auto _ : state) {
+        std::string joined = string_utils::join(parts, ", ");
+        benchmark::DoNotOptimize(joined);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(BM_Join)->RangeMultiplier(8)->Range(8, 4096)->Apply(addPercentiles);
+
+void BM_StringBuilderJoin(benchmark::State& state) {
+    const std::vector<std::string> parts = makeItems(static_cast<size_t>(state.range(0)), 12);
+    string_utils::StringBuilder builder;
+    for (auto _ : state) {
+        builder.clear();
+        builder.appendJoined(parts, ", ");
+        benchmark::DoNotOptimize(builder.view().data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(BM_StringBuilderJoin)->RangeMultiplier(8)->Range(8, 4096)->Apply(addPercentiles);
+
+// ---------------------------------------------------------------------------
+// Whole batches, one string per record versus one columnar StringBatch; the
+// argument is the number of 64-byte records
+// ---------------------------------------------------------------------------
+
+void BM_ToUpperItems(benchmark::State& state) {
+    std::vector<std::string> items = makeItems(static_cast<size_t>(state.range(0)), 64);
+    for (auto _ : state) {
+        for (std::string& item : items) {
+            string_utils::toUpperInPlace(item);
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * state.range(0) * 64);
+}
+BENCHMARK(BM_ToUpperItems)->RangeMultiplier(16)->Range(16, 64 << 10)->Apply(addPercentiles);
+
+void BM_ToUpperBatch(benchmark::State& state) {
+    string_utils::StringBatch batch(makeItems(static_cast<size_t>(state.range(0)), 64));
+    for (auto _ : state) {
+        string_utils::toUpperInPlace(batch);
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * state.range(0) * 64);
+}
+BENCHMARK(BM_ToUpperBatch)->RangeMultiplier(16)->Range(16, 64 << 10)->Apply(addPercentiles);
+
+void BM_TrimBatch(benchmark::State& state) {
+    std::vector<std::string> items = makeItems(static_cast<size_t>(state.range(0)), 60);
+    for (std::string& item : items) {
+        item = "  " + item + "\t\n";
+    }
+    const string_utils::StringBatch batch(items);
+    string_utils::StringBatch trimmed;
+    for (auto _ : state) {
+        string_utils::trim(batch, trimmed);
+        benchmark::DoNotOptimize(trimmed.data());
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * state.range(0) * 64);
+}
+BENCHMARK(BM_TrimBatch)->RangeMultiplier(16)->Range(16, 64 << 10)->Apply(addPercentiles);
+
+// ---------------------------------------------------------------------------
+// Validators
+// ---------------------------------------------------------------------------
+
+void BM_IsAlphanumeric(benchmark::State& state) {
+    const std::string input = makeText(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(validation::isAlphanumeric(input));
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(BM_IsAlphanumeric)->RangeMultiplier(8)->Range(16, 64 << 10)->Apply(addPercentiles);
+
+void BM_IsValidEmail(benchmark::State& state) {
+    const std::vector<std::string> emails = makeEmails(256);
+    size_t index = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(validation::isValidEmail(emails[index]));
+        index = (index + 1) % emails.size();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+BENCHMARK(BM_IsValidEmail)->Apply(addPercentiles);
+
+void BM_ValidateEmails(benchmark::State& state) {
+    const std::vector<std::string> emails = makeEmails(static_cast<size_t>(state.range(0)));
+    const std::vector<std::string_view> views(emails.begin(), emails.end());
+    std::vector<unsigned char> results;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(validation::validateEmails(views, results));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(BM_ValidateEmails)->RangeMultiplier(8)->Range(8, 4096)->Apply(addPercentiles);
+
+}  // namespace
@@ -0,0 +1,54 @@
+/**
+ * @file trace_benchmarks.cpp
+ * @brief Cost of a trace zone, recorded, disabled at runtime and compiled out
+ */
+
+#include "benchmark_utils.h"
+#include "core/trace.h"
+
+namespace {
+
+using namespace cpp_template::benchmarks;
+namespace trace = cpp_template::core::trace;
+
+void BM_TraceZone(benchmark::State& state) {
+    trace::setEnabled(true);
+    for (auto _ : state) {
+        trace::Zone zone("benchmark");
+        benchmark::ClobberMemory();
+    }
+    trace::clear();
+}
+BENCHMARK(BM_TraceZone)->Apply(addPercentiles);
+
+void BM_TraceZoneDisabled(benchmark::State& state) {
+    trace::setEnabled(false);
+    for (auto _ : state) {
+        trace::Zone zone("benchmark");
+        benchmark::ClobberMemory();
+    }
+    trace::setEnabled(true);
+}
+BENCHMARK(BM_TraceZoneDisabled)->Apply(addPercentiles);
+
+// What CORE_TRACE_SCOPE costs in this build (nothing unless CORE_ENABLE_TRACING)
+void BM_TraceScopeMacro(benchmark::State& state) {
+    trace::setEnabled(true);
+    for (auto _ : state) {
+        CORE_TRACE_SCOPE("benchmark");
+        benchmark::ClobberMemory();
+    }
+    trace::clear();
+}
+BENCHMARK(BM_TraceScopeMacro)->Apply(addPercentiles);
+
+// Threads record into their own buffers, so the cost should not grow with threads
+void BM_TraceZoneThreaded(benchmark::State& state) {
+    for (auto _ : state) {
+        trace::Zone zone("benchmark");
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_TraceZoneThreaded)->ThreadRange(1, 8)->UseRealTime()->Apply(addPercentiles);
+
+}  // namespace
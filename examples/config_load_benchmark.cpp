@@ -0,0 +1,113 @@
+/**
+ * @file config_load_benchmark.cpp
+ * @brief Configuration file loading benchmark
+ *
+ * Generates a large key=value configuration file (one feature flag per
+ * tenant) and compares ConfigManager::loadFromFile, which memory-maps the
+ * file and parses it in one pass, with the classic std::getline + std::map
+ * approach.
+ *
+ * Usage: config_load_benchmark [line_count]
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <string>
+#include "modules/config_manager.h"
+
+namespace {
+
+double elapsedMs(std::chrono::steady_clock::time_point start) {
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    return std::chrono::duration<double, std::milli>(elapsed).count();
+}
+
+void writeConfig(const std::filesystem::path& path, size_t lines) {
+    std::ofstream file(path);
+    file << "# Generated tenant feature flags\n";
+    for (size_t i = 0; i < lines; ++i) {
+        if (i % 100 == 0) {
+            file << "\n# tenant block " << i / 100 << "\n";
+        }
+        file << "tenant." << i % 5000 << ".feature." << i << " = " << (i % 3 == 0 ? "on" : "off")
+             << "\n";
+    }
+}
+
+// Reference implementation: getline, substr and erase-based trimming into a std::map
+size_t loadWithGetline(const std::filesystem::path& path, std::map<std::string, std::string>& out) {
+    std::ifstream file(path);
+    std::string line;
+    while (std::getline(file, line)) {
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+        size_t pos = line.find('=');
+        if (pos != std::string::npos) {
+            std::string key = line.substr(0, pos);
+            std::string value = line.substr(pos + 1);
+            key.erase(0, key.find_first_not_of(" \t"));
+            key.erase(key.find_last_not_of(" \t") + 1);
+            value.erase(0, value.find_first_not_of(" \t"));
+            value.erase(value.find_last_not_of(" \t") + 1);
+            out[key] = value;
+        }
+    }
+    return out.size();
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    size_t lines = 300000;
+    if (argc > 1) {
+        lines = static_cast<size_t>(std::strtoull(argv[1], nullptr, 10));
+    }
+
+    auto path = std::filesystem::temp_directory_path() / "config_load_benchmark.conf";
+    writeConfig(path, lines);
+    std::cout << "=== Config Load Benchmark ===" << std::endl;
+    std::cout << "Lines: " << lines << ", file size: " << std::filesystem::file_size(path) / 1024
+              << " KiB" << std::endl;
+
+    constexpr int kRuns = 5;
+    double getline_best = 0.0;
+    double mapped_best = 0.0;
+    size_t getline_keys = 0;
+    size_t mapped_keys = 0;
+
+    for (int run = 0; run < kRuns; ++run) {
+        std::map<std::string, std::string> reference;
+        auto start = std::chrono::steady_clock::now();
+        getline_keys = loadWithGetline(path, reference);
+        double ms = elapsedMs(start);
+        getline_best = (run == 0) ? ms : std::min(getline_best, ms);
+
+        cpp_template::modules::ConfigManager config;
+        start = std::chrono::steady_clock::now();
+        if (!config.loadFromFile(path.string())) {
+            std::cerr << "Failed to load " << path << std::endl;
+            return 1;
+        }
+        ms = elapsedMs(start);
+        mapped_keys = config.snapshot()->size();
+        mapped_best = (run == 0) ? ms : std::min(mapped_best, ms);
+    }
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "getline + std::map:   " << std::setw(10) << getline_best << " ms (" << getline_keys
+              << " keys)" << std::endl;
+    std::cout << "mmap + flat snapshot: " << std::setw(10) << mapped_best << " ms (" << mapped_keys
+              << " keys)" << std::endl;
+    if (mapped_best > 0.0) {
+        std::cout << "Speedup: " << getline_best / mapped_best << "x" << std::endl;
+    }
+
+    std::filesystem::remove(path);
+    return getline_keys == mapped_keys ? 0 : 1;
+}
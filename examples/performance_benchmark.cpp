@@ -6,13 +6,17 @@
  * components and provides patterns for performance testing in your own code.
  */
 
+#include <core/memory_tracking.h>
 #include <cpp-template/cpp-template.h>
 #include <algorithm>
 #include <chrono>
 #include <iomanip>
 #include <iostream>
 #include <random>
+#include <string_view>
 #include <vector>
+#include "modules/config_manager.h"
+#include "modules/data_processor.h"
 
 class Timer {
   public:
@@ -118,6 +122,17 @@ void benchmarkCoreOperations(BenchmarkResults& results) {
         results.addResult(test_name, elapsed, size);
 
         std::cout << "  " << size << " operations in " << elapsed << " ms" << std::endl;
+
+        // Same work through one processMany call
+        std::vector<std::string_view> views(test_data.begin(), test_data.end());
+        size_t produced = 0;
+        timer.reset();
+        core->processMany(views, [&produced](std::string_view) { ++produced; });
+        double batched = timer.elapsed_ms();
+
+        results.addResult("Core ProcessMany (" + std::to_string(size) + ")", batched, produced);
+        std::cout << "  " << produced << " operations via processMany in " << batched << " ms"
+                  << std::endl;
     }
     std::cout << std::endl;
 }
@@ -140,6 +155,19 @@ void benchmarkStringUtilities(BenchmarkResults& results) {
                   << std::endl;
     }
 
+    // Benchmark toUpper into a reused buffer
+    {
+        std::string buffer;
+        Timer timer;
+        for (const auto& str : test_data) {
+            cpp_template::string_utils::toUpper(str, buffer);
+        }
+        double elapsed = timer.elapsed_ms();
+        results.addResult("String toUpper (buffer)", elapsed, iterations);
+        std::cout << "toUpper (buffer): " << iterations << " operations in " << elapsed << " ms"
+                  << std::endl;
+    }
+
     // Benchmark toLower
     {
         Timer timer;
@@ -152,13 +180,26 @@ void benchmarkStringUtilities(BenchmarkResults& results) {
                   << std::endl;
     }
 
-    // Benchmark split
+    // Benchmark toLower into a reused buffer
     {
-        std::vector<std::string> split_data;
-        for (size_t i = 0; i < iterations / 10; ++i) {
-            split_data.push_back("word1 word2 word3 word4 word5");
+        std::string buffer;
+        Timer timer;
+        for (const auto& str : test_data) {
+            cpp_template::string_utils::toLower(str, buffer);
         }
+        double elapsed = timer.elapsed_ms();
+        results.addResult("String toLower (buffer)", elapsed, iterations);
+        std::cout << "toLower (buffer): " << iterations << " operations in " << elapsed << " ms"
+                  << std::endl;
+    }
+
+    std::vector<std::string> split_data;
+    for (size_t i = 0; i < iterations / 10; ++i) {
+        split_data.push_back("word1 word2 word3 word4 word5");
+    }
 
+    // Benchmark split
+    {
         Timer timer;
         for (const auto& str : split_data) {
             cpp_template::string_utils::split(str, ' ');
@@ -169,6 +210,19 @@ void benchmarkStringUtilities(BenchmarkResults& results) {
                   << std::endl;
     }
 
+    // Benchmark split into reused string_view storage
+    {
+        std::vector<std::string_view> parts;
+        Timer timer;
+        for (const auto& str : split_data) {
+            cpp_template::string_utils::split(str, ' ', parts);
+        }
+        double elapsed = timer.elapsed_ms();
+        results.addResult("String split (views)", elapsed, split_data.size());
+        std::cout << "split (views): " << split_data.size() << " operations in " << elapsed
+                  << " ms" << std::endl;
+    }
+
     // Benchmark join
     {
         std::vector<std::string> words = {"word1", "word2", "word3", "word4", "word5"};
@@ -183,6 +237,22 @@ void benchmarkStringUtilities(BenchmarkResults& results) {
                   << std::endl;
     }
 
+    // Benchmark join appending to a reused buffer
+    {
+        std::vector<std::string_view> words = {"word1", "word2", "word3", "word4", "word5"};
+        std::string buffer;
+
+        Timer timer;
+        for (size_t i = 0; i < iterations / 10; ++i) {
+            buffer.clear();
+            cpp_template::string_utils::join(words, " ", buffer);
+        }
+        double elapsed = timer.elapsed_ms();
+        results.addResult("String join (buffer)", elapsed, iterations / 10);
+        std::cout << "join (buffer): " << (iterations / 10) << " operations in " << elapsed
+                  << " ms" << std::endl;
+    }
+
     std::cout << std::endl;
 }
 
@@ -246,51 +316,142 @@ void benchmarkValidation(BenchmarkResults& results) {
                   << std::endl;
     }
 
+    // Benchmark batch email validation
+    {
+        std::vector<std::string_view> email_views(email_data.begin(), email_data.end());
+        std::vector<unsigned char> flags;
+
+        Timer timer;
+        cpp_template::validation::validateEmails(email_views, flags);
+        double elapsed = timer.elapsed_ms();
+        results.addResult("Validation validateEmails", elapsed, iterations);
+        std::cout << "validateEmails: " << iterations << " operations in " << elapsed << " ms"
+                  << std::endl;
+    }
+
     std::cout << std::endl;
 }
 
+// Run `operation` once and print the heap allocations it made, per operation
+template <typename Operation>
+void reportAllocations(const std::string& name, size_t operations, Operation&& operation) {
+    namespace memory = cpp_template::core::memory;
+
+    memory::resetStatistics();
+    uint64_t start_bytes = memory::totalStatistics().current_bytes;
+
+    operation();
+
+    memory::AllocationStatistics total = memory::totalStatistics();
+    auto per_op = [operations](uint64_t value) {
+        return static_cast<double>(value) / static_cast<double>(operations);
+    };
+    std::cout << std::left << std::setw(28) << name << std::right << std::fixed
+              << std::setprecision(2) << std::setw(12) << per_op(total.allocations)
+              << std::setw(14) << per_op(total.bytes_allocated) << std::setw(14)
+              << (total.peak_bytes - start_bytes) << std::endl;
+
+    // Subsystems are only told apart in builds with CORE_ENABLE_MEMORY_TRACKING
+    for (size_t i = 0; i < memory::kSubsystemCount; ++i) {
+        auto subsystem = static_cast<memory::Subsystem>(i);
+        memory::AllocationStatistics stats = memory::statistics(subsystem);
+        if (stats.allocations == 0 ||
+            (subsystem == memory::Subsystem::OTHER && stats.allocations == total.allocations)) {
+            continue;
+        }
+        std::cout << "  " << std::left << std::setw(26) << memory::subsystemName(subsystem)
+                  << std::right << std::setw(12) << per_op(stats.allocations) << std::setw(14)
+                  << per_op(stats.bytes_allocated) << std::endl;
+    }
+}
+
 void benchmarkMemoryUsage() {
     std::cout << "=== Memory Usage Analysis ===" << std::endl;
 
-    // This is a simplified memory usage demonstration
-    // In a real application, you might use tools like valgrind or custom allocators
+    if (!cpp_template::core::memory::trackingActive()) {
+        std::cout << "Allocation tracking is not linked in (core-memory-hooks)" << std::endl
+                  << std::endl;
+        return;
+    }
 
     const size_t large_count = 100000;
+    auto test_data = generateTestData(1000, 10, 50);
+    std::vector<std::string_view> test_views(test_data.begin(), test_data.end());
 
-    std::cout << "Creating " << large_count << " Core instances..." << std::endl;
+    std::cout << std::left << std::setw(28) << "Operation" << std::right << std::setw(12)
+              << "Allocs/Op" << std::setw(14) << "Bytes/Op" << std::setw(14) << "Peak Bytes"
+              << std::endl;
+    std::cout << std::string(68, '-') << std::endl;
 
-    Timer timer;
     std::vector<std::unique_ptr<cpp_template::Core>> cores;
     cores.reserve(large_count);
+    reportAllocations("Core create", large_count, [&] {
+        for (size_t i = 0; i < large_count; ++i) {
+            cores.push_back(cpp_template::createCore("Core" + std::to_string(i)));
+        }
+    });
+    reportAllocations("Core initialize", large_count, [&] {
+        for (auto& core : cores) {
+            core->initialize();
+        }
+    });
+    reportAllocations("Core process", large_count, [&] {
+        for (auto& core : cores) {
+            core->process("test data");
+        }
+    });
+    reportAllocations("Core destroy", large_count, [&] { cores.clear(); });
 
-    for (size_t i = 0; i < large_count; ++i) {
-        cores.push_back(cpp_template::createCore("Core" + std::to_string(i)));
-    }
-
-    double creation_time = timer.elapsed_ms();
-    std::cout << "Creation time: " << creation_time << " ms" << std::endl;
+    reportAllocations("toUpper (copy)", test_data.size(), [&] {
+        for (const auto& str : test_data) {
+            cpp_template::string_utils::toUpper(str);
+        }
+    });
+    std::string upper;
+    reportAllocations("toUpper (reused buffer)", test_data.size(), [&] {
+        for (std::string_view str : test_views) {
+            cpp_template::string_utils::toUpper(str, upper);
+        }
+    });
+    reportAllocations("split (owning)", test_data.size(), [&] {
+        for (const auto& str : test_data) {
+            cpp_template::string_utils::split(str, 'a');
+        }
+    });
+    std::vector<std::string_view> parts;
+    reportAllocations("split (views)", test_data.size(), [&] {
+        for (std::string_view str : test_views) {
+            cpp_template::string_utils::split(str, 'a', parts);
+        }
+    });
 
-    // Initialize all cores
-    timer.reset();
-    for (auto& core : cores) {
-        core->initialize();
-    }
-    double init_time = timer.elapsed_ms();
-    std::cout << "Initialization time: " << init_time << " ms" << std::endl;
+    std::shared_ptr<cpp_template::modules::ConfigManager> config =
+        cpp_template::modules::createConfigManager();
+    reportAllocations("ConfigManager setValue", 1000, [&] {
+        for (size_t i = 0; i < 1000; ++i) {
+            config->setValue("key" + std::to_string(i), "value");
+        }
+    });
+    reportAllocations("ConfigManager getValue", 1000, [&] {
+        for (size_t i = 0; i < 1000; ++i) {
+            config->getValue("key" + std::to_string(i));
+        }
+    });
 
-    // Process data with all cores
-    timer.reset();
-    for (auto& core : cores) {
-        core->process("test data");
-    }
-    double process_time = timer.elapsed_ms();
-    std::cout << "Processing time: " << process_time << " ms" << std::endl;
-
-    // Cleanup
-    timer.reset();
-    cores.clear();
-    double cleanup_time = timer.elapsed_ms();
-    std::cout << "Cleanup time: " << cleanup_time << " ms" << std::endl;
+    config->setValue("processing.batch_size", std::to_string(test_data.size()));
+    cpp_template::modules::DataProcessor processor(config);
+    reportAllocations("DataProcessor processItem", test_data.size(), [&] {
+        for (const auto& str : test_data) {
+            processor.processItem(str, cpp_template::modules::ProcessingMode::ADVANCED);
+        }
+    });
+    reportAllocations("DataProcessor processBatch", test_data.size(),
+                      [&] { processor.processBatch(test_data); });
+    cpp_template::modules::ProcessingContext context;
+    reportAllocations("processBatch (context)", test_data.size(), [&] {
+        context.reset();
+        processor.processBatch(test_data, cpp_template::modules::ProcessingMode::BATCH, context);
+    });
 
     std::cout << std::endl;
 }
@@ -9,8 +9,12 @@
  * needed by client code.
  */
 
+#include <cstddef>
+#include <functional>
 #include <memory>
 #include <string>
+#include <string_view>
+#include <vector>
 
 namespace cpp_template {
 
@@ -23,6 +27,13 @@ namespace cpp_template {
  */
 class Core {
   public:
+    /**
+     * @brief Consumer for processMany() results, called in input order
+     *
+     * The view is valid until processMany() returns.
+     */
+    using ProcessedSink = std::function<void(std::string_view processed)>;
+
     /**
      * @brief Construct a new Core object
      *
@@ -65,6 +76,28 @@ class Core {
      */
     std::string process(const std::string& input) const;
 
+    /**
+     * @brief Process many inputs in one call
+     *
+     * Equivalent to calling process() on each input, but crosses the
+     * implementation boundary once and writes all results into one buffer.
+     *
+     * @param inputs Pointer to the first input
+     * @param count Number of inputs
+     * @param sink Receives each processed result in input order
+     */
+    void processMany(const std::string_view* inputs, size_t count,
+                     const ProcessedSink& sink) const;
+
+    /**
+     * @brief Process many inputs in one call
+     *
+     * @param inputs The inputs
+     * @param sink Receives each processed result in input order
+     */
+    void processMany(const std::vector<std::string_view>& inputs,
+                     const ProcessedSink& sink) const;
+
     /**
      * @brief Initialize the core system
      *
@@ -83,7 +116,18 @@ class Core {
 
   private:
     class Impl;  // Forward declaration for PIMPL idiom
-    std::unique_ptr<Impl> pImpl_;
+
+    // Impl lives in inline storage rather than on the heap, so construction
+    // and copies allocate nothing beyond what the implementation itself
+    // needs. The size leaves headroom so Impl can grow without changing the
+    // layout of Core; core_impl.cpp static_asserts that it fits.
+    static constexpr size_t kImplSize = 64;
+    static constexpr size_t kImplAlignment = alignof(std::max_align_t);
+
+    Impl& impl() noexcept;
+    const Impl& impl() const noexcept;
+
+    alignas(kImplAlignment) unsigned char storage_[kImplSize];
 };
 
 /**
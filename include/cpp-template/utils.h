@@ -10,6 +10,7 @@
  */
 
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace cpp_template {
@@ -53,6 +54,56 @@ std::vector<std::string> split(const std::string& input, char delimiter);
  */
 std::string join(const std::vector<std::string>& strings, const std::string& delimiter);
 
+/**
+ * @brief Convert a string to uppercase in place
+ *
+ * @param inout The string to convert
+ */
+void toUpperInPlace(std::string& inout);
+
+/**
+ * @brief Convert a string to lowercase in place
+ *
+ * @param inout The string to convert
+ */
+void toLowerInPlace(std::string& inout);
+
+/**
+ * @brief Convert a string view to uppercase into a reusable buffer
+ *
+ * @param input The input string
+ * @param output The buffer receiving the result (previous contents replaced)
+ */
+void toUpper(std::string_view input, std::string& output);
+
+/**
+ * @brief Convert a string view to lowercase into a reusable buffer
+ *
+ * @param input The input string
+ * @param output The buffer receiving the result (previous contents replaced)
+ */
+void toLower(std::string_view input, std::string& output);
+
+/**
+ * @brief Split a string by a delimiter into views of the source
+ *
+ * @param input The input string to split
+ * @param delimiter The delimiter character
+ * @param output Vector receiving views into @p input (previous contents replaced)
+ * @return size_t The number of parts written
+ */
+size_t split(std::string_view input, char delimiter, std::vector<std::string_view>& output);
+
+/**
+ * @brief Join strings with a delimiter, appending to a reusable buffer
+ *
+ * @param strings The strings to join
+ * @param delimiter The delimiter string
+ * @param output The buffer the joined string is appended to
+ */
+void join(const std::vector<std::string_view>& strings, std::string_view delimiter,
+          std::string& output);
+
 }  // namespace string_utils
 
 /**
@@ -87,6 +138,16 @@ bool isAlphanumeric(const std::string& input);
  */
 bool isValidEmail(const std::string& email);
 
+/**
+ * @brief Validate a batch of email addresses
+ *
+ * @param emails The addresses to validate
+ * @param results Receives one flag (1 = valid) per address, resized to emails.size()
+ * @return size_t The number of valid addresses
+ */
+size_t validateEmails(const std::vector<std::string_view>& emails,
+                      std::vector<unsigned char>& results);
+
 }  // namespace validation
 
 }  // namespace cpp_template
@@ -1,7 +1,11 @@
 #pragma once
 
+#include <cstddef>
+#include <functional>
 #include <memory>
 #include <string>
+#include <string_view>
+#include <vector>
 
 namespace cpp_template {
 namespace core {
@@ -14,6 +18,14 @@ namespace core {
  */
 class Core {
   public:
+    /**
+     * @brief Consumer for processMany() results, called in input order
+     *
+     * The view points into a buffer owned by processMany() and is valid
+     * until it returns; copy it to keep the result.
+     */
+    using ProcessedSink = std::function<void(std::string_view processed)>;
+
     /**
      * @brief Construct a new Core object
      *
@@ -56,6 +68,28 @@ class Core {
      */
     std::string process(const std::string& input) const;
 
+    /**
+     * @brief Process many inputs with one initialization check and one allocation
+     *
+     * Produces exactly what process() produces for each input, but builds the
+     * prefix once and writes every result into a single pre-sized buffer.
+     *
+     * @param inputs Pointer to the first input
+     * @param count Number of inputs
+     * @param sink Receives each processed result in input order
+     */
+    void processMany(const std::string_view* inputs, size_t count,
+                     const ProcessedSink& sink) const;
+
+    /**
+     * @brief Process many inputs with one initialization check and one allocation
+     *
+     * @param inputs The inputs
+     * @param sink Receives each processed result in input order
+     */
+    void processMany(const std::vector<std::string_view>& inputs,
+                     const ProcessedSink& sink) const;
+
     /**
      * @brief Initialize the core system
      *
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace cpp_template {
+namespace core {
+
+/**
+ * @brief CPUs of one NUMA node that the process may run on
+ */
+struct NumaNode {
+    uint32_t id = 0;             // Kernel node number
+    std::vector<uint32_t> cpus;  // Allowed CPUs on the node, ascending
+};
+
+/**
+ * @brief CPUs the process can actually use
+ *
+ * std::thread::hardware_concurrency() reports every core of the host, which
+ * in a container oversubscribes the CPU quota and ignores the affinity
+ * mask. This combines the affinity mask, the cgroup CPU quota (cgroup v2
+ * cpu.max or v1 cpu.cfs_quota_us, with the tightest limit on the path to
+ * the root winning) and the NUMA node layout. The platform code lives next
+ * to the other platform utilities; systems without these interfaces report
+ * one node holding hardware_concurrency() CPUs and no quota.
+ */
+struct CpuTopology {
+    std::vector<uint32_t> allowed_cpus;  // Affinity mask, ascending
+    std::vector<NumaNode> nodes;         // Nodes with at least one allowed CPU
+    double cpu_quota = 0.0;              // CPUs worth of cgroup quota; 0 when unlimited
+
+    /**
+     * @brief Get the number of threads that can run at once
+     *
+     * @return size_t Allowed CPU count, capped by the quota rounded up; at least 1
+     */
+    size_t concurrency() const noexcept;
+};
+
+/**
+ * @brief Read the topology of the calling process
+ *
+ * @param sysroot Directory holding proc/ and sys/; tests point it at a fake tree
+ * @return CpuTopology The topology; sources that cannot be read are skipped
+ */
+CpuTopology detectCpuTopology(const std::string& sysroot = "/");
+
+/**
+ * @brief Get the topology read once at first use
+ *
+ * @return const CpuTopology& The cached topology
+ */
+const CpuTopology& cpuTopology();
+
+/**
+ * @brief Get the default worker count: cpuTopology().concurrency()
+ *
+ * @return size_t The number of threads that can run at once
+ */
+size_t effectiveConcurrency();
+
+/**
+ * @brief Restrict the calling thread to a set of CPUs
+ *
+ * @param cpus CPU numbers as reported by the topology
+ * @return true if the affinity was applied
+ * @return false if @p cpus is empty or the platform has no thread affinity
+ */
+bool pinCurrentThread(const std::vector<uint32_t>& cpus);
+
+/**
+ * @brief Parse a kernel CPU list such as "0-3,8,10-11"
+ *
+ * @param text The list; surrounding whitespace is ignored
+ * @return std::vector<uint32_t> The CPUs, ascending; empty if the list is malformed
+ */
+std::vector<uint32_t> parseCpuList(std::string_view text);
+
+}  // namespace core
+}  // namespace cpp_template
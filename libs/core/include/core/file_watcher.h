@@ -0,0 +1,72 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <string>
+
+namespace cpp_template {
+namespace core {
+
+/**
+ * @brief Background notification of changes to one file
+ *
+ * Watches the directory holding the file, so the file may be rewritten in
+ * place, replaced by a rename (as editors and deployment tools do), deleted
+ * and created again. Uses inotify on Linux, kqueue on macOS and
+ * ReadDirectoryChangesW on Windows; the platform code lives next to the
+ * other platform utilities. On Linux, when the file is a relative symlink,
+ * replacing the entry its target starts with also counts as a change: that
+ * is how a Kubernetes ConfigMap volume swaps its `..data` link.
+ *
+ * The callback runs on the watcher's own thread. Events that arrive while
+ * it runs, or together in one burst, are coalesced into one more call, so
+ * the callback should re-read the file rather than count calls.
+ */
+class FileWatcher {
+  public:
+    using Callback = std::function<void()>;
+
+    /**
+     * @brief Start watching a file
+     *
+     * The file itself does not need to exist yet; its directory does.
+     *
+     * @param path The file to watch
+     * @param on_change Called after the file was written, replaced or removed
+     * @throws std::system_error if the platform watch cannot be set up
+     */
+    FileWatcher(std::string path, Callback on_change);
+
+    /**
+     * @brief Stop watching and join the watcher thread
+     */
+    ~FileWatcher();
+
+    // Non-copyable and non-movable: the watcher thread holds a pointer to the state
+    FileWatcher(const FileWatcher&) = delete;
+    FileWatcher& operator=(const FileWatcher&) = delete;
+
+    /**
+     * @brief Stop watching; no callback runs once this returns
+     *
+     * Must not be called from the callback. Safe to call more than once.
+     */
+    void stop();
+
+    /**
+     * @brief Get the watched file
+     *
+     * @return const std::string& The path given to the constructor
+     */
+    const std::string& path() const noexcept { return path_; }
+
+  private:
+    // Platform watch state; defined in the platform source files
+    struct Impl;
+
+    std::string path_;
+    std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace core
+}  // namespace cpp_template
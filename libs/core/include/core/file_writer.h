@@ -0,0 +1,104 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace cpp_template {
+namespace core {
+
+/**
+ * @brief Buffered sequential writer for a whole output file
+ *
+ * The write-side counterpart of MappedFile: small writes are gathered in
+ * one large buffer that goes out with a single system call when it fills
+ * up, and a write that does not fit is sent together with the buffered
+ * bytes in one vectored write (writev on POSIX) instead of being copied.
+ * Bytes reach the file in the order they were written. Uses plain file
+ * descriptors on POSIX systems and file handles on Windows.
+ */
+class FileWriter {
+  public:
+    /**
+     * @brief Construct a closed File Writer object
+     *
+     * @param buffer_size Bytes gathered before a write is issued (at least 1)
+     */
+    explicit FileWriter(size_t buffer_size = 1 << 20);
+
+    /**
+     * @brief Flush and close the file if it is open, ignoring errors
+     */
+    ~FileWriter();
+
+    // Non-copyable and non-movable: the buffer is tied to one open file
+    FileWriter(const FileWriter&) = delete;
+    FileWriter& operator=(const FileWriter&) = delete;
+
+    /**
+     * @brief Create or truncate a file for writing, closing any previous file first
+     *
+     * @param path The file to write
+     * @return true if the file was opened
+     * @return false if the file could not be created
+     */
+    bool open(const std::string& path);
+
+    /**
+     * @brief Append bytes to the file
+     *
+     * @param data The bytes to append
+     * @return true if the bytes were buffered or written
+     * @return false if a write failed; the writer then rejects further writes
+     */
+    bool write(std::string_view data);
+
+    /**
+     * @brief Write out all buffered bytes
+     *
+     * @return true if everything written so far reached the file
+     * @return false if a write failed
+     */
+    bool flush();
+
+    /**
+     * @brief Flush and close the file
+     *
+     * @return true if every byte was written and the file closed cleanly
+     * @return false if a write or the close failed (or no file was open)
+     */
+    bool close();
+
+    /**
+     * @brief Check whether a file is currently open
+     *
+     * @return true if open() succeeded and close() has not been called
+     */
+    bool isOpen() const noexcept;
+
+    /**
+     * @brief Get the number of bytes accepted by write()
+     *
+     * @return uint64_t Bytes written or buffered since open()
+     */
+    uint64_t bytesWritten() const noexcept { return bytes_written_; }
+
+  private:
+    // Write the buffered bytes followed by @p extra, retrying partial writes
+    bool writeOut(std::string_view extra);
+
+#if defined(_WIN32)
+    void* handle_ = nullptr;
+#else
+    int fd_ = -1;
+#endif
+    std::vector<char> buffer_;
+    size_t used_ = 0;
+    uint64_t bytes_written_ = 0;
+    bool failed_ = false;
+};
+
+}  // namespace core
+}  // namespace cpp_template
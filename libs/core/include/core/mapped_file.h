@@ -0,0 +1,78 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+namespace cpp_template {
+namespace core {
+
+/**
+ * @brief Read-only memory mapping of a whole file
+ *
+ * The file contents are exposed as a std::string_view that stays valid until
+ * the mapping is closed or the object is destroyed. Empty files open
+ * successfully with an empty view. Uses mmap on POSIX systems and file
+ * mapping objects on Windows.
+ */
+class MappedFile {
+  public:
+    /**
+     * @brief Construct a closed Mapped File object
+     */
+    MappedFile() noexcept = default;
+
+    /**
+     * @brief Unmap the file if it is open
+     */
+    ~MappedFile();
+
+    // Non-copyable but movable
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    /**
+     * @brief Map a file, closing any previous mapping first
+     *
+     * @param path The file to map
+     * @return true if the file was opened and mapped
+     * @return false if the file could not be opened or mapped
+     */
+    bool open(const std::string& path);
+
+    /**
+     * @brief Unmap the file
+     */
+    void close() noexcept;
+
+    /**
+     * @brief Check whether a file is currently mapped
+     *
+     * @return true if open() succeeded and close() has not been called
+     */
+    bool isOpen() const noexcept { return is_open_; }
+
+    /**
+     * @brief Get the mapped contents
+     *
+     * @return std::string_view The file bytes (empty when closed)
+     */
+    std::string_view view() const noexcept { return std::string_view(data_, size_); }
+
+    /**
+     * @brief Get the size of the mapped file
+     *
+     * @return size_t The size in bytes
+     */
+    size_t size() const noexcept { return size_; }
+
+  private:
+    const char* data_ = nullptr;
+    size_t size_ = 0;
+    bool is_open_ = false;
+};
+
+}  // namespace core
+}  // namespace cpp_template
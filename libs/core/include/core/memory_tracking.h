@@ -0,0 +1,169 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace cpp_template {
+namespace core {
+namespace memory {
+
+/**
+ * @brief Parts of the library that heap allocations are attributed to
+ */
+enum class Subsystem : uint8_t {
+    OTHER,  // Outside every AllocationScope
+    CORE,
+    STRING_UTILS,
+    CONFIG,
+    DATA_PROCESSOR
+};
+
+/**
+ * @brief Number of Subsystem values
+ */
+constexpr size_t kSubsystemCount = 5;
+
+/**
+ * @brief Get the display name of a subsystem
+ *
+ * @param subsystem The subsystem
+ * @return const char* Upper-case name, e.g. "DATA_PROCESSOR"
+ */
+const char* subsystemName(Subsystem subsystem) noexcept;
+
+/**
+ * @brief Heap allocation counters of one subsystem, or of the whole process
+ *
+ * Counts and byte totals cover the time since the last resetStatistics();
+ * current_bytes is everything still live, however old. A block is always
+ * charged back to the subsystem that allocated it, whichever frees it.
+ */
+struct AllocationStatistics {
+    uint64_t allocations = 0;
+    uint64_t deallocations = 0;
+    uint64_t bytes_allocated = 0;
+    uint64_t bytes_freed = 0;
+    uint64_t current_bytes = 0;  // Live bytes
+    uint64_t peak_bytes = 0;     // Highest current_bytes since the last reset
+};
+
+/**
+ * @brief Check if allocation tracking is available
+ *
+ * Tracking needs the replacement operator new/delete of the
+ * core-memory-hooks CMake target to be linked into the executable; every
+ * counter stays zero otherwise.
+ *
+ * @return true if the hooks are linked in
+ */
+bool trackingActive() noexcept;
+
+/**
+ * @brief Pause or resume counting at runtime
+ *
+ * Counting is on from process start. While it is off, new blocks are not
+ * counted, and neither is their release later on, so current_bytes only
+ * ever covers counted blocks. The benchmark suite turns it on just for its
+ * memory measurement runs, keeping the counters off the timed loops.
+ *
+ * @param on Whether to count
+ */
+void setCountingEnabled(bool on) noexcept;
+
+/**
+ * @brief Check if new allocations are counted
+ *
+ * @return true unless turned off with setCountingEnabled()
+ */
+bool countingEnabled() noexcept;
+
+/**
+ * @brief Get the allocation counters of one subsystem
+ *
+ * @param subsystem The subsystem
+ * @return AllocationStatistics The counters
+ */
+AllocationStatistics statistics(Subsystem subsystem) noexcept;
+
+/**
+ * @brief Get the allocation counters of the whole process
+ *
+ * peak_bytes is the process-wide peak, not the sum of subsystem peaks.
+ *
+ * @return AllocationStatistics The counters
+ */
+AllocationStatistics totalStatistics() noexcept;
+
+/**
+ * @brief Zero the counts and byte totals, and restart peaks from the live bytes
+ */
+void resetStatistics() noexcept;
+
+/**
+ * @brief Attribute the allocations of the calling thread to a subsystem
+ *
+ * Lasts until the scope is destroyed. Scopes nest with the outermost one
+ * winning, so the string utilities called by DataProcessor are charged to
+ * DATA_PROCESSOR. Usually created through CORE_MEMORY_SCOPE so that it can
+ * be compiled out.
+ */
+class AllocationScope {
+  public:
+    /**
+     * @brief Enter the scope
+     *
+     * @param subsystem Subsystem to charge, unless an outer scope is active
+     */
+    explicit AllocationScope(Subsystem subsystem) noexcept;
+
+    /**
+     * @brief Leave the scope
+     */
+    ~AllocationScope();
+
+    AllocationScope(const AllocationScope&) = delete;
+    AllocationScope& operator=(const AllocationScope&) = delete;
+
+  private:
+    Subsystem previous_;
+};
+
+namespace detail {
+
+// Recorded in the header of blocks allocated while counting was off
+constexpr Subsystem kUncounted = static_cast<Subsystem>(0xff);
+
+// Called once by core-memory-hooks during static initialisation
+void markHooksLinked() noexcept;
+
+// Count an allocation against the calling thread's scope; returns the
+// subsystem charged (or kUncounted) so that the matching deallocation can
+// be charged back
+Subsystem recordAllocation(size_t bytes) noexcept;
+
+// Count the release of a block allocated by `subsystem`; ignores kUncounted
+void recordDeallocation(Subsystem subsystem, size_t bytes) noexcept;
+
+}  // namespace detail
+
+}  // namespace memory
+}  // namespace core
+}  // namespace cpp_template
+
+#define CORE_MEMORY_CONCAT_IMPL(a, b) a##b
+#define CORE_MEMORY_CONCAT(a, b) CORE_MEMORY_CONCAT_IMPL(a, b)
+
+/**
+ * @brief Charge the allocations in the rest of the enclosing scope to
+ * Subsystem::@p subsystem
+ *
+ * Expands to nothing unless the build defines CORE_ENABLE_MEMORY_TRACKING
+ * (CMake option CORE_ENABLE_MEMORY_TRACKING).
+ */
+#if defined(CORE_ENABLE_MEMORY_TRACKING)
+    #define CORE_MEMORY_SCOPE(subsystem)                                          \
+        ::cpp_template::core::memory::AllocationScope CORE_MEMORY_CONCAT(         \
+            core_memory_scope_, __LINE__)(::cpp_template::core::memory::Subsystem::subsystem)
+#else
+    #define CORE_MEMORY_SCOPE(subsystem) static_cast<void>(0)
+#endif
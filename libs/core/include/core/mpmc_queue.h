@@ -0,0 +1,186 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include "core/statistics.h"
+
+namespace cpp_template {
+namespace core {
+
+/**
+ * @brief Bounded lock-free multi-producer/multi-consumer queue
+ *
+ * A ring of cells, each carrying a sequence number that tells producers and
+ * consumers whose turn it is (Dmitry Vyukov's bounded MPMC design). Push and
+ * pop claim a position with one compare-and-swap on the shared cursor and
+ * never block; a full or empty queue is reported to the caller instead, so
+ * callers choose their own backoff or backpressure policy.
+ *
+ * @tparam T The element type; must be nothrow move constructible
+ */
+template <typename T>
+class MpmcQueue {
+    static_assert(std::is_nothrow_move_constructible_v<T>,
+                  "MpmcQueue requires a nothrow move constructible T");
+
+  public:
+    /**
+     * @brief Construct a new Mpmc Queue object
+     *
+     * @param capacity Maximum number of queued elements, rounded up to a power of two (min 2)
+     */
+    explicit MpmcQueue(size_t capacity) : capacity_(roundUp(capacity)), mask_(capacity_ - 1) {
+        cells_ = std::make_unique<Cell[]>(capacity_);
+        for (size_t i = 0; i < capacity_; ++i) {
+            cells_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+        enqueue_pos_.value.store(0, std::memory_order_relaxed);
+        dequeue_pos_.value.store(0, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Destroy the queue and any elements still in it
+     */
+    ~MpmcQueue() {
+        T discarded;
+        while (tryPop(discarded)) {
+        }
+    }
+
+    // Non-copyable and non-movable: other threads may hold references to it
+    MpmcQueue(const MpmcQueue&) = delete;
+    MpmcQueue& operator=(const MpmcQueue&) = delete;
+
+    /**
+     * @brief Construct an element in place at the back if there is room
+     *
+     * @param args Constructor arguments for T
+     * @return true if the element was queued
+     * @return false if the queue was full (the arguments are left untouched)
+     */
+    template <typename... Args>
+    bool tryEmplace(Args&&... args) {
+        Cell* cell = nullptr;
+        size_t position = enqueue_pos_.value.load(std::memory_order_relaxed);
+        for (;;) {
+            cell = &cells_[position & mask_];
+            size_t sequence = cell->sequence.load(std::memory_order_acquire);
+            auto difference = static_cast<std::ptrdiff_t>(sequence - position);
+            if (difference == 0) {
+                if (enqueue_pos_.value.compare_exchange_weak(position, position + 1,
+                                                             std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (difference < 0) {
+                return false;  // Full: the consumer of the previous lap has not freed this cell
+            } else {
+                position = enqueue_pos_.value.load(std::memory_order_relaxed);
+            }
+        }
+
+        ::new (static_cast<void*>(cell->storage)) T(std::forward<Args>(args)...);
+        cell->sequence.store(position + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Move an element to the back if there is room
+     *
+     * @param value The element; left untouched if the queue is full
+     * @return true if the element was queued
+     */
+    bool tryPush(T&& value) { return tryEmplace(std::move(value)); }
+
+    /**
+     * @brief Copy an element to the back if there is room
+     *
+     * @param value The element
+     * @return true if the element was queued
+     */
+    bool tryPush(const T& value) { return tryEmplace(value); }
+
+    /**
+     * @brief Take the front element if there is one
+     *
+     * @param value Receives the element
+     * @return true if an element was taken
+     * @return false if the queue was empty
+     */
+    bool tryPop(T& value) {
+        Cell* cell = nullptr;
+        size_t position = dequeue_pos_.value.load(std::memory_order_relaxed);
+        for (;;) {
+            cell = &cells_[position & mask_];
+            size_t sequence = cell->sequence.load(std::memory_order_acquire);
+            auto difference = static_cast<std::ptrdiff_t>(sequence - (position + 1));
+            if (difference == 0) {
+                if (dequeue_pos_.value.compare_exchange_weak(position, position + 1,
+                                                             std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (difference < 0) {
+                return false;  // Empty: no producer has filled this cell yet
+            } else {
+                position = dequeue_pos_.value.load(std::memory_order_relaxed);
+            }
+        }
+
+        T* element = std::launder(reinterpret_cast<T*>(cell->storage));
+        value = std::move(*element);
+        element->~T();
+        cell->sequence.store(position + capacity_, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Get the number of queued elements
+     *
+     * Exact only while no other thread is pushing or popping.
+     *
+     * @return size_t The approximate element count
+     */
+    size_t sizeApprox() const noexcept {
+        size_t tail = enqueue_pos_.value.load(std::memory_order_relaxed);
+        size_t head = dequeue_pos_.value.load(std::memory_order_relaxed);
+        return tail > head ? tail - head : 0;
+    }
+
+    /**
+     * @brief Get the maximum number of queued elements
+     *
+     * @return size_t The capacity
+     */
+    size_t capacity() const noexcept { return capacity_; }
+
+  private:
+    struct Cell {
+        std::atomic<size_t> sequence;
+        alignas(T) unsigned char storage[sizeof(T)];
+    };
+
+    // Producers and consumers each own a cursor on its own cache line
+    struct alignas(kCacheLineSize) Cursor {
+        std::atomic<size_t> value;
+    };
+
+    static size_t roundUp(size_t capacity) noexcept {
+        size_t rounded = 2;
+        while (rounded < capacity) {
+            rounded *= 2;
+        }
+        return rounded;
+    }
+
+    const size_t capacity_;
+    const size_t mask_;
+    std::unique_ptr<Cell[]> cells_;
+    Cursor enqueue_pos_;
+    Cursor dequeue_pos_;
+};
+
+}  // namespace core
+}  // namespace cpp_template
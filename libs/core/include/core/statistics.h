@@ -0,0 +1,152 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace cpp_template {
+namespace core {
+
+/**
+ * @brief Assumed size of a cache line, used to pad per-thread shards
+ */
+constexpr size_t kCacheLineSize = 64;
+
+namespace detail {
+
+/**
+ * @brief Get a small, stable index for the calling thread
+ *
+ * Threads are numbered in the order they first ask; callers reduce the
+ * index modulo their shard count.
+ *
+ * @return size_t The calling thread's index
+ */
+inline size_t threadShardIndex() noexcept {
+    static std::atomic<size_t> next_index{0};
+    thread_local const size_t index = next_index.fetch_add(1, std::memory_order_relaxed);
+    return index;
+}
+
+}  // namespace detail
+
+/**
+ * @brief Thread-safe counter split into cache-line-padded shards
+ *
+ * Each thread increments its own shard with a relaxed atomic add, so
+ * concurrent writers do not bounce a shared cache line. Reading sums all
+ * shards and is therefore more expensive than writing.
+ */
+class ShardedCounter {
+  public:
+    static constexpr size_t kShardCount = 16;
+
+    ShardedCounter();
+
+    /**
+     * @brief Add to the counter
+     *
+     * @param amount The amount to add
+     */
+    void add(uint64_t amount = 1) noexcept {
+        shards_[detail::threadShardIndex() % kShardCount].value.fetch_add(
+            amount, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Get the current total across all shards
+     *
+     * @return uint64_t The counter value
+     */
+    uint64_t value() const noexcept;
+
+    /**
+     * @brief Reset every shard to zero
+     */
+    void reset() noexcept;
+
+  private:
+    struct alignas(kCacheLineSize) Shard {
+        std::atomic<uint64_t> value;
+    };
+
+    std::unique_ptr<Shard[]> shards_;
+};
+
+/**
+ * @brief Summary of a latency distribution
+ */
+struct LatencySnapshot {
+    uint64_t count = 0;
+    uint64_t p50_ns = 0;
+    uint64_t p99_ns = 0;
+    uint64_t max_ns = 0;
+    double mean_ns = 0.0;
+};
+
+/**
+ * @brief Thread-safe log-linear latency histogram
+ *
+ * Values are bucketed by power of two with 8 linear sub-buckets each
+ * (about 6% relative error); values below 8 ns are exact. Recording is a
+ * few relaxed atomic adds on the calling thread's shard; percentiles are
+ * computed when a snapshot is taken.
+ */
+class LatencyHistogram {
+  public:
+    static constexpr size_t kShardCount = 8;
+    static constexpr unsigned kSubBucketBits = 3;
+    static constexpr size_t kSubBuckets = size_t{1} << kSubBucketBits;
+    static constexpr unsigned kMaxExponent = 42;  // about 73 minutes in nanoseconds
+    static constexpr size_t kBucketCount = (kMaxExponent - kSubBucketBits + 2) * kSubBuckets;
+
+    LatencyHistogram();
+
+    /**
+     * @brief Record one sample
+     *
+     * @param nanoseconds The measured latency
+     */
+    void record(uint64_t nanoseconds) noexcept;
+
+    /**
+     * @brief Merge all shards into a summary
+     *
+     * @return LatencySnapshot Count, p50, p99, max and mean of the recorded samples
+     */
+    LatencySnapshot snapshot() const;
+
+    /**
+     * @brief Discard all recorded samples
+     */
+    void reset() noexcept;
+
+    /**
+     * @brief Map a value to its bucket index
+     *
+     * @param value The value to bucket
+     * @return size_t The bucket index
+     */
+    static size_t bucketIndex(uint64_t value) noexcept;
+
+    /**
+     * @brief Get the representative (midpoint) value of a bucket
+     *
+     * @param index The bucket index
+     * @return uint64_t The bucket midpoint
+     */
+    static uint64_t bucketValue(size_t index) noexcept;
+
+  private:
+    struct alignas(kCacheLineSize) Shard {
+        std::atomic<uint64_t> buckets[kBucketCount];
+        std::atomic<uint64_t> sum;
+        std::atomic<uint64_t> max;
+    };
+
+    std::unique_ptr<Shard[]> shards_;
+};
+
+}  // namespace core
+}  // namespace cpp_template
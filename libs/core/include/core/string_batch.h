@@ -0,0 +1,341 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace cpp_template {
+namespace core {
+namespace utils {
+namespace string {
+
+/**
+ * @brief Columnar batch of strings: one byte buffer plus an offsets array
+ *
+ * Laid out like an Apache Arrow utf8 array without a validity bitmap:
+ * string i is the bytes [offsets()[i], offsets()[i + 1]) of data(), and
+ * offsets() holds size() + 1 ascending int32 values starting at 0. Whole
+ * batches are transformed with one sequential scan of data(), and the two
+ * buffers can be wrapped by Arrow (or handed over with fromBuffers()) as
+ * they are, without copying.
+ *
+ *     StringBatch batch{"alpha", "beta"};
+ *     toUpperInPlace(batch);          // one pass over "alphabeta"
+ *     std::string_view second = batch[1];
+ */
+class StringBatch {
+  public:
+    using offset_type = int32_t;
+
+    /**
+     * @brief Forward iterator over the strings of a batch
+     */
+    class const_iterator {
+      public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = std::string_view;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const std::string_view*;
+        using reference = std::string_view;
+
+        const_iterator() = default;
+
+        std::string_view operator*() const noexcept {
+            return std::string_view(data_ + offsets_[0],
+                                    static_cast<size_t>(offsets_[1] - offsets_[0]));
+        }
+
+        const_iterator& operator++() noexcept {
+            ++offsets_;
+            return *this;
+        }
+
+        const_iterator operator++(int) noexcept {
+            const_iterator previous = *this;
+            ++offsets_;
+            return previous;
+        }
+
+        friend bool operator==(const const_iterator& a, const const_iterator& b) noexcept {
+            return a.offsets_ == b.offsets_;
+        }
+
+        friend bool operator!=(const const_iterator& a, const const_iterator& b) noexcept {
+            return a.offsets_ != b.offsets_;
+        }
+
+      private:
+        friend class StringBatch;
+
+        const_iterator(const char* data, const offset_type* offsets) noexcept
+            : data_(data), offsets_(offsets) {}
+
+        const char* data_ = nullptr;
+        const offset_type* offsets_ = nullptr;
+    };
+
+    /**
+     * @brief Construct an empty batch
+     */
+    StringBatch() = default;
+
+    /**
+     * @brief Construct a batch holding copies of the given strings
+     *
+     * @param strings The strings, in order
+     * @throws std::length_error if the total size exceeds the int32 offset range
+     */
+    StringBatch(std::initializer_list<std::string_view> strings) : StringBatch() {
+        assign(strings);
+    }
+
+    /**
+     * @brief Construct a batch holding copies of the strings in a range
+     *
+     * @param strings Range of items convertible to std::string_view
+     * @throws std::length_error if the total size exceeds the int32 offset range
+     */
+    template <typename Range,
+              typename = std::enable_if_t<!std::is_same_v<std::decay_t<Range>, StringBatch>>,
+              typename = decltype(std::string_view(*std::begin(std::declval<const Range&>())))>
+    explicit StringBatch(const Range& strings) : StringBatch() {
+        assign(strings);
+    }
+
+    /**
+     * @brief Adopt existing buffers, e.g. those of an Arrow utf8 array
+     *
+     * @param data The bytes of all strings
+     * @param offsets size() + 1 ascending offsets into @p data, starting at 0
+     * @return StringBatch The batch owning both buffers
+     * @throws std::invalid_argument if the offsets do not describe @p data
+     */
+    static StringBatch fromBuffers(std::vector<char> data, std::vector<offset_type> offsets) {
+        if (offsets.empty() || offsets.front() != 0 ||
+            static_cast<size_t>(offsets.back()) != data.size()) {
+            throw std::invalid_argument("StringBatch offsets must start at 0 and end at the size");
+        }
+        for (size_t i = 1; i < offsets.size(); ++i) {
+            if (offsets[i] < offsets[i - 1]) {
+                throw std::invalid_argument("StringBatch offsets must be ascending");
+            }
+        }
+        StringBatch batch;
+        batch.data_ = std::move(data);
+        batch.offsets_ = std::move(offsets);
+        return batch;
+    }
+
+    /**
+     * @brief Replace the contents with copies of the strings in a range
+     *
+     * Sizes the buffers once, then copies every string in one pass.
+     *
+     * @param strings Range of items convertible to std::string_view
+     * @throws std::length_error if the total size exceeds the int32 offset range
+     */
+    template <typename Range>
+    void assign(const Range& strings) {
+        size_t rows = 0;
+        size_t total = 0;
+        for (const auto& item : strings) {
+            total += std::string_view(item).size();
+            ++rows;
+        }
+        checkedOffset(total);
+
+        data_.resize(total);
+        offsets_.resize(rows + 1);
+        offsets_[0] = 0;
+        size_t position = 0;
+        size_t row = 0;
+        for (const auto& item : strings) {
+            std::string_view text(item);
+            text.copy(data_.data() + position, text.size());
+            position += text.size();
+            offsets_[++row] = static_cast<offset_type>(position);
+        }
+    }
+
+    /**
+     * @brief Lay out rows of known lengths, to be filled in place
+     *
+     * Replaces the contents with @p rows strings where string i has
+     * length(i) bytes. The bytes keep whatever the buffer held before (the
+     * capacity is reused without clearing it) and are meant to be written
+     * through data() + offsets()[i], possibly from several threads at once.
+     *
+     * @param rows Number of strings
+     * @param length Callable returning the length of string i
+     * @return char* The start of the byte buffer
+     * @throws std::length_error if the total size exceeds the int32 offset range
+     */
+    template <typename LengthFn>
+    char* layout(size_t rows, LengthFn&& length) {
+        offsets_.resize(rows + 1);
+        offsets_[0] = 0;
+        size_t total = 0;
+        for (size_t i = 0; i < rows; ++i) {
+            total += length(i);
+            offsets_[i + 1] = checkedOffset(total);
+        }
+        data_.resize(total);
+        return data_.data();
+    }
+
+    /**
+     * @brief Append a copy of a string
+     *
+     * @param text The string
+     * @throws std::length_error if the total size exceeds the int32 offset range
+     */
+    void append(std::string_view text) {
+        offset_type end = checkedOffset(data_.size() + text.size());
+        startOffsets();
+        data_.insert(data_.end(), text.begin(), text.end());
+        offsets_.push_back(end);
+    }
+
+    /**
+     * @brief Append a zeroed string of @p length bytes for the caller to write
+     *
+     * @param length Length of the new string
+     * @return char* Where its bytes go; valid until the batch grows again
+     * @throws std::length_error if the total size exceeds the int32 offset range
+     */
+    char* appendRow(size_t length) {
+        offset_type end = checkedOffset(data_.size() + length);
+        startOffsets();
+        data_.resize(data_.size() + length);
+        offsets_.push_back(end);
+        return data_.data() + (data_.size() - length);
+    }
+
+    /**
+     * @brief Reserve space for more strings and bytes
+     *
+     * @param rows Total number of strings to make room for
+     * @param bytes Total number of bytes to make room for
+     */
+    void reserve(size_t rows, size_t bytes) {
+        offsets_.reserve(rows + 1);
+        data_.reserve(bytes);
+    }
+
+    /**
+     * @brief Remove every string, keeping the capacity
+     */
+    void clear() noexcept {
+        data_.clear();
+        offsets_.clear();
+    }
+
+    /**
+     * @brief Get string i
+     *
+     * @param index Row index; must be less than size()
+     * @return std::string_view View into data(), valid until the batch is modified
+     */
+    std::string_view operator[](size_t index) const noexcept {
+        return std::string_view(data_.data() + offsets_[index],
+                                static_cast<size_t>(offsets_[index + 1] - offsets_[index]));
+    }
+
+    /**
+     * @brief Get the number of strings
+     *
+     * @return size_t The row count
+     */
+    size_t size() const noexcept { return offsets_.empty() ? 0 : offsets_.size() - 1; }
+
+    /**
+     * @brief Check if the batch holds no strings
+     *
+     * @return true if size() is 0
+     */
+    bool empty() const noexcept { return size() == 0; }
+
+    /**
+     * @brief Get the total length of all strings
+     *
+     * @return size_t Size of the byte buffer
+     */
+    size_t bytes() const noexcept { return data_.size(); }
+
+    /**
+     * @brief Get the byte buffer
+     *
+     * @return const char* The bytes of every string, back to back
+     */
+    const char* data() const noexcept { return data_.data(); }
+
+    /**
+     * @brief Get the byte buffer for in-place transforms
+     *
+     * @return char* The bytes of every string, back to back
+     */
+    char* data() noexcept { return data_.data(); }
+
+    /**
+     * @brief Get the offsets array
+     *
+     * @return const offset_type* size() + 1 offsets into data()
+     */
+    const offset_type* offsets() const noexcept {
+        return offsets_.empty() ? &kEmptyOffsets : offsets_.data();
+    }
+
+    const_iterator begin() const noexcept { return const_iterator(data_.data(), offsets()); }
+
+    const_iterator end() const noexcept { return const_iterator(data_.data(), offsets() + size()); }
+
+    /**
+     * @brief Copy the strings out into individual std::string objects
+     *
+     * @return std::vector<std::string> One string per row
+     */
+    std::vector<std::string> toVector() const { return std::vector<std::string>(begin(), end()); }
+
+    friend bool operator==(const StringBatch& a, const StringBatch& b) noexcept {
+        return a.size() == b.size() && a.data_ == b.data_ &&
+               std::equal(a.offsets(), a.offsets() + a.size(), b.offsets());
+    }
+
+    friend bool operator!=(const StringBatch& a, const StringBatch& b) noexcept {
+        return !(a == b);
+    }
+
+  private:
+    static constexpr offset_type kEmptyOffsets = 0;
+
+    // The leading 0 is added lazily, so empty and moved-from batches own no memory
+    void startOffsets() {
+        if (offsets_.empty()) {
+            offsets_.push_back(0);
+        }
+    }
+
+    static offset_type checkedOffset(size_t position) {
+        if (position > static_cast<size_t>(std::numeric_limits<offset_type>::max())) {
+            throw std::length_error("StringBatch exceeds the int32 offset range");
+        }
+        return static_cast<offset_type>(position);
+    }
+
+    std::vector<char> data_;
+    std::vector<offset_type> offsets_;  // Empty, or size() + 1 entries starting at 0
+};
+
+}  // namespace string
+}  // namespace utils
+}  // namespace core
+}  // namespace cpp_template
@@ -0,0 +1,225 @@
+#pragma once
+
+#include <charconv>
+#include <cstddef>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace cpp_template {
+namespace core {
+namespace utils {
+namespace string {
+
+/**
+ * @brief Appender that builds a string in one reusable buffer
+ *
+ * Accepts text, characters and numbers (formatted with std::to_chars, no
+ * locale, no temporaries). Multi-part appends compute the final length
+ * first and grow the buffer at most once; clear() keeps the capacity so one
+ * builder can produce many strings without reallocating.
+ *
+ *     StringBuilder builder;
+ *     builder.appendAll("id=", 42, ' ', "ratio=", 0.5);
+ *     builder.appendJoined(names, ", ");
+ *     std::string text = std::move(builder).release();
+ */
+class StringBuilder {
+  public:
+    StringBuilder() = default;
+
+    /**
+     * @brief Construct a new String Builder object with reserved capacity
+     *
+     * @param capacity Number of characters to reserve
+     */
+    explicit StringBuilder(size_t capacity) { buffer_.reserve(capacity); }
+
+    /**
+     * @brief Append text
+     *
+     * @param text The text
+     * @return StringBuilder& This builder
+     */
+    StringBuilder& append(std::string_view text) {
+        buffer_.append(text.data(), text.size());
+        return *this;
+    }
+
+    /**
+     * @brief Append one character
+     *
+     * @param character The character
+     * @return StringBuilder& This builder
+     */
+    StringBuilder& append(char character) {
+        buffer_.push_back(character);
+        return *this;
+    }
+
+    /**
+     * @brief Append a formatted number
+     *
+     * Integers are written in decimal, floating-point values in the shortest
+     * form that reads back to the same value.
+     *
+     * @tparam T An arithmetic type other than char and bool
+     * @param value The number
+     * @return StringBuilder& This builder
+     */
+    template <typename T,
+              typename = std::enable_if_t<std::is_arithmetic_v<T> && !std::is_same_v<T, char> &&
+                                          !std::is_same_v<T, bool>>>
+    StringBuilder& append(T value) {
+        char digits[kMaxNumberLength];
+        auto written = std::to_chars(digits, digits + sizeof(digits), value);
+        buffer_.append(digits, static_cast<size_t>(written.ptr - digits));
+        return *this;
+    }
+
+    /**
+     * @brief Append several values, reserving for all of them first
+     *
+     * @param values Values accepted by append()
+     * @return StringBuilder& This builder
+     */
+    template <typename... Values>
+    StringBuilder& appendAll(const Values&... values) {
+        buffer_.reserve(buffer_.size() + (size_t{0} + ... + sizeHint(values)));
+        (append(values), ...);
+        return *this;
+    }
+
+    /**
+     * @brief Append the elements of a range, separated by a delimiter
+     *
+     * For ranges of text the exact final length is computed first, so the
+     * buffer grows at most once; numbers are reserved for by upper bound.
+     *
+     * @param first Iterator to the first element
+     * @param last Iterator past the last element
+     * @param delimiter Text placed between elements
+     * @return StringBuilder& This builder
+     */
+    template <typename Iterator>
+    StringBuilder& appendJoined(Iterator first, Iterator last, std::string_view delimiter) {
+        if (first == last) {
+            return *this;
+        }
+        using Category = typename std::iterator_traits<Iterator>::iterator_category;
+        if constexpr (std::is_base_of_v<std::forward_iterator_tag, Category>) {
+            size_t total = 0;
+            size_t count = 0;
+            for (Iterator it = first; it != last; ++it, ++count) {
+                total += sizeHint(*it);
+            }
+            buffer_.reserve(buffer_.size() + total + delimiter.size() * (count - 1));
+        }
+        append(*first);
+        for (++first; first != last; ++first) {
+            append(delimiter);
+            append(*first);
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Append the elements of a range, separated by a delimiter
+     *
+     * @param range Any range with begin() and end()
+     * @param delimiter Text placed between elements
+     * @return StringBuilder& This builder
+     */
+    template <typename Range>
+    StringBuilder& appendJoined(const Range& range, std::string_view delimiter) {
+        using std::begin;
+        using std::end;
+        return appendJoined(begin(range), end(range), delimiter);
+    }
+
+    /**
+     * @brief Append a value; shorthand for append()
+     */
+    template <typename T>
+    StringBuilder& operator<<(const T& value) {
+        return append(value);
+    }
+
+    /**
+     * @brief Reserve capacity for at least this many characters in total
+     *
+     * @param capacity The capacity
+     */
+    void reserve(size_t capacity) { buffer_.reserve(capacity); }
+
+    /**
+     * @brief Drop the contents but keep the capacity
+     */
+    void clear() noexcept { buffer_.clear(); }
+
+    /**
+     * @brief Get the number of characters built so far
+     *
+     * @return size_t The length
+     */
+    size_t size() const noexcept { return buffer_.size(); }
+
+    /**
+     * @brief Check if nothing has been appended
+     *
+     * @return true if the builder is empty
+     */
+    bool empty() const noexcept { return buffer_.empty(); }
+
+    /**
+     * @brief Get the buffer capacity
+     *
+     * @return size_t The capacity
+     */
+    size_t capacity() const noexcept { return buffer_.capacity(); }
+
+    /**
+     * @brief View the built string
+     *
+     * @return std::string_view The contents, valid until the next modification
+     */
+    std::string_view view() const noexcept { return buffer_; }
+
+    /**
+     * @brief Copy the built string
+     *
+     * @return std::string The contents
+     */
+    std::string str() const { return buffer_; }
+
+    /**
+     * @brief Move the built string out, leaving the builder empty
+     *
+     * @return std::string The contents
+     */
+    std::string release() && { return std::exchange(buffer_, std::string()); }
+
+  private:
+    // Long enough for any integer and for the shortest round-trip double
+    static constexpr size_t kMaxNumberLength = 32;
+
+    template <typename T>
+    static size_t sizeHint(const T& value) {
+        if constexpr (std::is_same_v<T, char>) {
+            return 1;
+        } else if constexpr (std::is_arithmetic_v<T>) {
+            return kMaxNumberLength;
+        } else {
+            return std::string_view(value).size();
+        }
+    }
+
+    std::string buffer_;
+};
+
+}  // namespace string
+}  // namespace utils
+}  // namespace core
+}  // namespace cpp_template
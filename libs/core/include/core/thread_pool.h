@@ -0,0 +1,133 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace cpp_template {
+namespace core {
+
+/**
+ * @brief Where the workers of a ThreadPool run
+ */
+enum class WorkerPlacement {
+    ANY,       // Workers may run on any allowed CPU
+    PER_NODE,  // Workers are spread over the NUMA nodes and pinned to their node's CPUs
+};
+
+/**
+ * @brief Reusable work-stealing thread pool
+ *
+ * Each worker owns a task deque. Workers pop their own tasks LIFO and steal
+ * from the front of other workers' deques when they run dry, so bursts of
+ * work spread across the pool without a single contended queue. Idle
+ * workers steal from workers on their own NUMA node before crossing to
+ * another. Threads are created once in the constructor and joined in the
+ * destructor.
+ */
+class ThreadPool {
+  public:
+    using Task = std::function<void()>;
+
+    /**
+     * @brief Construct a new Thread Pool object
+     *
+     * With WorkerPlacement::PER_NODE, workers are split over the nodes of
+     * cpuTopology() in proportion to their CPU counts and each one is pinned
+     * to the CPUs of its node, so memory it touches first is allocated on
+     * that node. On a single-node machine no thread is pinned.
+     *
+     * @param thread_count Number of worker threads; 0 uses effectiveConcurrency()
+     * @param placement Whether to pin workers to NUMA nodes
+     */
+    explicit ThreadPool(size_t thread_count = 0,
+                        WorkerPlacement placement = WorkerPlacement::ANY);
+
+    /**
+     * @brief Stop accepting work, drain queued tasks and join all workers
+     */
+    ~ThreadPool();
+
+    // Non-copyable and non-movable: workers hold a pointer to the pool
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+    ThreadPool(ThreadPool&&) = delete;
+    ThreadPool& operator=(ThreadPool&&) = delete;
+
+    /**
+     * @brief Get the number of worker threads
+     *
+     * @return size_t The worker count
+     */
+    size_t size() const noexcept;
+
+    /**
+     * @brief Get the NUMA node a worker is placed on
+     *
+     * @param worker Worker index; must be less than size()
+     * @return size_t Index into cpuTopology().nodes; always 0 for WorkerPlacement::ANY
+     */
+    size_t workerNode(size_t worker) const noexcept { return worker_nodes_[worker]; }
+
+    /**
+     * @brief Get the index of the calling worker
+     *
+     * Lets parallelFor() bodies keep per-worker state without locking.
+     *
+     * @return size_t The worker index, or size() when called from outside the pool
+     */
+    size_t currentWorker() const noexcept;
+
+    /**
+     * @brief Queue a task for asynchronous execution
+     *
+     * Tasks submitted from a worker thread go to that worker's own deque.
+     *
+     * @param task The task to run
+     */
+    void submit(Task task);
+
+    /**
+     * @brief Run body over [0, count) in chunks and wait for completion
+     *
+     * Chunks are claimed dynamically by the pool workers and by the calling
+     * thread, which also executes chunks itself. This makes the call safe to
+     * use from inside a pool task. The first exception thrown by body is
+     * rethrown in the caller after all claimed chunks have finished.
+     *
+     * @param count Number of indices to process
+     * @param chunk_size Indices per chunk (0 picks a size from count and pool size)
+     * @param body Callback receiving a half-open [begin, end) index range
+     */
+    void parallelFor(size_t count, size_t chunk_size,
+                     const std::function<void(size_t begin, size_t end)>& body);
+
+  private:
+    struct WorkerQueue {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    void workerLoop(size_t index);
+    bool tryPop(size_t index, Task& task);
+    bool trySteal(size_t thief, Task& task);
+
+    std::vector<std::unique_ptr<WorkerQueue>> queues_;
+    std::vector<size_t> worker_nodes_;
+    size_t node_count_;
+    std::vector<std::thread> threads_;
+    std::atomic<size_t> next_queue_;
+    std::atomic<size_t> pending_;
+    std::mutex wake_mutex_;
+    std::condition_variable wake_;
+    bool stopping_;
+};
+
+}  // namespace core
+}  // namespace cpp_template
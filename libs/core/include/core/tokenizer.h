@@ -0,0 +1,253 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace cpp_template {
+namespace core {
+namespace utils {
+namespace string {
+
+/**
+ * @brief What separates tokens: one character, a character sequence, or any of a set
+ *
+ * Sequence and set delimiters view the text they were built from, which must
+ * outlive the delimiter.
+ */
+class Delimiter {
+  public:
+    /**
+     * @brief Split on a single character
+     *
+     * Implicit, so `tokens(input, ',')` reads naturally.
+     *
+     * @param character The delimiter character
+     */
+    constexpr Delimiter(char character) noexcept
+        : kind_(Kind::CHARACTER), character_(character), text_(), set_() {}
+
+    /**
+     * @brief Split on a multi-character sequence
+     *
+     * @param text The delimiter sequence; must not be empty
+     * @return Delimiter The delimiter
+     * @throws std::invalid_argument if @p text is empty
+     */
+    static Delimiter sequence(std::string_view text);
+
+    /**
+     * @brief Split on any one character from a set
+     *
+     * @param characters The delimiter characters; an empty set never matches
+     * @return Delimiter The delimiter
+     */
+    static Delimiter anyOf(std::string_view characters);
+
+    /**
+     * @brief Find the next delimiter at or after a position
+     *
+     * @param input The text to search
+     * @param from Position to start searching at (at most input.size())
+     * @param length Receives the length of the delimiter found
+     * @return size_t Position of the delimiter, or std::string_view::npos
+     */
+    size_t find(std::string_view input, size_t from, size_t& length) const noexcept {
+        const char* const begin = input.data() + from;
+        const size_t remaining = input.size() - from;
+        switch (kind_) {
+            case Kind::CHARACTER: {
+                // memchr is vectorized by the C library
+                const void* hit = std::memchr(begin, character_, remaining);
+                length = 1;
+                return hit ? static_cast<size_t>(static_cast<const char*>(hit) - input.data())
+                           : std::string_view::npos;
+            }
+            case Kind::SEQUENCE: {
+                const char* cursor = begin;
+                const char* const last = input.data() + input.size();
+                length = text_.size();
+                while (static_cast<size_t>(last - cursor) >= text_.size()) {
+                    const void* hit =
+                        std::memchr(cursor, text_[0], static_cast<size_t>(last - cursor));
+                    if (!hit) {
+                        break;
+                    }
+                    cursor = static_cast<const char*>(hit);
+                    if (static_cast<size_t>(last - cursor) < text_.size()) {
+                        break;
+                    }
+                    if (std::memcmp(cursor + 1, text_.data() + 1, text_.size() - 1) == 0) {
+                        return static_cast<size_t>(cursor - input.data());
+                    }
+                    ++cursor;
+                }
+                return std::string_view::npos;
+            }
+            case Kind::ANY_OF:
+            default: {
+                length = 1;
+                // Tokens are usually short: look up the first bytes in the
+                // bitmap here, and leave longer scans to the vector kernels
+                const size_t head = remaining < kInlineScan ? remaining : kInlineScan;
+                for (size_t i = 0; i < head; ++i) {
+                    if (inSet(begin[i])) {
+                        return from + i;
+                    }
+                }
+                return head == remaining ? std::string_view::npos : findAnyOf(input, from + head);
+            }
+        }
+    }
+
+  private:
+    enum class Kind { CHARACTER, SEQUENCE, ANY_OF };
+
+    // Bytes of an ANY_OF search checked inline before calling findAnyOf()
+    static constexpr size_t kInlineScan = 16;
+
+    bool inSet(char character) const noexcept {
+        auto byte = static_cast<unsigned char>(character);
+        return (set_[byte >> 6] & (uint64_t{1} << (byte & 63))) != 0;
+    }
+
+    // ANY_OF search from @p from on: SIMD compares against each character of
+    // small sets when the CPU has them, the bitmap otherwise
+    size_t findAnyOf(std::string_view input, size_t from) const noexcept;
+
+    constexpr Delimiter(Kind kind, std::string_view text) noexcept
+        : kind_(kind), character_(text.empty() ? '\0' : text[0]), text_(text), set_() {}
+
+    Kind kind_;
+    char character_;
+    std::string_view text_;
+    std::array<uint64_t, 4> set_;  // Bitmap over byte values for ANY_OF
+};
+
+/**
+ * @brief Lazy range of the tokens of a string, as views into it
+ *
+ * Follows the same rules as split(): parts between delimiters are produced
+ * in order, including empty ones, except that an empty part after the last
+ * delimiter is not; an empty input has no tokens. Nothing is allocated.
+ */
+class TokenRange {
+  public:
+    class iterator {
+      public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = std::string_view;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const std::string_view*;
+        using reference = const std::string_view&;
+
+        iterator() noexcept = default;
+
+        reference operator*() const noexcept { return token_; }
+        pointer operator->() const noexcept { return &token_; }
+
+        iterator& operator++() noexcept {
+            start_ = next_;
+            load();
+            return *this;
+        }
+
+        iterator operator++(int) noexcept {
+            iterator previous = *this;
+            ++*this;
+            return previous;
+        }
+
+        bool operator==(const iterator& other) const noexcept { return start_ == other.start_; }
+        bool operator!=(const iterator& other) const noexcept { return start_ != other.start_; }
+
+      private:
+        friend class TokenRange;
+
+        iterator(const TokenRange* range, size_t start) noexcept : range_(range), start_(start) {
+            load();
+        }
+
+        void load() noexcept {
+            std::string_view input = range_->input_;
+            if (start_ >= input.size()) {
+                start_ = std::string_view::npos;
+                return;
+            }
+            size_t length = 0;
+            size_t position = range_->delimiter_.find(input, start_, length);
+            if (position == std::string_view::npos) {
+                token_ = input.substr(start_);
+                next_ = input.size();
+            } else {
+                token_ = input.substr(start_, position - start_);
+                next_ = position + length;
+            }
+        }
+
+        const TokenRange* range_ = nullptr;
+        size_t start_ = std::string_view::npos;
+        size_t next_ = std::string_view::npos;
+        std::string_view token_;
+    };
+
+    /**
+     * @brief Construct a new Token Range object
+     *
+     * @param input The text to tokenize; must outlive the range
+     * @param delimiter What separates tokens
+     */
+    TokenRange(std::string_view input, Delimiter delimiter) noexcept
+        : input_(input), delimiter_(delimiter) {}
+
+    iterator begin() const noexcept { return iterator(this, 0); }
+    iterator end() const noexcept { return iterator(); }
+
+  private:
+    std::string_view input_;
+    Delimiter delimiter_;
+};
+
+/**
+ * @brief Tokenize a string lazily
+ *
+ *     for (std::string_view field : tokens(line, ',')) { ... }
+ *     for (std::string_view field : tokens(line, Delimiter::sequence("::"))) { ... }
+ *     for (std::string_view field : tokens(line, Delimiter::anyOf(" \t"))) { ... }
+ *
+ * @param input The text to tokenize; must outlive the range
+ * @param delimiter What separates tokens
+ * @return TokenRange The tokens
+ */
+inline TokenRange tokens(std::string_view input, Delimiter delimiter) noexcept {
+    return TokenRange(input, delimiter);
+}
+
+/**
+ * @brief Token positions as (offset, length) pairs
+ */
+using TokenOffsets = std::vector<std::pair<uint32_t, uint32_t>>;
+
+/**
+ * @brief Tokenize a string into offsets, reusing the output's capacity
+ *
+ * Same tokens as tokens(), recorded as (offset, length) into @p input so the
+ * result stays meaningful if the text is moved or mapped again.
+ *
+ * @param input The text to tokenize; must be shorter than 4 GiB
+ * @param delimiter What separates tokens
+ * @param offsets Receives the token positions (previous contents are replaced)
+ * @return size_t The number of tokens
+ * @throws std::length_error if @p input does not fit 32-bit offsets
+ */
+size_t tokenOffsets(std::string_view input, const Delimiter& delimiter, TokenOffsets& offsets);
+
+}  // namespace string
+}  // namespace utils
+}  // namespace core
+}  // namespace cpp_template
@@ -0,0 +1,195 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#if defined(__x86_64__) || defined(_M_X64)
+    #if defined(_MSC_VER)
+        #include <intrin.h>
+    #else
+        #include <x86intrin.h>
+    #endif
+    #define CORE_TRACE_HAS_TSC 1
+#endif
+
+namespace cpp_template {
+namespace core {
+namespace trace {
+
+/**
+ * @brief Ring slots per thread; older zones are overwritten
+ *
+ * collect() returns at most kEventsPerThread - 1 zones per thread: the
+ * slot next in line for reuse may be mid-write and is skipped.
+ */
+constexpr size_t kEventsPerThread = 8192;
+
+/**
+ * @brief Finished threads whose uncollected zones are kept
+ *
+ * A finished thread's ring buffer is handed to a later thread once its
+ * zones were collected or cleared, after which they are no longer
+ * reported, so memory follows the number of threads alive at once rather
+ * than ever started. Beyond this many finished threads with unread zones,
+ * the oldest one's zones are dropped to make room.
+ */
+constexpr size_t kRetainedExitedThreads = 64;
+
+/**
+ * @brief A finished zone, with times converted to nanoseconds
+ */
+struct TraceEvent {
+    const char* name = nullptr;
+    uint32_t thread = 0;    // Order in which the thread first recorded a zone
+    uint64_t begin_ns = 0;  // Since the process started
+    uint64_t duration_ns = 0;
+};
+
+/**
+ * @brief Read the trace clock
+ *
+ * The time stamp counter on x86-64 (assumed invariant, as on every CPU of
+ * the last decade), steady_clock nanoseconds elsewhere. Ticks are
+ * converted to nanoseconds only when events are collected.
+ *
+ * @return uint64_t Clock ticks
+ */
+inline uint64_t now() noexcept {
+#if defined(CORE_TRACE_HAS_TSC)
+    return __rdtsc();
+#else
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                     std::chrono::steady_clock::now().time_since_epoch())
+                                     .count());
+#endif
+}
+
+namespace detail {
+
+extern std::atomic<bool> g_enabled;
+
+// Append a finished zone to the calling thread's ring buffer
+void record(const char* name, uint64_t begin, uint64_t end) noexcept;
+
+}  // namespace detail
+
+/**
+ * @brief Check if zones are being recorded
+ *
+ * @return true if recording is on (the default)
+ */
+inline bool enabled() noexcept {
+    return detail::g_enabled.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Turn recording on or off at runtime
+ *
+ * Zones already open when recording is turned off are still recorded.
+ *
+ * @param on Whether to record
+ */
+void setEnabled(bool on) noexcept;
+
+/**
+ * @brief Scoped timing zone
+ *
+ * Reads the clock on construction and again on destruction, then stores
+ * (name, begin, end) in a fixed-size ring buffer owned by the calling
+ * thread: no locks, no allocation after the thread's first zone. Usually
+ * created through CORE_TRACE_SCOPE so that it can be compiled out.
+ */
+class Zone {
+  public:
+    /**
+     * @brief Open a zone
+     *
+     * @param name Zone name; must have static storage duration (a literal)
+     */
+    explicit Zone(const char* name) noexcept : name_(enabled() ? name : nullptr), begin_(0) {
+        if (name_) {
+            begin_ = now();
+        }
+    }
+
+    /**
+     * @brief Close the zone and record it
+     */
+    ~Zone() {
+        if (name_) {
+            detail::record(name_, begin_, now());
+        }
+    }
+
+    Zone(const Zone&) = delete;
+    Zone& operator=(const Zone&) = delete;
+
+  private:
+    const char* name_;
+    uint64_t begin_;
+};
+
+/**
+ * @brief Gather the recorded zones of every thread, oldest first per thread
+ *
+ * Safe to call while other threads keep recording; zones that are being
+ * overwritten during the copy are left out.
+ *
+ * @return std::vector<TraceEvent> The events
+ */
+std::vector<TraceEvent> collect();
+
+/**
+ * @brief Forget every zone recorded so far
+ */
+void clear() noexcept;
+
+/**
+ * @brief Get the number of per-thread ring buffers allocated so far
+ *
+ * @return size_t Buffers, each kEventsPerThread slots; never shrinks
+ */
+size_t bufferCount() noexcept;
+
+/**
+ * @brief Write the recorded zones as Chrome trace event JSON
+ *
+ * The output loads in chrome://tracing and ui.perfetto.dev; every zone is
+ * a complete ("X") event on the thread that recorded it.
+ *
+ * @param out The stream to write to
+ */
+void writeChromeTrace(std::ostream& out);
+
+/**
+ * @brief Write the recorded zones as Chrome trace event JSON to a file
+ *
+ * @param path The output path
+ * @return true if the file was written
+ */
+bool writeChromeTrace(const std::string& path);
+
+}  // namespace trace
+}  // namespace core
+}  // namespace cpp_template
+
+#define CORE_TRACE_CONCAT_IMPL(a, b) a##b
+#define CORE_TRACE_CONCAT(a, b) CORE_TRACE_CONCAT_IMPL(a, b)
+
+/**
+ * @brief Time the rest of the enclosing scope as a zone named @p name
+ *
+ * Expands to nothing unless the build defines CORE_ENABLE_TRACING (CMake
+ * option CORE_ENABLE_TRACING).
+ */
+#if defined(CORE_ENABLE_TRACING)
+    #define CORE_TRACE_SCOPE(name) \
+        ::cpp_template::core::trace::Zone CORE_TRACE_CONCAT(core_trace_zone_, __LINE__)(name)
+#else
+    #define CORE_TRACE_SCOPE(name) static_cast<void>(0)
+#endif
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace cpp_template {
@@ -9,9 +10,16 @@ namespace utils {
 
 /**
  * @brief Utility functions for string manipulation
+ *
+ * Case conversion and the validation checks use the current C locale
+ * (std::toupper, std::isalnum, ...). Builds with CORE_ENABLE_SIMD instead map
+ * and classify pure-ASCII runs as the "C" locale does, 16 or 32 bytes at a
+ * time; only runs containing non-ASCII bytes still go through the locale.
  */
 namespace string {
 
+class StringBatch;
+
 /**
  * @brief Convert a string to uppercase
  *
@@ -40,12 +48,166 @@ std::vector<std::string> split(const std::string& input, char delimiter);
 /**
  * @brief Join a vector of strings with a delimiter
  *
+ * The exact final length is computed first and reserved once; to join
+ * numbers or other mixed values, use StringBuilder from core/string_builder.h.
+ *
  * @param strings The vector of strings to join
  * @param delimiter The delimiter string
  * @return std::string The joined string
  */
 std::string join(const std::vector<std::string>& strings, const std::string& delimiter);
 
+/**
+ * @brief Convert a string to uppercase without allocating a new string
+ *
+ * @param inout The string to convert in place
+ */
+void toUpperInPlace(std::string& inout);
+
+/**
+ * @brief Convert a string to lowercase without allocating a new string
+ *
+ * @param inout The string to convert in place
+ */
+void toLowerInPlace(std::string& inout);
+
+/**
+ * @brief Convert a character buffer to uppercase in place
+ *
+ * @param data The characters to convert
+ * @param length Number of characters
+ */
+void toUpperInPlace(char* data, size_t length);
+
+/**
+ * @brief Convert a character buffer to lowercase in place
+ *
+ * @param data The characters to convert
+ * @param length Number of characters
+ */
+void toLowerInPlace(char* data, size_t length);
+
+/**
+ * @brief Convert a string view to uppercase into a caller-owned buffer
+ *
+ * The previous contents of @p output are replaced; its capacity is reused.
+ *
+ * @param input The input string
+ * @param output The buffer receiving the uppercase version of the input
+ */
+void toUpper(std::string_view input, std::string& output);
+
+/**
+ * @brief Convert a string view to lowercase into a caller-owned buffer
+ *
+ * The previous contents of @p output are replaced; its capacity is reused.
+ *
+ * @param input The input string
+ * @param output The buffer receiving the lowercase version of the input
+ */
+void toLower(std::string_view input, std::string& output);
+
+/**
+ * @brief Split a string by a delimiter into views of the source
+ *
+ * Follows the same rules as split(): a trailing empty part after the last
+ * delimiter is not included. To avoid the vector entirely, iterate
+ * tokens() from core/tokenizer.h. The previous contents of @p output are
+ * replaced. The views remain valid only as long as @p input does.
+ *
+ * @param input The input string to split
+ * @param delimiter The delimiter character
+ * @param output Vector receiving views into @p input
+ * @return size_t The number of parts written to @p output
+ */
+size_t split(std::string_view input, char delimiter, std::vector<std::string_view>& output);
+
+/**
+ * @brief Join strings with a delimiter, appending to a caller-owned buffer
+ *
+ * The final length is computed up front so @p output grows at most once.
+ *
+ * @param strings The strings to join
+ * @param delimiter The delimiter string
+ * @param output The buffer the joined string is appended to
+ */
+void join(const std::vector<std::string_view>& strings, std::string_view delimiter,
+          std::string& output);
+
+/**
+ * @brief Join strings with a delimiter, appending to a caller-owned buffer
+ *
+ * @param strings The strings to join
+ * @param delimiter The delimiter string
+ * @param output The buffer the joined string is appended to
+ */
+void join(const std::vector<std::string>& strings, std::string_view delimiter,
+          std::string& output);
+
+/**
+ * @brief Convert every string of a batch to uppercase in place
+ *
+ * Case mapping works byte by byte, so the whole byte buffer is converted
+ * in one sequential pass regardless of string boundaries.
+ *
+ * @param batch The batch to modify
+ */
+void toUpperInPlace(StringBatch& batch);
+
+/**
+ * @brief Convert every string of a batch to lowercase in place
+ *
+ * @param batch The batch to modify
+ */
+void toLowerInPlace(StringBatch& batch);
+
+/**
+ * @brief Convert every string of a batch to uppercase into another batch
+ *
+ * @param input The input batch
+ * @param output The batch receiving the result; its buffers are reused
+ */
+void toUpper(const StringBatch& input, StringBatch& output);
+
+/**
+ * @brief Convert every string of a batch to lowercase into another batch
+ *
+ * @param input The input batch
+ * @param output The batch receiving the result; its buffers are reused
+ */
+void toLower(const StringBatch& input, StringBatch& output);
+
+/**
+ * @brief Strip leading and trailing characters from every string of a batch
+ *
+ * @param input The input batch
+ * @param output The batch receiving the trimmed strings, row for row; may be @p input
+ * @param characters The characters to strip
+ */
+void trim(const StringBatch& input, StringBatch& output,
+          std::string_view characters = " \t\n\r");
+
+/**
+ * @brief Split a string by a delimiter into a batch
+ *
+ * Same rules as split(); the previous contents of @p output are replaced.
+ *
+ * @param input The input string to split
+ * @param delimiter The delimiter character
+ * @param output The batch receiving copies of the parts
+ * @return size_t The number of parts
+ */
+size_t split(std::string_view input, char delimiter, StringBatch& output);
+
+/**
+ * @brief Join the strings of a batch with a delimiter, appending to a buffer
+ *
+ * @param strings The batch to join
+ * @param delimiter The delimiter string
+ * @param output The buffer the joined string is appended to
+ */
+void join(const StringBatch& strings, std::string_view delimiter, std::string& output);
+
 }  // namespace string
 
 /**
@@ -56,6 +218,9 @@ namespace validation {
 /**
  * @brief Check if a string is empty or contains only whitespace
  *
+ * Locale-aware, except for ASCII runs in CORE_ENABLE_SIMD builds (see the
+ * string namespace notes).
+ *
  * @param input The string to check
  * @return true if the string is empty or whitespace-only
  * @return false otherwise
@@ -65,12 +230,39 @@ bool isEmpty(const std::string& input);
 /**
  * @brief Validate that a string contains only alphanumeric characters
  *
+ * Locale-aware, except for ASCII runs in CORE_ENABLE_SIMD builds (see the
+ * string namespace notes).
+ *
  * @param input The string to validate
  * @return true if the string is alphanumeric
  * @return false otherwise
  */
 bool isAlphanumeric(const std::string& input);
 
+/**
+ * @brief Validate an email address format
+ *
+ * Accepts exactly the language of the pattern
+ * `^[a-zA-Z0-9._%+-]+@[a-zA-Z0-9.-]+\.[a-zA-Z]{2,}$` using a single pass over
+ * the input. No regex is built and nothing is allocated.
+ *
+ * @param email The email string to validate
+ * @return true if the email format is valid
+ * @return false otherwise
+ */
+bool isValidEmail(std::string_view email) noexcept;
+
+/**
+ * @brief Validate a batch of email addresses
+ *
+ * @param emails The addresses to validate
+ * @param results Receives one flag (1 = valid) per address; resized to
+ *                emails.size(), so it does not allocate once its capacity suffices
+ * @return size_t The number of valid addresses
+ */
+size_t validateEmails(const std::vector<std::string_view>& emails,
+                      std::vector<unsigned char>& results);
+
 }  // namespace validation
 
 }  // namespace utils
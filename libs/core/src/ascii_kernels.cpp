@@ -0,0 +1,458 @@
+#include "ascii_kernels.h"
+#include <cctype>
+
+#if defined(CORE_ENABLE_SIMD)
+    #if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+        #define CORE_ASCII_SSE2 1
+        #include <immintrin.h>
+        #if defined(_MSC_VER)
+            #include <intrin.h>
+            #define CORE_ASCII_AVX2 1
+            #define CORE_TARGET_AVX2
+        #elif defined(__GNUC__) || defined(__clang__)
+            #define CORE_ASCII_AVX2 1
+            #define CORE_TARGET_AVX2 __attribute__((target("avx2")))
+        #endif
+    #elif defined(__aarch64__) || defined(_M_ARM64)
+        #define CORE_ASCII_NEON 1
+        #include <arm_neon.h>
+    #endif
+#endif
+
+namespace cpp_template {
+namespace core {
+namespace utils {
+namespace detail {
+
+namespace {
+
+// Portable scalar kernels, identical to the original std::transform/std::all_of code
+
+void scalarToUpper(char* data, size_t size) {
+    for (size_t i = 0; i < size; ++i) {
+        data[i] = static_cast<char>(std::toupper(static_cast<unsigned char>(data[i])));
+    }
+}
+
+void scalarToLower(char* data, size_t size) {
+    for (size_t i = 0; i < size; ++i) {
+        data[i] = static_cast<char>(std::tolower(static_cast<unsigned char>(data[i])));
+    }
+}
+
+bool scalarAllAlnum(const char* data, size_t size) {
+    for (size_t i = 0; i < size; ++i) {
+        if (!std::isalnum(static_cast<unsigned char>(data[i]))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool scalarAllSpace(const char* data, size_t size) {
+    for (size_t i = 0; i < size; ++i) {
+        if (!std::isspace(static_cast<unsigned char>(data[i]))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+constexpr AsciiKernels kScalarKernels = {"scalar", scalarToUpper, scalarToLower, scalarAllAlnum,
+                                         scalarAllSpace, nullptr};
+
+#if defined(CORE_ASCII_SSE2) || defined(CORE_ASCII_NEON)
+
+// Tail handling for the vector kernels: ASCII bytes take a branch-light path,
+// anything else goes through the locale-aware scalar function.
+
+inline bool isAscii(unsigned char c) {
+    return c < 0x80;
+}
+
+void tailToUpper(char* data, size_t size) {
+    for (size_t i = 0; i < size; ++i) {
+        unsigned char c = static_cast<unsigned char>(data[i]);
+        if (!isAscii(c)) {
+            scalarToUpper(data + i, 1);
+        } else if (static_cast<unsigned char>(c - 'a') < 26) {
+            data[i] = static_cast<char>(c ^ 0x20);
+        }
+    }
+}
+
+void tailToLower(char* data, size_t size) {
+    for (size_t i = 0; i < size; ++i) {
+        unsigned char c = static_cast<unsigned char>(data[i]);
+        if (!isAscii(c)) {
+            scalarToLower(data + i, 1);
+        } else if (static_cast<unsigned char>(c - 'A') < 26) {
+            data[i] = static_cast<char>(c ^ 0x20);
+        }
+    }
+}
+
+size_t tailFindAny(const char* data, size_t size, const char* set, size_t count) {
+    for (size_t i = 0; i < size; ++i) {
+        for (size_t k = 0; k < count; ++k) {
+            if (data[i] == set[k]) {
+                return i;
+            }
+        }
+    }
+    return size;
+}
+
+#endif
+
+#if defined(CORE_ASCII_SSE2)
+
+// SSE2 kernels (16 bytes per iteration)
+
+inline __m128i sse2InRange(__m128i v, char first, char last) {
+    const __m128i lo = _mm_set1_epi8(static_cast<char>(first - 1));
+    const __m128i hi = _mm_set1_epi8(static_cast<char>(last + 1));
+    return _mm_and_si128(_mm_cmpgt_epi8(v, lo), _mm_cmplt_epi8(v, hi));
+}
+
+inline void sse2CaseMap(char* data, size_t size, char first, char last,
+                        void (*scalar)(char*, size_t), void (*tail)(char*, size_t)) {
+    const __m128i flip = _mm_set1_epi8(0x20);
+    size_t i = 0;
+    for (; i + 16 <= size; i += 16) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        if (_mm_movemask_epi8(v) != 0) {
+            scalar(data + i, 16);
+            continue;
+        }
+        v = _mm_xor_si128(v, _mm_and_si128(sse2InRange(v, first, last), flip));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(data + i), v);
+    }
+    tail(data + i, size - i);
+}
+
+inline int sse2AlnumMask(__m128i v) {
+    const __m128i folded = _mm_or_si128(v, _mm_set1_epi8(0x20));
+    return _mm_movemask_epi8(_mm_or_si128(sse2InRange(v, '0', '9'), sse2InRange(folded, 'a', 'z')));
+}
+
+inline int sse2SpaceMask(__m128i v) {
+    const __m128i blank = _mm_cmpeq_epi8(v, _mm_set1_epi8(' '));
+    return _mm_movemask_epi8(_mm_or_si128(blank, sse2InRange(v, '\t', '\r')));
+}
+
+void sse2ToUpper(char* data, size_t size) {
+    sse2CaseMap(data, size, 'a', 'z', scalarToUpper, tailToUpper);
+}
+
+void sse2ToLower(char* data, size_t size) {
+    sse2CaseMap(data, size, 'A', 'Z', scalarToLower, tailToLower);
+}
+
+bool sse2AllAlnum(const char* data, size_t size) {
+    size_t i = 0;
+    for (; i + 16 <= size; i += 16) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        if (_mm_movemask_epi8(v) != 0) {
+            if (!scalarAllAlnum(data + i, 16)) {
+                return false;
+            }
+        } else if (sse2AlnumMask(v) != 0xFFFF) {
+            return false;
+        }
+    }
+    return scalarAllAlnum(data + i, size - i);
+}
+
+bool sse2AllSpace(const char* data, size_t size) {
+    size_t i = 0;
+    for (; i + 16 <= size; i += 16) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        if (_mm_movemask_epi8(v) != 0) {
+            if (!scalarAllSpace(data + i, 16)) {
+                return false;
+            }
+        } else if (sse2SpaceMask(v) != 0xFFFF) {
+            return false;
+        }
+    }
+    return scalarAllSpace(data + i, size - i);
+}
+
+inline unsigned lowestSetBit(unsigned mask) {
+    #if defined(_MSC_VER)
+    unsigned long index = 0;
+    _BitScanForward(&index, mask);
+    return static_cast<unsigned>(index);
+    #else
+    return static_cast<unsigned>(__builtin_ctz(mask));
+    #endif
+}
+
+size_t sse2FindAny(const char* data, size_t size, const char* set, size_t count) {
+    __m128i needles[kMaxFindAnySet];
+    for (size_t k = 0; k < count; ++k) {
+        needles[k] = _mm_set1_epi8(set[k]);
+    }
+    size_t i = 0;
+    for (; i + 16 <= size; i += 16) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        __m128i hit = _mm_cmpeq_epi8(v, needles[0]);
+        for (size_t k = 1; k < count; ++k) {
+            hit = _mm_or_si128(hit, _mm_cmpeq_epi8(v, needles[k]));
+        }
+        if (int mask = _mm_movemask_epi8(hit)) {
+            return i + lowestSetBit(static_cast<unsigned>(mask));
+        }
+    }
+    return i + tailFindAny(data + i, size - i, set, count);
+}
+
+constexpr AsciiKernels kSse2Kernels = {"sse2", sse2ToUpper, sse2ToLower, sse2AllAlnum,
+                                       sse2AllSpace, sse2FindAny};
+
+#endif  // CORE_ASCII_SSE2
+
+#if defined(CORE_ASCII_AVX2)
+
+// AVX2 kernels (32 bytes per iteration), remainder handled by SSE2
+
+CORE_TARGET_AVX2 inline __m256i avx2InRange(__m256i v, char first, char last) {
+    const __m256i lo = _mm256_set1_epi8(static_cast<char>(first - 1));
+    const __m256i hi = _mm256_set1_epi8(static_cast<char>(last + 1));
+    return _mm256_and_si256(_mm256_cmpgt_epi8(v, lo), _mm256_cmpgt_epi8(hi, v));
+}
+
+CORE_TARGET_AVX2 inline size_t avx2CaseMap(char* data, size_t size, char first, char last,
+                                           void (*scalar)(char*, size_t)) {
+    const __m256i flip = _mm256_set1_epi8(0x20);
+    size_t i = 0;
+    for (; i + 32 <= size; i += 32) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        if (_mm256_movemask_epi8(v) != 0) {
+            scalar(data + i, 32);
+            continue;
+        }
+        v = _mm256_xor_si256(v, _mm256_and_si256(avx2InRange(v, first, last), flip));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(data + i), v);
+    }
+    return i;
+}
+
+CORE_TARGET_AVX2 void avx2ToUpper(char* data, size_t size) {
+    size_t done = avx2CaseMap(data, size, 'a', 'z', scalarToUpper);
+    sse2ToUpper(data + done, size - done);
+}
+
+CORE_TARGET_AVX2 void avx2ToLower(char* data, size_t size) {
+    size_t done = avx2CaseMap(data, size, 'A', 'Z', scalarToLower);
+    sse2ToLower(data + done, size - done);
+}
+
+CORE_TARGET_AVX2 bool avx2AllAlnum(const char* data, size_t size) {
+    size_t i = 0;
+    for (; i + 32 <= size; i += 32) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        if (_mm256_movemask_epi8(v) != 0) {
+            if (!scalarAllAlnum(data + i, 32)) {
+                return false;
+            }
+            continue;
+        }
+        const __m256i folded = _mm256_or_si256(v, _mm256_set1_epi8(0x20));
+        const __m256i ok = _mm256_or_si256(avx2InRange(v, '0', '9'), avx2InRange(folded, 'a', 'z'));
+        if (_mm256_movemask_epi8(ok) != -1) {
+            return false;
+        }
+    }
+    return sse2AllAlnum(data + i, size - i);
+}
+
+CORE_TARGET_AVX2 bool avx2AllSpace(const char* data, size_t size) {
+    size_t i = 0;
+    for (; i + 32 <= size; i += 32) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        if (_mm256_movemask_epi8(v) != 0) {
+            if (!scalarAllSpace(data + i, 32)) {
+                return false;
+            }
+            continue;
+        }
+        const __m256i blank = _mm256_cmpeq_epi8(v, _mm256_set1_epi8(' '));
+        if (_mm256_movemask_epi8(_mm256_or_si256(blank, avx2InRange(v, '\t', '\r'))) != -1) {
+            return false;
+        }
+    }
+    return sse2AllSpace(data + i, size - i);
+}
+
+CORE_TARGET_AVX2 size_t avx2FindAny(const char* data, size_t size, const char* set,
+                                    size_t count) {
+    __m256i needles[kMaxFindAnySet];
+    for (size_t k = 0; k < count; ++k) {
+        needles[k] = _mm256_set1_epi8(set[k]);
+    }
+    size_t i = 0;
+    for (; i + 32 <= size; i += 32) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        __m256i hit = _mm256_cmpeq_epi8(v, needles[0]);
+        for (size_t k = 1; k < count; ++k) {
+            hit = _mm256_or_si256(hit, _mm256_cmpeq_epi8(v, needles[k]));
+        }
+        if (int mask = _mm256_movemask_epi8(hit)) {
+            return i + lowestSetBit(static_cast<unsigned>(mask));
+        }
+    }
+    return i + sse2FindAny(data + i, size - i, set, count);
+}
+
+constexpr AsciiKernels kAvx2Kernels = {"avx2", avx2ToUpper, avx2ToLower, avx2AllAlnum,
+                                       avx2AllSpace, avx2FindAny};
+
+bool cpuHasAvx2() {
+    #if defined(_MSC_VER)
+    int info[4] = {0, 0, 0, 0};
+    __cpuid(info, 0);
+    if (info[0] < 7) {
+        return false;
+    }
+    __cpuid(info, 1);
+    const bool osxsave = (info[2] & (1 << 27)) != 0;
+    const bool avx = (info[2] & (1 << 28)) != 0;
+    if (!osxsave || !avx || (_xgetbv(0) & 0x6) != 0x6) {
+        return false;
+    }
+    __cpuidex(info, 7, 0);
+    return (info[1] & (1 << 5)) != 0;
+    #else
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2");
+    #endif
+}
+
+#endif  // CORE_ASCII_AVX2
+
+#if defined(CORE_ASCII_NEON)
+
+// NEON kernels (16 bytes per iteration)
+
+inline uint8x16_t neonInRange(uint8x16_t v, char first, char last) {
+    return vandq_u8(vcgeq_u8(v, vdupq_n_u8(static_cast<uint8_t>(first))),
+                    vcleq_u8(v, vdupq_n_u8(static_cast<uint8_t>(last))));
+}
+
+inline void neonCaseMap(char* data, size_t size, char first, char last,
+                        void (*scalar)(char*, size_t), void (*tail)(char*, size_t)) {
+    const uint8x16_t flip = vdupq_n_u8(0x20);
+    size_t i = 0;
+    for (; i + 16 <= size; i += 16) {
+        uint8_t* p = reinterpret_cast<uint8_t*>(data + i);
+        uint8x16_t v = vld1q_u8(p);
+        if (vmaxvq_u8(v) >= 0x80) {
+            scalar(data + i, 16);
+            continue;
+        }
+        vst1q_u8(p, veorq_u8(v, vandq_u8(neonInRange(v, first, last), flip)));
+    }
+    tail(data + i, size - i);
+}
+
+void neonToUpper(char* data, size_t size) {
+    neonCaseMap(data, size, 'a', 'z', scalarToUpper, tailToUpper);
+}
+
+void neonToLower(char* data, size_t size) {
+    neonCaseMap(data, size, 'A', 'Z', scalarToLower, tailToLower);
+}
+
+bool neonAllAlnum(const char* data, size_t size) {
+    size_t i = 0;
+    for (; i + 16 <= size; i += 16) {
+        uint8x16_t v = vld1q_u8(reinterpret_cast<const uint8_t*>(data + i));
+        if (vmaxvq_u8(v) >= 0x80) {
+            if (!scalarAllAlnum(data + i, 16)) {
+                return false;
+            }
+            continue;
+        }
+        const uint8x16_t folded = vorrq_u8(v, vdupq_n_u8(0x20));
+        if (vminvq_u8(vorrq_u8(neonInRange(v, '0', '9'), neonInRange(folded, 'a', 'z'))) != 0xFF) {
+            return false;
+        }
+    }
+    return scalarAllAlnum(data + i, size - i);
+}
+
+bool neonAllSpace(const char* data, size_t size) {
+    size_t i = 0;
+    for (; i + 16 <= size; i += 16) {
+        uint8x16_t v = vld1q_u8(reinterpret_cast<const uint8_t*>(data + i));
+        if (vmaxvq_u8(v) >= 0x80) {
+            if (!scalarAllSpace(data + i, 16)) {
+                return false;
+            }
+            continue;
+        }
+        const uint8x16_t blank = vceqq_u8(v, vdupq_n_u8(' '));
+        if (vminvq_u8(vorrq_u8(blank, neonInRange(v, '\t', '\r'))) != 0xFF) {
+            return false;
+        }
+    }
+    return scalarAllSpace(data + i, size - i);
+}
+
+size_t neonFindAny(const char* data, size_t size, const char* set, size_t count) {
+    uint8x16_t needles[kMaxFindAnySet];
+    for (size_t k = 0; k < count; ++k) {
+        needles[k] = vdupq_n_u8(static_cast<uint8_t>(set[k]));
+    }
+    size_t i = 0;
+    for (; i + 16 <= size; i += 16) {
+        uint8x16_t v = vld1q_u8(reinterpret_cast<const uint8_t*>(data + i));
+        uint8x16_t hit = vceqq_u8(v, needles[0]);
+        for (size_t k = 1; k < count; ++k) {
+            hit = vorrq_u8(hit, vceqq_u8(v, needles[k]));
+        }
+        if (vmaxvq_u8(hit) != 0) {
+            // NEON has no movemask; locate the byte in the block
+            return i + tailFindAny(data + i, 16, set, count);
+        }
+    }
+    return i + tailFindAny(data + i, size - i, set, count);
+}
+
+constexpr AsciiKernels kNeonKernels = {"neon", neonToUpper, neonToLower, neonAllAlnum,
+                                       neonAllSpace, neonFindAny};
+
+#endif  // CORE_ASCII_NEON
+
+const AsciiKernels& selectKernels() noexcept {
+#if defined(CORE_ASCII_AVX2)
+    if (cpuHasAvx2()) {
+        return kAvx2Kernels;
+    }
+#endif
+#if defined(CORE_ASCII_SSE2)
+    return kSse2Kernels;
+#elif defined(CORE_ASCII_NEON)
+    return kNeonKernels;
+#else
+    return kScalarKernels;
+#endif
+}
+
+}  // namespace
+
+const AsciiKernels& asciiKernels() noexcept {
+    static const AsciiKernels& selected = selectKernels();
+    return selected;
+}
+
+const AsciiKernels& scalarAsciiKernels() noexcept {
+    return kScalarKernels;
+}
+
+}  // namespace detail
+}  // namespace utils
+}  // namespace core
+}  // namespace cpp_template
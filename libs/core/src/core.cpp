@@ -1,5 +1,8 @@
 #include "core/core.h"
+#include <cstring>
 #include <stdexcept>
+#include "core/memory_tracking.h"
+#include "core/trace.h"
 #include "core/utils.h"
 
 namespace cpp_template {
@@ -23,6 +26,8 @@ void Core::setName(const std::string& name) {
 }
 
 std::string Core::process(const std::string& input) const {
+    CORE_TRACE_SCOPE("Core::process");
+    CORE_MEMORY_SCOPE(CORE);
     if (!initialized_) {
         throw std::runtime_error("Core must be initialized before processing");
     }
@@ -32,6 +37,42 @@ std::string Core::process(const std::string& input) const {
     return "[" + name_ + "] " + processed;
 }
 
+void Core::processMany(const std::string_view* inputs, size_t count,
+                       const ProcessedSink& sink) const {
+    CORE_TRACE_SCOPE("Core::processMany");
+    CORE_MEMORY_SCOPE(CORE);
+    if (!initialized_) {
+        throw std::runtime_error("Core must be initialized before processing");
+    }
+
+    const std::string prefix = "[" + name_ + "] ";
+    size_t total = prefix.size() * count;
+    for (size_t i = 0; i < count; ++i) {
+        total += inputs[i].size();
+    }
+
+    // Results never move once written, so the sink can be called as we go
+    std::string buffer(total, '\0');
+    char* cursor = buffer.data();
+    for (size_t i = 0; i < count; ++i) {
+        const std::string_view input = inputs[i];
+        char* result = cursor;
+        std::memcpy(cursor, prefix.data(), prefix.size());
+        cursor += prefix.size();
+        if (!input.empty()) {
+            std::memcpy(cursor, input.data(), input.size());
+            utils::string::toUpperInPlace(cursor, input.size());
+            cursor += input.size();
+        }
+        sink(std::string_view(result, static_cast<size_t>(cursor - result)));
+    }
+}
+
+void Core::processMany(const std::vector<std::string_view>& inputs,
+                       const ProcessedSink& sink) const {
+    processMany(inputs.data(), inputs.size(), sink);
+}
+
 bool Core::initialize() {
     if (initialized_) {
         return true;  // Already initialized
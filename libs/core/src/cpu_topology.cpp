@@ -0,0 +1,79 @@
+#include "core/cpu_topology.h"
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+
+namespace cpp_template {
+namespace core {
+
+namespace {
+
+// Longest range accepted in a CPU list; guards against absurd input
+constexpr uint32_t kMaxCpuRange = 1u << 16;
+
+}  // namespace
+
+size_t CpuTopology::concurrency() const noexcept {
+    size_t count = allowed_cpus.size();
+    if (cpu_quota > 0.0) {
+        // A quota of 1.5 CPUs still keeps two threads busy part of the time
+        size_t quota = static_cast<size_t>(std::ceil(cpu_quota));
+        count = count == 0 ? quota : std::min(count, quota);
+    }
+    return std::max<size_t>(count, 1);
+}
+
+const CpuTopology& cpuTopology() {
+    static const CpuTopology topology = detectCpuTopology();
+    return topology;
+}
+
+size_t effectiveConcurrency() {
+    return cpuTopology().concurrency();
+}
+
+std::vector<uint32_t> parseCpuList(std::string_view text) {
+    auto is_space = [](char c) { return c == ' ' || c == '\t' || c == '\n' || c == '\r'; };
+    while (!text.empty() && is_space(text.front())) {
+        text.remove_prefix(1);
+    }
+    while (!text.empty() && is_space(text.back())) {
+        text.remove_suffix(1);
+    }
+
+    std::vector<uint32_t> cpus;
+    const char* cursor = text.data();
+    const char* end = text.data() + text.size();
+    while (cursor < end) {
+        uint32_t first = 0;
+        auto parsed = std::from_chars(cursor, end, first);
+        if (parsed.ec != std::errc()) {
+            return {};
+        }
+        uint32_t last = first;
+        cursor = parsed.ptr;
+        if (cursor < end && *cursor == '-') {
+            parsed = std::from_chars(cursor + 1, end, last);
+            if (parsed.ec != std::errc() || last < first || last - first > kMaxCpuRange) {
+                return {};
+            }
+            cursor = parsed.ptr;
+        }
+        for (uint64_t cpu = first; cpu <= last; ++cpu) {
+            cpus.push_back(static_cast<uint32_t>(cpu));
+        }
+        if (cursor < end) {
+            if (*cursor != ',') {
+                return {};
+            }
+            ++cursor;
+        }
+    }
+
+    std::sort(cpus.begin(), cpus.end());
+    cpus.erase(std::unique(cpus.begin(), cpus.end()), cpus.end());
+    return cpus;
+}
+
+}  // namespace core
+}  // namespace cpp_template
@@ -0,0 +1,162 @@
+#include "core/file_writer.h"
+#include <algorithm>
+#include <cstring>
+
+#if defined(_WIN32)
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <windows.h>
+#else
+    #include <cerrno>
+    #include <fcntl.h>
+    #include <sys/uio.h>
+    #include <unistd.h>
+#endif
+
+namespace cpp_template {
+namespace core {
+
+FileWriter::FileWriter(size_t buffer_size) : buffer_(std::max<size_t>(buffer_size, 1)) {}
+
+FileWriter::~FileWriter() {
+    close();
+}
+
+bool FileWriter::write(std::string_view data) {
+    if (!isOpen() || failed_) {
+        return false;
+    }
+    bytes_written_ += data.size();
+    if (data.size() <= buffer_.size() - used_) {
+        std::memcpy(buffer_.data() + used_, data.data(), data.size());
+        used_ += data.size();
+        return true;
+    }
+    if (data.size() < buffer_.size()) {
+        // Top the buffer up so every system call carries a full buffer
+        size_t head = buffer_.size() - used_;
+        std::memcpy(buffer_.data() + used_, data.data(), head);
+        used_ = buffer_.size();
+        if (!writeOut({})) {
+            return false;
+        }
+        data.remove_prefix(head);
+        std::memcpy(buffer_.data(), data.data(), data.size());
+        used_ = data.size();
+        return true;
+    }
+    return writeOut(data);
+}
+
+bool FileWriter::flush() {
+    if (!isOpen() || failed_) {
+        return false;
+    }
+    return used_ == 0 || writeOut({});
+}
+
+bool FileWriter::close() {
+    if (!isOpen()) {
+        return false;
+    }
+    bool ok = flush();
+#if defined(_WIN32)
+    ok = CloseHandle(static_cast<HANDLE>(handle_)) && ok;
+    handle_ = nullptr;
+#else
+    ok = ::close(fd_) == 0 && ok;
+    fd_ = -1;
+#endif
+    used_ = 0;
+    failed_ = false;
+    return ok;
+}
+
+#if defined(_WIN32)
+
+bool FileWriter::open(const std::string& path) {
+    close();
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS,
+                              FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+    handle_ = file;
+    bytes_written_ = 0;
+    return true;
+}
+
+bool FileWriter::isOpen() const noexcept {
+    return handle_ != nullptr;
+}
+
+bool FileWriter::writeOut(std::string_view extra) {
+    // No vectored equivalent for ordinary handles: two writes
+    std::string_view parts[] = {std::string_view(buffer_.data(), used_), extra};
+    for (std::string_view part : parts) {
+        while (!part.empty()) {
+            DWORD chunk = static_cast<DWORD>(std::min<size_t>(part.size(), 1u << 30));
+            DWORD written = 0;
+            if (!WriteFile(static_cast<HANDLE>(handle_), part.data(), chunk, &written, nullptr)) {
+                failed_ = true;
+                return false;
+            }
+            part.remove_prefix(written);
+        }
+    }
+    used_ = 0;
+    return true;
+}
+
+#else
+
+bool FileWriter::open(const std::string& path) {
+    close();
+    int fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd < 0) {
+        return false;
+    }
+    fd_ = fd;
+    bytes_written_ = 0;
+    return true;
+}
+
+bool FileWriter::isOpen() const noexcept {
+    return fd_ >= 0;
+}
+
+bool FileWriter::writeOut(std::string_view extra) {
+    iovec parts[2] = {{buffer_.data(), used_},
+                      {const_cast<char*>(extra.data()), extra.size()}};
+    iovec* pending = parts;
+    int count = extra.empty() ? 1 : 2;
+    while (count > 0) {
+        ssize_t written = ::writev(fd_, pending, count);
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            failed_ = true;
+            return false;
+        }
+        // Skip what went out, resuming partial writes mid-part
+        auto remaining = static_cast<size_t>(written);
+        while (count > 0 && remaining >= pending->iov_len) {
+            remaining -= pending->iov_len;
+            ++pending;
+            --count;
+        }
+        if (count > 0) {
+            pending->iov_base = static_cast<char*>(pending->iov_base) + remaining;
+            pending->iov_len -= remaining;
+        }
+    }
+    used_ = 0;
+    return true;
+}
+
+#endif
+
+}  // namespace core
+}  // namespace cpp_template
@@ -0,0 +1,56 @@
+#pragma once
+
+/**
+ * @file ascii_kernels.h
+ * @brief Internal dispatch table for ASCII case conversion, classification and delimiter search
+ *
+ * The kernels process 16 (SSE2/NEON) or 32 (AVX2) bytes per iteration. Any
+ * block that contains a non-ASCII byte is handed to the locale-aware scalar
+ * code, so results match the std::toupper/std::isalnum based implementation.
+ * The best available kernel set is chosen once at runtime.
+ */
+
+#include <cstddef>
+
+namespace cpp_template {
+namespace core {
+namespace utils {
+namespace detail {
+
+/**
+ * @brief Largest character set find_any() accepts; one compare per character and block
+ */
+constexpr size_t kMaxFindAnySet = 8;
+
+/**
+ * @brief Function table for one instruction set
+ */
+struct AsciiKernels {
+    const char* name;
+    void (*to_upper)(char* data, size_t size);
+    void (*to_lower)(char* data, size_t size);
+    bool (*all_alnum)(const char* data, size_t size);
+    bool (*all_space)(const char* data, size_t size);
+    // Position of the first byte equal to one of set[0..count), 0 < count <= kMaxFindAnySet, or
+    // size if there is none; null for the scalar set, where a bitmap lookup is as fast
+    size_t (*find_any)(const char* data, size_t size, const char* set, size_t count);
+};
+
+/**
+ * @brief Get the kernel set selected for the running CPU
+ *
+ * @return const AsciiKernels& The active kernel table
+ */
+const AsciiKernels& asciiKernels() noexcept;
+
+/**
+ * @brief Get the portable scalar kernel set
+ *
+ * @return const AsciiKernels& The scalar kernel table
+ */
+const AsciiKernels& scalarAsciiKernels() noexcept;
+
+}  // namespace detail
+}  // namespace utils
+}  // namespace core
+}  // namespace cpp_template
@@ -0,0 +1,174 @@
+/**
+ * @file memory_hooks.cpp
+ * @brief Counting replacements of the global operator new and delete
+ *
+ * Built as the core-memory-hooks object library; linking it into an
+ * executable turns on the counters of core/memory_tracking.h. Every block
+ * gets a small header in front of it recording its size and the subsystem
+ * it was charged to, so that deletes, sized or not, are charged back
+ * exactly, and so that blocks allocated while counting was paused are
+ * never charged. Memory comes from malloc; over-aligned requests are
+ * aligned by hand inside a larger block.
+ */
+
+#include <core/memory_tracking.h>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+namespace {
+
+using cpp_template::core::memory::Subsystem;
+namespace detail = cpp_template::core::memory::detail;
+
+struct alignas(alignof(std::max_align_t)) BlockHeader {
+    size_t size;
+    uint32_t offset;  // From the start of the malloc block to the user pointer
+    Subsystem subsystem;
+};
+
+constexpr size_t kHeaderSize = sizeof(BlockHeader);
+
+BlockHeader* headerOf(void* pointer) noexcept {
+    return reinterpret_cast<BlockHeader*>(static_cast<char*>(pointer) - kHeaderSize);
+}
+
+void* tryAllocate(size_t size, size_t alignment) noexcept {
+    if (alignment < alignof(BlockHeader)) {
+        alignment = alignof(BlockHeader);
+    }
+    size_t slack = alignment > alignof(BlockHeader) ? alignment : 0;
+    if (size > SIZE_MAX - kHeaderSize - slack) {
+        return nullptr;
+    }
+    void* block = std::malloc(size + kHeaderSize + slack);
+    if (!block) {
+        return nullptr;
+    }
+    auto start = reinterpret_cast<uintptr_t>(block);
+    uintptr_t user = (start + kHeaderSize + alignment - 1) & ~(uintptr_t{alignment} - 1);
+
+    BlockHeader* header = headerOf(reinterpret_cast<void*>(user));
+    header->size = size;
+    header->offset = static_cast<uint32_t>(user - start);
+    header->subsystem = detail::recordAllocation(size);
+    return reinterpret_cast<void*>(user);
+}
+
+void* allocate(size_t size, size_t alignment) {
+    for (;;) {
+        if (void* pointer = tryAllocate(size, alignment)) {
+            return pointer;
+        }
+        std::new_handler handler = std::get_new_handler();
+        if (!handler) {
+            throw std::bad_alloc();
+        }
+        handler();
+    }
+}
+
+void* allocateNoThrow(size_t size, size_t alignment) noexcept {
+    try {
+        return allocate(size, alignment);
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+void release(void* pointer) noexcept {
+    if (!pointer) {
+        return;
+    }
+    BlockHeader* header = headerOf(pointer);
+    detail::recordDeallocation(header->subsystem, header->size);
+    std::free(static_cast<char*>(pointer) - header->offset);
+}
+
+constexpr size_t kDefaultAlignment = alignof(std::max_align_t);
+
+// Lets trackingActive() tell that the replacements below are in use
+const bool g_linked = (detail::markHooksLinked(), true);
+
+}  // namespace
+
+void* operator new(size_t size) {
+    return allocate(size, kDefaultAlignment);
+}
+
+void* operator new[](size_t size) {
+    return allocate(size, kDefaultAlignment);
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+    return allocateNoThrow(size, kDefaultAlignment);
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept {
+    return allocateNoThrow(size, kDefaultAlignment);
+}
+
+void* operator new(size_t size, std::align_val_t alignment) {
+    return allocate(size, static_cast<size_t>(alignment));
+}
+
+void* operator new[](size_t size, std::align_val_t alignment) {
+    return allocate(size, static_cast<size_t>(alignment));
+}
+
+void* operator new(size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    return allocateNoThrow(size, static_cast<size_t>(alignment));
+}
+
+void* operator new[](size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    return allocateNoThrow(size, static_cast<size_t>(alignment));
+}
+
+void operator delete(void* pointer) noexcept {
+    release(pointer);
+}
+
+void operator delete[](void* pointer) noexcept {
+    release(pointer);
+}
+
+void operator delete(void* pointer, size_t) noexcept {
+    release(pointer);
+}
+
+void operator delete[](void* pointer, size_t) noexcept {
+    release(pointer);
+}
+
+void operator delete(void* pointer, const std::nothrow_t&) noexcept {
+    release(pointer);
+}
+
+void operator delete[](void* pointer, const std::nothrow_t&) noexcept {
+    release(pointer);
+}
+
+void operator delete(void* pointer, std::align_val_t) noexcept {
+    release(pointer);
+}
+
+void operator delete[](void* pointer, std::align_val_t) noexcept {
+    release(pointer);
+}
+
+void operator delete(void* pointer, size_t, std::align_val_t) noexcept {
+    release(pointer);
+}
+
+void operator delete[](void* pointer, size_t, std::align_val_t) noexcept {
+    release(pointer);
+}
+
+void operator delete(void* pointer, std::align_val_t, const std::nothrow_t&) noexcept {
+    release(pointer);
+}
+
+void operator delete[](void* pointer, std::align_val_t, const std::nothrow_t&) noexcept {
+    release(pointer);
+}
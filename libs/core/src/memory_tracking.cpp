@@ -0,0 +1,140 @@
+#include "core/memory_tracking.h"
+#include <algorithm>
+#include <atomic>
+
+namespace cpp_template {
+namespace core {
+namespace memory {
+
+namespace {
+
+// One cache line per subsystem so that threads busy in different
+// subsystems do not contend. Constant-initialised: operator new may run
+// before any dynamic initialiser of this file.
+struct alignas(64) Counters {
+    std::atomic<uint64_t> allocations{0};
+    std::atomic<uint64_t> deallocations{0};
+    std::atomic<uint64_t> bytes_allocated{0};
+    std::atomic<uint64_t> bytes_freed{0};
+    std::atomic<uint64_t> current{0};
+    std::atomic<uint64_t> peak{0};
+};
+
+Counters g_counters[kSubsystemCount];
+Counters g_total;  // Only current and peak are used
+std::atomic<bool> g_linked{false};
+std::atomic<bool> g_counting{true};
+
+thread_local Subsystem t_subsystem = Subsystem::OTHER;
+
+void raisePeak(std::atomic<uint64_t>& peak, uint64_t current) noexcept {
+    uint64_t seen = peak.load(std::memory_order_relaxed);
+    while (current > seen &&
+           !peak.compare_exchange_weak(seen, current, std::memory_order_relaxed)) {
+    }
+}
+
+}  // namespace
+
+const char* subsystemName(Subsystem subsystem) noexcept {
+    static const char* const names[kSubsystemCount] = {"OTHER", "CORE", "STRING_UTILS", "CONFIG",
+                                                       "DATA_PROCESSOR"};
+    auto index = static_cast<size_t>(subsystem);
+    return index < kSubsystemCount ? names[index] : "UNKNOWN";
+}
+
+bool trackingActive() noexcept {
+    return g_linked.load(std::memory_order_relaxed);
+}
+
+void setCountingEnabled(bool on) noexcept {
+    g_counting.store(on, std::memory_order_relaxed);
+}
+
+bool countingEnabled() noexcept {
+    return g_counting.load(std::memory_order_relaxed);
+}
+
+AllocationStatistics statistics(Subsystem subsystem) noexcept {
+    const Counters& counters = g_counters[static_cast<size_t>(subsystem) % kSubsystemCount];
+    AllocationStatistics stats;
+    stats.allocations = counters.allocations.load(std::memory_order_relaxed);
+    stats.deallocations = counters.deallocations.load(std::memory_order_relaxed);
+    stats.bytes_allocated = counters.bytes_allocated.load(std::memory_order_relaxed);
+    stats.bytes_freed = counters.bytes_freed.load(std::memory_order_relaxed);
+    stats.current_bytes = counters.current.load(std::memory_order_relaxed);
+    stats.peak_bytes = std::max(counters.peak.load(std::memory_order_relaxed), stats.current_bytes);
+    return stats;
+}
+
+AllocationStatistics totalStatistics() noexcept {
+    AllocationStatistics total;
+    for (size_t i = 0; i < kSubsystemCount; ++i) {
+        AllocationStatistics stats = statistics(static_cast<Subsystem>(i));
+        total.allocations += stats.allocations;
+        total.deallocations += stats.deallocations;
+        total.bytes_allocated += stats.bytes_allocated;
+        total.bytes_freed += stats.bytes_freed;
+    }
+    total.current_bytes = g_total.current.load(std::memory_order_relaxed);
+    total.peak_bytes = std::max(g_total.peak.load(std::memory_order_relaxed), total.current_bytes);
+    return total;
+}
+
+void resetStatistics() noexcept {
+    for (Counters& counters : g_counters) {
+        counters.allocations.store(0, std::memory_order_relaxed);
+        counters.deallocations.store(0, std::memory_order_relaxed);
+        counters.bytes_allocated.store(0, std::memory_order_relaxed);
+        counters.bytes_freed.store(0, std::memory_order_relaxed);
+        counters.peak.store(counters.current.load(std::memory_order_relaxed),
+                            std::memory_order_relaxed);
+    }
+    g_total.peak.store(g_total.current.load(std::memory_order_relaxed), std::memory_order_relaxed);
+}
+
+AllocationScope::AllocationScope(Subsystem subsystem) noexcept : previous_(t_subsystem) {
+    if (previous_ == Subsystem::OTHER) {
+        t_subsystem = subsystem;
+    }
+}
+
+AllocationScope::~AllocationScope() {
+    t_subsystem = previous_;
+}
+
+namespace detail {
+
+void markHooksLinked() noexcept {
+    g_linked.store(true, std::memory_order_relaxed);
+}
+
+Subsystem recordAllocation(size_t bytes) noexcept {
+    if (!g_counting.load(std::memory_order_relaxed)) {
+        return kUncounted;
+    }
+    Subsystem subsystem = t_subsystem;
+    Counters& counters = g_counters[static_cast<size_t>(subsystem)];
+    counters.allocations.fetch_add(1, std::memory_order_relaxed);
+    counters.bytes_allocated.fetch_add(bytes, std::memory_order_relaxed);
+    raisePeak(counters.peak, counters.current.fetch_add(bytes, std::memory_order_relaxed) + bytes);
+    raisePeak(g_total.peak, g_total.current.fetch_add(bytes, std::memory_order_relaxed) + bytes);
+    return subsystem;
+}
+
+void recordDeallocation(Subsystem subsystem, size_t bytes) noexcept {
+    if (subsystem == kUncounted) {
+        return;
+    }
+    Counters& counters = g_counters[static_cast<size_t>(subsystem)];
+    counters.deallocations.fetch_add(1, std::memory_order_relaxed);
+    counters.bytes_freed.fetch_add(bytes, std::memory_order_relaxed);
+    counters.current.fetch_sub(bytes, std::memory_order_relaxed);
+    g_total.current.fetch_sub(bytes, std::memory_order_relaxed);
+}
+
+}  // namespace detail
+
+}  // namespace memory
+}  // namespace core
+}  // namespace cpp_template
@@ -7,8 +7,29 @@
  * core utilities.
  */
 
+#include <core/cpu_topology.h>
+#include <core/file_watcher.h>
+#include <poll.h>
+#include <pthread.h>
+#include <sched.h>
+#include <sys/eventfd.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <charconv>
+#include <climits>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
 #include <fstream>
+#include <iterator>
+#include <sstream>
 #include <string>
+#include <string_view>
+#include <system_error>
+#include <thread>
+#include <utility>
 #include <vector>
 
 namespace core {
@@ -72,3 +93,304 @@ bool isRunningInContainer() {
 
 }  // namespace platform
 }  // namespace core
+
+namespace cpp_template {
+namespace core {
+
+/**
+ * @brief inotify watch on the directory of the file, plus an eventfd to stop the thread
+ */
+struct FileWatcher::Impl {
+    int inotify_fd = -1;
+    int stop_fd = -1;
+    std::string path;
+    std::string name;
+    Callback on_change;
+    std::thread thread;
+
+    ~Impl() {
+        if (inotify_fd >= 0) {
+            ::close(inotify_fd);
+        }
+        if (stop_fd >= 0) {
+            ::close(stop_fd);
+        }
+    }
+
+    // First component of the target when the file is a relative symlink. A
+    // Kubernetes ConfigMap volume links app.conf to ..data/app.conf and
+    // updates it by renaming a new ..data_tmp link over ..data, so the only
+    // event of an update is named ..data
+    std::string linkedName() const {
+        char target[PATH_MAX];
+        ssize_t length = ::readlink(path.c_str(), target, sizeof(target));
+        if (length <= 0 || target[0] == '/') {
+            return {};
+        }
+        std::string_view relative(target, static_cast<size_t>(length));
+        return std::string(relative.substr(0, relative.find('/')));
+    }
+
+    // Drain every queued event; true if any concerns the file (or events were lost)
+    bool drainEvents() {
+        alignas(inotify_event) char buffer[4096];
+        const std::string linked = linkedName();
+        bool matched = false;
+        for (;;) {
+            ssize_t length = ::read(inotify_fd, buffer, sizeof(buffer));
+            if (length <= 0) {
+                return matched;
+            }
+            for (ssize_t offset = 0; offset < length;) {
+                const auto* event = reinterpret_cast<const inotify_event*>(buffer + offset);
+                if ((event->mask & IN_Q_OVERFLOW) != 0 ||
+                    (event->len > 0 && (name == event->name ||
+                                        (!linked.empty() && linked == event->name)))) {
+                    matched = true;
+                }
+                offset += static_cast<ssize_t>(sizeof(inotify_event) + event->len);
+            }
+        }
+    }
+
+    void run() {
+        pollfd fds[2] = {{inotify_fd, POLLIN, 0}, {stop_fd, POLLIN, 0}};
+        for (;;) {
+            if (::poll(fds, 2, -1) < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                return;
+            }
+            if (fds[1].revents != 0) {
+                return;
+            }
+            if (drainEvents()) {
+                on_change();
+            }
+        }
+    }
+};
+
+FileWatcher::FileWatcher(std::string path, Callback on_change)
+    : path_(std::move(path)), impl_(std::make_unique<Impl>()) {
+    std::filesystem::path file(path_);
+    std::string directory = file.has_parent_path() ? file.parent_path().string() : ".";
+    impl_->path = path_;
+    impl_->name = file.filename().string();
+    impl_->on_change = std::move(on_change);
+
+    impl_->inotify_fd = ::inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (impl_->inotify_fd < 0) {
+        throw std::system_error(errno, std::generic_category(), "inotify_init1");
+    }
+    // Close-after-write instead of every write, so a reload sees whole files
+    constexpr uint32_t mask = IN_CLOSE_WRITE | IN_MOVED_TO | IN_MOVED_FROM | IN_DELETE;
+    if (::inotify_add_watch(impl_->inotify_fd, directory.c_str(), mask) < 0) {
+        throw std::system_error(errno, std::generic_category(), "inotify_add_watch " + directory);
+    }
+    impl_->stop_fd = ::eventfd(0, EFD_CLOEXEC);
+    if (impl_->stop_fd < 0) {
+        throw std::system_error(errno, std::generic_category(), "eventfd");
+    }
+    impl_->thread = std::thread([impl = impl_.get()] { impl->run(); });
+}
+
+FileWatcher::~FileWatcher() {
+    stop();
+}
+
+void FileWatcher::stop() {
+    if (!impl_->thread.joinable()) {
+        return;
+    }
+    uint64_t one = 1;
+    while (::write(impl_->stop_fd, &one, sizeof(one)) < 0 && errno == EINTR) {
+    }
+    impl_->thread.join();
+}
+
+}  // namespace core
+}  // namespace cpp_template
+
+namespace cpp_template {
+namespace core {
+
+namespace {
+
+std::string readSmallFile(const std::filesystem::path& file) {
+    std::ifstream in(file);
+    return std::string(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+}
+
+// Cpus_allowed_list of the process, or sched_getaffinity() when procfs is not readable
+std::vector<uint32_t> readAllowedCpus(const std::filesystem::path& root) {
+    constexpr std::string_view key = "Cpus_allowed_list:";
+    std::ifstream status(root / "proc/self/status");
+    std::string line;
+    while (std::getline(status, line)) {
+        if (line.compare(0, key.size(), key.data(), key.size()) == 0) {
+            return parseCpuList(std::string_view(line).substr(key.size()));
+        }
+    }
+
+    std::vector<uint32_t> cpus;
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if (::sched_getaffinity(0, sizeof(set), &set) == 0) {
+        for (uint32_t cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+            if (CPU_ISSET(cpu, &set)) {
+                cpus.push_back(cpu);
+            }
+        }
+    }
+    return cpus;
+}
+
+// CPUs worth of quota set on one cgroup directory; 0 when unlimited or unreadable
+double readQuota(const std::filesystem::path& directory, bool unified) {
+    if (unified) {
+        // cgroup v2: "<quota|max> <period>"
+        std::istringstream in(readSmallFile(directory / "cpu.max"));
+        std::string quota;
+        double period = 0.0;
+        if (!(in >> quota >> period) || quota == "max" || period <= 0.0) {
+            return 0.0;
+        }
+        double value = std::strtod(quota.c_str(), nullptr);
+        return value > 0.0 ? value / period : 0.0;
+    }
+
+    // cgroup v1: a quota of -1 means unlimited
+    double quota = std::strtod(readSmallFile(directory / "cpu.cfs_quota_us").c_str(), nullptr);
+    double period = std::strtod(readSmallFile(directory / "cpu.cfs_period_us").c_str(), nullptr);
+    return quota > 0.0 && period > 0.0 ? quota / period : 0.0;
+}
+
+// Tightest quota from the process's cgroup up to the root of its mount. Inside a
+// container the listed path may not exist under the mount, which is then the
+// container's own cgroup, so missing directories are simply skipped.
+double tightestQuota(const std::filesystem::path& mount, std::string_view cgroup, bool unified) {
+    double tightest = 0.0;
+    std::filesystem::path relative = std::filesystem::path(std::string(cgroup)).relative_path();
+    for (;;) {
+        double quota = readQuota(mount / relative, unified);
+        if (quota > 0.0 && (tightest == 0.0 || quota < tightest)) {
+            tightest = quota;
+        }
+        if (relative.empty()) {
+            return tightest;
+        }
+        relative = relative.parent_path();
+    }
+}
+
+bool hasController(std::string_view controllers, std::string_view name) {
+    while (!controllers.empty()) {
+        size_t comma = controllers.find(',');
+        if (controllers.substr(0, comma) == name) {
+            return true;
+        }
+        if (comma == std::string_view::npos) {
+            break;
+        }
+        controllers.remove_prefix(comma + 1);
+    }
+    return false;
+}
+
+// Tightest CPU quota over the v2 hierarchy and the v1 cpu controller
+double readCpuQuota(const std::filesystem::path& root) {
+    const std::filesystem::path mounts = root / "sys/fs/cgroup";
+    std::ifstream cgroups(root / "proc/self/cgroup");
+    std::string line;
+    double tightest = 0.0;
+    while (std::getline(cgroups, line)) {
+        // hierarchy-id:controllers:path
+        size_t first = line.find(':');
+        size_t second = first == std::string::npos ? first : line.find(':', first + 1);
+        if (second == std::string::npos) {
+            continue;
+        }
+        std::string controllers = line.substr(first + 1, second - first - 1);
+        std::string_view cgroup = std::string_view(line).substr(second + 1);
+
+        double quota = 0.0;
+        if (controllers.empty()) {
+            quota = tightestQuota(mounts, cgroup, true);
+        } else if (hasController(controllers, "cpu")) {
+            quota = tightestQuota(mounts / controllers, cgroup, false);
+            if (quota == 0.0 && controllers != "cpu") {
+                quota = tightestQuota(mounts / "cpu", cgroup, false);
+            }
+        }
+        if (quota > 0.0 && (tightest == 0.0 || quota < tightest)) {
+            tightest = quota;
+        }
+    }
+    return tightest;
+}
+
+// sysfs NUMA nodes restricted to the allowed CPUs, by node id
+std::vector<NumaNode> readNumaNodes(const std::filesystem::path& root,
+                                    const std::vector<uint32_t>& allowed) {
+    std::vector<NumaNode> nodes;
+    std::error_code error;
+    for (const auto& entry :
+         std::filesystem::directory_iterator(root / "sys/devices/system/node", error)) {
+        std::string name = entry.path().filename().string();
+        NumaNode node;
+        const char* end = name.data() + name.size();
+        if (name.size() <= 4 || name.compare(0, 4, "node") != 0 ||
+            std::from_chars(name.data() + 4, end, node.id).ptr != end) {
+            continue;
+        }
+        for (uint32_t cpu : parseCpuList(readSmallFile(entry.path() / "cpulist"))) {
+            if (std::binary_search(allowed.begin(), allowed.end(), cpu)) {
+                node.cpus.push_back(cpu);
+            }
+        }
+        if (!node.cpus.empty()) {
+            nodes.push_back(std::move(node));
+        }
+    }
+    std::sort(nodes.begin(), nodes.end(),
+              [](const NumaNode& a, const NumaNode& b) { return a.id < b.id; });
+    return nodes;
+}
+
+}  // namespace
+
+CpuTopology detectCpuTopology(const std::string& sysroot) {
+    const std::filesystem::path root(sysroot);
+    CpuTopology topology;
+    topology.allowed_cpus = readAllowedCpus(root);
+    if (topology.allowed_cpus.empty()) {
+        unsigned count = std::max(1u, std::thread::hardware_concurrency());
+        for (uint32_t cpu = 0; cpu < count; ++cpu) {
+            topology.allowed_cpus.push_back(cpu);
+        }
+    }
+    topology.nodes = readNumaNodes(root, topology.allowed_cpus);
+    if (topology.nodes.empty()) {
+        topology.nodes.push_back(NumaNode{0, topology.allowed_cpus});
+    }
+    topology.cpu_quota = readCpuQuota(root);
+    return topology;
+}
+
+bool pinCurrentThread(const std::vector<uint32_t>& cpus) {
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    bool any = false;
+    for (uint32_t cpu : cpus) {
+        if (cpu < CPU_SETSIZE) {
+            CPU_SET(cpu, &set);
+            any = true;
+        }
+    }
+    return any && ::pthread_setaffinity_np(::pthread_self(), sizeof(set), &set) == 0;
+}
+
+}  // namespace core
+}  // namespace cpp_template
@@ -7,7 +7,19 @@
  * core utilities.
  */
 
+#include <core/cpu_topology.h>
+#include <core/file_watcher.h>
+#include <fcntl.h>
+#include <sys/event.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <filesystem>
 #include <string>
+#include <system_error>
+#include <thread>
+#include <utility>
 #include <vector>
 
 namespace core {
@@ -54,3 +66,151 @@ std::string getMacOSVersion() {
 
 }  // namespace platform
 }  // namespace core
+
+namespace cpp_template {
+namespace core {
+
+/**
+ * @brief kqueue vnode watches on the directory and on the file, plus a user event to stop
+ *
+ * kqueue watches descriptors rather than names: the directory watch sees the
+ * file being created, renamed over or removed, after which the file is
+ * reopened; the file watch sees writes in place.
+ */
+struct FileWatcher::Impl {
+    static constexpr uintptr_t kStopIdent = 1;
+
+    int queue_fd = -1;
+    int directory_fd = -1;
+    int file_fd = -1;
+    std::string path;
+    ino_t inode = 0;
+    dev_t device = 0;
+    Callback on_change;
+    std::thread thread;
+
+    ~Impl() {
+        for (int fd : {file_fd, directory_fd, queue_fd}) {
+            if (fd >= 0) {
+                ::close(fd);
+            }
+        }
+    }
+
+    // Reopen the file; true if a different file (or none) is there now
+    bool reopenFile() {
+        bool existed = file_fd >= 0;
+        ino_t previous_inode = inode;
+        dev_t previous_device = device;
+        if (existed) {
+            ::close(file_fd);  // Also drops its kqueue watch
+        }
+        file_fd = ::open(path.c_str(), O_EVTONLY | O_CLOEXEC);
+        struct stat info;
+        if (file_fd < 0 || ::fstat(file_fd, &info) != 0) {
+            inode = 0;
+            device = 0;
+            return existed;
+        }
+        inode = info.st_ino;
+        device = info.st_dev;
+        struct kevent change;
+        EV_SET(&change, static_cast<uintptr_t>(file_fd), EVFILT_VNODE, EV_ADD | EV_CLEAR,
+               NOTE_WRITE | NOTE_EXTEND | NOTE_DELETE | NOTE_RENAME | NOTE_ATTRIB, 0, nullptr);
+        ::kevent(queue_fd, &change, 1, nullptr, 0, nullptr);
+        return !existed || inode != previous_inode || device != previous_device;
+    }
+
+    void run() {
+        struct kevent events[8];
+        for (;;) {
+            int count = ::kevent(queue_fd, nullptr, 0, events, 8, nullptr);
+            if (count < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                return;
+            }
+            bool changed = false;
+            bool reopen = false;
+            for (int i = 0; i < count; ++i) {
+                if (events[i].filter == EVFILT_USER) {
+                    return;
+                }
+                if (static_cast<int>(events[i].ident) == directory_fd) {
+                    reopen = true;
+                } else if ((events[i].fflags & (NOTE_DELETE | NOTE_RENAME)) != 0) {
+                    reopen = true;
+                    changed = true;
+                } else {
+                    changed = true;
+                }
+            }
+            if (reopen && reopenFile()) {
+                changed = true;
+            }
+            if (changed) {
+                on_change();
+            }
+        }
+    }
+};
+
+FileWatcher::FileWatcher(std::string path, Callback on_change)
+    : path_(std::move(path)), impl_(std::make_unique<Impl>()) {
+    std::filesystem::path file(path_);
+    std::string directory = file.has_parent_path() ? file.parent_path().string() : ".";
+    impl_->path = path_;
+    impl_->on_change = std::move(on_change);
+
+    impl_->queue_fd = ::kqueue();
+    if (impl_->queue_fd < 0) {
+        throw std::system_error(errno, std::generic_category(), "kqueue");
+    }
+    impl_->directory_fd = ::open(directory.c_str(), O_EVTONLY | O_CLOEXEC);
+    if (impl_->directory_fd < 0) {
+        throw std::system_error(errno, std::generic_category(), "open " + directory);
+    }
+    struct kevent changes[2];
+    EV_SET(&changes[0], static_cast<uintptr_t>(impl_->directory_fd), EVFILT_VNODE,
+           EV_ADD | EV_CLEAR, NOTE_WRITE, 0, nullptr);
+    EV_SET(&changes[1], Impl::kStopIdent, EVFILT_USER, EV_ADD | EV_CLEAR, 0, 0, nullptr);
+    if (::kevent(impl_->queue_fd, changes, 2, nullptr, 0, nullptr) < 0) {
+        throw std::system_error(errno, std::generic_category(), "kevent");
+    }
+    impl_->reopenFile();
+    impl_->thread = std::thread([impl = impl_.get()] { impl->run(); });
+}
+
+FileWatcher::~FileWatcher() {
+    stop();
+}
+
+void FileWatcher::stop() {
+    if (!impl_->thread.joinable()) {
+        return;
+    }
+    struct kevent trigger;
+    EV_SET(&trigger, Impl::kStopIdent, EVFILT_USER, 0, NOTE_TRIGGER, 0, nullptr);
+    ::kevent(impl_->queue_fd, &trigger, 1, nullptr, 0, nullptr);
+    impl_->thread.join();
+}
+
+// macOS exposes neither an affinity mask nor NUMA nodes; every CPU is one node
+CpuTopology detectCpuTopology(const std::string&) {
+    CpuTopology topology;
+    unsigned count = std::max(1u, std::thread::hardware_concurrency());
+    for (uint32_t cpu = 0; cpu < count; ++cpu) {
+        topology.allowed_cpus.push_back(cpu);
+    }
+    topology.nodes.push_back(NumaNode{0, topology.allowed_cpus});
+    return topology;
+}
+
+// Thread affinity is only a scheduler hint on macOS, so workers are left unpinned
+bool pinCurrentThread(const std::vector<uint32_t>&) {
+    return false;
+}
+
+}  // namespace core
+}  // namespace cpp_template
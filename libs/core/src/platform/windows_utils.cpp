@@ -8,10 +8,20 @@
  */
 
 #ifdef _WIN32
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
     #include <windows.h>
 #endif
 
+#include <core/cpu_topology.h>
+#include <core/file_watcher.h>
+#include <algorithm>
+#include <filesystem>
 #include <string>
+#include <system_error>
+#include <thread>
+#include <utility>
 #include <vector>
 
 namespace core {
@@ -94,3 +104,152 @@ bool isRunningAsAdmin() {
 
 }  // namespace platform
 }  // namespace core
+
+#ifdef _WIN32
+
+namespace cpp_template {
+namespace core {
+
+/**
+ * @brief Overlapped ReadDirectoryChangesW on the directory of the file, plus a stop event
+ */
+struct FileWatcher::Impl {
+    HANDLE directory = INVALID_HANDLE_VALUE;
+    HANDLE changed_event = nullptr;
+    HANDLE stop_event = nullptr;
+    std::wstring name;
+    Callback on_change;
+    std::thread thread;
+
+    ~Impl() {
+        if (directory != INVALID_HANDLE_VALUE) {
+            CloseHandle(directory);
+        }
+        for (HANDLE event : {changed_event, stop_event}) {
+            if (event) {
+                CloseHandle(event);
+            }
+        }
+    }
+
+    // True if any record names the file, or if records were lost
+    bool matches(const char* buffer, DWORD length) const {
+        if (length == 0) {
+            return true;  // The buffer overflowed
+        }
+        for (;;) {
+            const auto* info = reinterpret_cast<const FILE_NOTIFY_INFORMATION*>(buffer);
+            int characters = static_cast<int>(info->FileNameLength / sizeof(WCHAR));
+            if (CompareStringOrdinal(info->FileName, characters, name.c_str(),
+                                     static_cast<int>(name.size()), TRUE) == CSTR_EQUAL) {
+                return true;
+            }
+            if (info->NextEntryOffset == 0) {
+                return false;
+            }
+            buffer += info->NextEntryOffset;
+        }
+    }
+
+    void run() {
+        alignas(DWORD) char buffer[16 * 1024];
+        constexpr DWORD filter =
+            FILE_NOTIFY_CHANGE_FILE_NAME | FILE_NOTIFY_CHANGE_LAST_WRITE | FILE_NOTIFY_CHANGE_SIZE;
+        for (;;) {
+            OVERLAPPED overlapped = {};
+            overlapped.hEvent = changed_event;
+            if (!ReadDirectoryChangesW(directory, buffer, sizeof(buffer), FALSE, filter, nullptr,
+                                       &overlapped, nullptr)) {
+                return;
+            }
+            HANDLE handles[2] = {changed_event, stop_event};
+            DWORD signaled = WaitForMultipleObjects(2, handles, FALSE, INFINITE);
+            DWORD length = 0;
+            if (signaled != WAIT_OBJECT_0) {
+                CancelIo(directory);
+                GetOverlappedResult(directory, &overlapped, &length, TRUE);
+                return;
+            }
+            if (!GetOverlappedResult(directory, &overlapped, &length, FALSE)) {
+                return;
+            }
+            if (matches(buffer, length)) {
+                on_change();
+            }
+        }
+    }
+};
+
+FileWatcher::FileWatcher(std::string path, Callback on_change)
+    : path_(std::move(path)), impl_(std::make_unique<Impl>()) {
+    std::filesystem::path file(path_);
+    std::filesystem::path directory = file.has_parent_path() ? file.parent_path() : ".";
+    impl_->name = file.filename().wstring();
+    impl_->on_change = std::move(on_change);
+
+    impl_->directory = CreateFileW(directory.c_str(), FILE_LIST_DIRECTORY,
+                                   FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr,
+                                   OPEN_EXISTING,
+                                   FILE_FLAG_BACKUP_SEMANTICS | FILE_FLAG_OVERLAPPED, nullptr);
+    if (impl_->directory == INVALID_HANDLE_VALUE) {
+        throw std::system_error(static_cast<int>(GetLastError()), std::system_category(),
+                                "CreateFileW " + directory.string());
+    }
+    impl_->changed_event = CreateEventW(nullptr, FALSE, FALSE, nullptr);
+    impl_->stop_event = CreateEventW(nullptr, TRUE, FALSE, nullptr);
+    if (!impl_->changed_event || !impl_->stop_event) {
+        throw std::system_error(static_cast<int>(GetLastError()), std::system_category(),
+                                "CreateEventW");
+    }
+    impl_->thread = std::thread([impl = impl_.get()] { impl->run(); });
+}
+
+FileWatcher::~FileWatcher() {
+    stop();
+}
+
+void FileWatcher::stop() {
+    if (!impl_->thread.joinable()) {
+        return;
+    }
+    SetEvent(impl_->stop_event);
+    impl_->thread.join();
+}
+
+// Affinity comes from the process mask of the first processor group; NUMA
+// nodes are not split out, so every allowed CPU is reported as node 0
+CpuTopology detectCpuTopology(const std::string&) {
+    CpuTopology topology;
+    DWORD_PTR process_mask = 0;
+    DWORD_PTR system_mask = 0;
+    if (GetProcessAffinityMask(GetCurrentProcess(), &process_mask, &system_mask)) {
+        for (uint32_t cpu = 0; cpu < sizeof(DWORD_PTR) * 8; ++cpu) {
+            if ((process_mask >> cpu) & 1) {
+                topology.allowed_cpus.push_back(cpu);
+            }
+        }
+    }
+    if (topology.allowed_cpus.empty()) {
+        unsigned count = std::max(1u, std::thread::hardware_concurrency());
+        for (uint32_t cpu = 0; cpu < count; ++cpu) {
+            topology.allowed_cpus.push_back(cpu);
+        }
+    }
+    topology.nodes.push_back(NumaNode{0, topology.allowed_cpus});
+    return topology;
+}
+
+bool pinCurrentThread(const std::vector<uint32_t>& cpus) {
+    DWORD_PTR mask = 0;
+    for (uint32_t cpu : cpus) {
+        if (cpu < sizeof(DWORD_PTR) * 8) {
+            mask |= DWORD_PTR(1) << cpu;
+        }
+    }
+    return mask != 0 && SetThreadAffinityMask(GetCurrentThread(), mask) != 0;
+}
+
+}  // namespace core
+}  // namespace cpp_template
+
+#endif
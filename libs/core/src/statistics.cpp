@@ -0,0 +1,141 @@
+#include "core/statistics.h"
+#include <algorithm>
+#include <cmath>
+
+#if defined(_MSC_VER)
+    #include <intrin.h>
+#endif
+
+namespace cpp_template {
+namespace core {
+
+namespace {
+
+unsigned highestBit(uint64_t value) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+    return 63u - static_cast<unsigned>(__builtin_clzll(value));
+#elif defined(_MSC_VER) && defined(_M_X64)
+    unsigned long index = 0;
+    _BitScanReverse64(&index, value);
+    return static_cast<unsigned>(index);
+#else
+    unsigned bit = 0;
+    while (value >>= 1) {
+        ++bit;
+    }
+    return bit;
+#endif
+}
+
+void atomicMax(std::atomic<uint64_t>& target, uint64_t value) noexcept {
+    uint64_t current = target.load(std::memory_order_relaxed);
+    while (current < value &&
+           !target.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+    }
+}
+
+}  // namespace
+
+// ShardedCounter
+
+ShardedCounter::ShardedCounter() : shards_(std::make_unique<Shard[]>(kShardCount)) {}
+
+uint64_t ShardedCounter::value() const noexcept {
+    uint64_t total = 0;
+    for (size_t i = 0; i < kShardCount; ++i) {
+        total += shards_[i].value.load(std::memory_order_relaxed);
+    }
+    return total;
+}
+
+void ShardedCounter::reset() noexcept {
+    for (size_t i = 0; i < kShardCount; ++i) {
+        shards_[i].value.store(0, std::memory_order_relaxed);
+    }
+}
+
+// LatencyHistogram
+
+LatencyHistogram::LatencyHistogram() : shards_(std::make_unique<Shard[]>(kShardCount)) {}
+
+size_t LatencyHistogram::bucketIndex(uint64_t value) noexcept {
+    if (value < kSubBuckets) {
+        return static_cast<size_t>(value);
+    }
+    unsigned exponent = highestBit(value);
+    if (exponent > kMaxExponent) {
+        return kBucketCount - 1;
+    }
+    size_t sub = static_cast<size_t>(value >> (exponent - kSubBucketBits)) & (kSubBuckets - 1);
+    return (exponent - kSubBucketBits + 1) * kSubBuckets + sub;
+}
+
+uint64_t LatencyHistogram::bucketValue(size_t index) noexcept {
+    if (index < kSubBuckets) {
+        return index;
+    }
+    unsigned shift = static_cast<unsigned>(index / kSubBuckets) - 1;
+    uint64_t lower = static_cast<uint64_t>(kSubBuckets + index % kSubBuckets) << shift;
+    return lower + ((uint64_t{1} << shift) >> 1);
+}
+
+void LatencyHistogram::record(uint64_t nanoseconds) noexcept {
+    Shard& shard = shards_[detail::threadShardIndex() % kShardCount];
+    shard.buckets[bucketIndex(nanoseconds)].fetch_add(1, std::memory_order_relaxed);
+    shard.sum.fetch_add(nanoseconds, std::memory_order_relaxed);
+    atomicMax(shard.max, nanoseconds);
+}
+
+LatencySnapshot LatencyHistogram::snapshot() const {
+    uint64_t merged[kBucketCount] = {};
+    LatencySnapshot result;
+    uint64_t sum = 0;
+
+    for (size_t s = 0; s < kShardCount; ++s) {
+        const Shard& shard = shards_[s];
+        for (size_t b = 0; b < kBucketCount; ++b) {
+            uint64_t n = shard.buckets[b].load(std::memory_order_relaxed);
+            merged[b] += n;
+            result.count += n;
+        }
+        sum += shard.sum.load(std::memory_order_relaxed);
+        result.max_ns = std::max(result.max_ns, shard.max.load(std::memory_order_relaxed));
+    }
+
+    if (result.count == 0) {
+        return result;
+    }
+
+    // Percentiles: value of the bucket holding the ceil(q * count)-th sample
+    auto percentile = [&](double quantile) {
+        uint64_t rank = static_cast<uint64_t>(std::ceil(quantile * static_cast<double>(result.count)));
+        rank = std::max<uint64_t>(rank, 1);
+        uint64_t seen = 0;
+        for (size_t b = 0; b < kBucketCount; ++b) {
+            seen += merged[b];
+            if (seen >= rank) {
+                return std::min(bucketValue(b), result.max_ns);
+            }
+        }
+        return result.max_ns;
+    };
+
+    result.p50_ns = percentile(0.50);
+    result.p99_ns = percentile(0.99);
+    result.mean_ns = static_cast<double>(sum) / static_cast<double>(result.count);
+    return result;
+}
+
+void LatencyHistogram::reset() noexcept {
+    for (size_t s = 0; s < kShardCount; ++s) {
+        Shard& shard = shards_[s];
+        for (size_t b = 0; b < kBucketCount; ++b) {
+            shard.buckets[b].store(0, std::memory_order_relaxed);
+        }
+        shard.sum.store(0, std::memory_order_relaxed);
+        shard.max.store(0, std::memory_order_relaxed);
+    }
+}
+
+}  // namespace core
+}  // namespace cpp_template
@@ -0,0 +1,231 @@
+#include "core/thread_pool.h"
+#include "core/cpu_topology.h"
+#include <algorithm>
+#include <chrono>
+#include <exception>
+
+namespace cpp_template {
+namespace core {
+
+namespace {
+
+// Identifies the pool and queue owned by the current worker thread, if any
+thread_local const ThreadPool* tls_pool = nullptr;
+thread_local size_t tls_index = 0;
+
+// Waits are bounded so they go through the header-only timed wait path; the
+// untimed condition_variable::wait symbol needs a newer libstdc++ runtime
+// than some deployment targets ship.
+constexpr std::chrono::milliseconds kWaitSlice(100);
+
+}  // namespace
+
+ThreadPool::ThreadPool(size_t thread_count, WorkerPlacement placement)
+    : node_count_(1), next_queue_(0), pending_(0), stopping_(false) {
+    if (thread_count == 0) {
+        thread_count = effectiveConcurrency();
+    }
+
+    queues_.reserve(thread_count);
+    for (size_t i = 0; i < thread_count; ++i) {
+        queues_.push_back(std::make_unique<WorkerQueue>());
+    }
+
+    // Give node n the workers whose share of the pool falls in its share of the CPUs
+    worker_nodes_.assign(thread_count, 0);
+    const CpuTopology& topology = cpuTopology();
+    const bool pin = placement == WorkerPlacement::PER_NODE && topology.nodes.size() > 1;
+    if (pin) {
+        node_count_ = topology.nodes.size();
+        size_t total_cpus = 0;
+        for (const NumaNode& node : topology.nodes) {
+            total_cpus += node.cpus.size();
+        }
+        size_t cpus_before = 0;
+        for (size_t node = 0; node < node_count_; ++node) {
+            size_t first = thread_count * cpus_before / total_cpus;
+            cpus_before += topology.nodes[node].cpus.size();
+            size_t last = thread_count * cpus_before / total_cpus;
+            std::fill(worker_nodes_.begin() + static_cast<std::ptrdiff_t>(first),
+                      worker_nodes_.begin() + static_cast<std::ptrdiff_t>(last), node);
+        }
+    }
+
+    threads_.reserve(thread_count);
+    for (size_t i = 0; i < thread_count; ++i) {
+        threads_.emplace_back([this, i, pin] {
+            if (pin) {
+                pinCurrentThread(cpuTopology().nodes[worker_nodes_[i]].cpus);
+            }
+            workerLoop(i);
+        });
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(wake_mutex_);
+        stopping_ = true;
+    }
+    wake_.notify_all();
+
+    for (auto& thread : threads_) {
+        thread.join();
+    }
+}
+
+size_t ThreadPool::size() const noexcept {
+    return threads_.size();
+}
+
+size_t ThreadPool::currentWorker() const noexcept {
+    return tls_pool == this ? tls_index : size();
+}
+
+void ThreadPool::submit(Task task) {
+    size_t index = (tls_pool == this)
+                       ? tls_index
+                       : next_queue_.fetch_add(1, std::memory_order_relaxed) % queues_.size();
+    {
+        std::lock_guard<std::mutex> lock(queues_[index]->mutex);
+        queues_[index]->tasks.push_back(std::move(task));
+    }
+    {
+        // Publish under the wake mutex so a worker about to sleep cannot miss it
+        std::lock_guard<std::mutex> lock(wake_mutex_);
+        pending_.fetch_add(1, std::memory_order_release);
+    }
+    wake_.notify_one();
+}
+
+void ThreadPool::parallelFor(size_t count, size_t chunk_size,
+                             const std::function<void(size_t, size_t)>& body) {
+    if (count == 0) {
+        return;
+    }
+    if (chunk_size == 0) {
+        // Aim for a few chunks per worker so stragglers can be balanced out
+        chunk_size = std::max<size_t>(1, count / (size() * 4));
+    }
+
+    const size_t chunk_count = (count + chunk_size - 1) / chunk_size;
+    if (chunk_count == 1) {
+        body(0, count);
+        return;
+    }
+
+    // Shared with helper tasks, which may start after this call has returned
+    struct State {
+        const std::function<void(size_t, size_t)>* body;
+        size_t count;
+        size_t chunk_size;
+        size_t chunk_count;
+        std::atomic<size_t> next_chunk{0};
+        std::atomic<size_t> finished_chunks{0};
+        std::mutex mutex;
+        std::condition_variable done;
+        std::exception_ptr error;
+    };
+    auto state = std::make_shared<State>();
+    state->body = &body;
+    state->count = count;
+    state->chunk_size = chunk_size;
+    state->chunk_count = chunk_count;
+
+    auto run_chunks = [](State& s) {
+        for (;;) {
+            size_t chunk = s.next_chunk.fetch_add(1, std::memory_order_relaxed);
+            if (chunk >= s.chunk_count) {
+                return;
+            }
+            size_t begin = chunk * s.chunk_size;
+            size_t end = std::min(begin + s.chunk_size, s.count);
+            try {
+                (*s.body)(begin, end);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(s.mutex);
+                if (!s.error) {
+                    s.error = std::current_exception();
+                }
+            }
+            if (s.finished_chunks.fetch_add(1, std::memory_order_acq_rel) + 1 == s.chunk_count) {
+                std::lock_guard<std::mutex> lock(s.mutex);
+                s.done.notify_all();
+            }
+        }
+    };
+
+    const size_t helpers = std::min(size(), chunk_count - 1);
+    for (size_t i = 0; i < helpers; ++i) {
+        submit([state, run_chunks] { run_chunks(*state); });
+    }
+
+    run_chunks(*state);
+
+    std::unique_lock<std::mutex> lock(state->mutex);
+    while (!state->done.wait_for(lock, kWaitSlice, [&] {
+        return state->finished_chunks.load(std::memory_order_acquire) == state->chunk_count;
+    })) {
+    }
+    if (state->error) {
+        std::rethrow_exception(state->error);
+    }
+}
+
+void ThreadPool::workerLoop(size_t index) {
+    tls_pool = this;
+    tls_index = index;
+
+    for (;;) {
+        Task task;
+        if (tryPop(index, task) || trySteal(index, task)) {
+            pending_.fetch_sub(1, std::memory_order_acq_rel);
+            task();
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(wake_mutex_);
+        wake_.wait_for(lock, kWaitSlice, [this] {
+            return stopping_ || pending_.load(std::memory_order_acquire) > 0;
+        });
+        if (stopping_ && pending_.load(std::memory_order_acquire) == 0) {
+            return;
+        }
+    }
+}
+
+bool ThreadPool::tryPop(size_t index, Task& task) {
+    WorkerQueue& queue = *queues_[index];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (queue.tasks.empty()) {
+        return false;
+    }
+    task = std::move(queue.tasks.back());
+    queue.tasks.pop_back();
+    return true;
+}
+
+bool ThreadPool::trySteal(size_t thief, Task& task) {
+    // The first pass only visits workers on the thief's node; the second the rest
+    const size_t passes = node_count_ > 1 ? 2 : 1;
+    for (size_t pass = 0; pass < passes; ++pass) {
+        for (size_t offset = 1; offset < queues_.size(); ++offset) {
+            size_t index = (thief + offset) % queues_.size();
+            if (passes > 1 && (worker_nodes_[index] == worker_nodes_[thief]) != (pass == 0)) {
+                continue;
+            }
+            WorkerQueue& victim = *queues_[index];
+            std::unique_lock<std::mutex> lock(victim.mutex, std::try_to_lock);
+            if (!lock.owns_lock() || victim.tasks.empty()) {
+                continue;
+            }
+            task = std::move(victim.tasks.front());
+            victim.tasks.pop_front();
+            return true;
+        }
+    }
+    return false;
+}
+
+}  // namespace core
+}  // namespace cpp_template
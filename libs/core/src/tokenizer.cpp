@@ -0,0 +1,75 @@
+#include "core/tokenizer.h"
+#include "ascii_kernels.h"
+#include <limits>
+#include <stdexcept>
+
+namespace cpp_template {
+namespace core {
+namespace utils {
+namespace string {
+
+Delimiter Delimiter::sequence(std::string_view text) {
+    if (text.empty()) {
+        throw std::invalid_argument("Delimiter sequence cannot be empty");
+    }
+    if (text.size() == 1) {
+        return Delimiter(text[0]);
+    }
+    return Delimiter(Kind::SEQUENCE, text);
+}
+
+Delimiter Delimiter::anyOf(std::string_view characters) {
+    if (characters.size() == 1) {
+        return Delimiter(characters[0]);
+    }
+    Delimiter delimiter(Kind::ANY_OF, characters);
+    for (char character : characters) {
+        auto byte = static_cast<unsigned char>(character);
+        delimiter.set_[byte >> 6] |= uint64_t{1} << (byte & 63);
+    }
+    return delimiter;
+}
+
+size_t Delimiter::findAnyOf(std::string_view input, size_t from) const noexcept {
+    const char* const begin = input.data() + from;
+    const size_t remaining = input.size() - from;
+    if (text_.empty()) {
+        return std::string_view::npos;
+    }
+    const auto find_any = detail::asciiKernels().find_any;
+    if (find_any && text_.size() <= detail::kMaxFindAnySet) {
+        size_t offset = find_any(begin, remaining, text_.data(), text_.size());
+        return offset == remaining ? std::string_view::npos : from + offset;
+    }
+    for (size_t i = 0; i < remaining; ++i) {
+        if (inSet(begin[i])) {
+            return from + i;
+        }
+    }
+    return std::string_view::npos;
+}
+
+size_t tokenOffsets(std::string_view input, const Delimiter& delimiter, TokenOffsets& offsets) {
+    if (input.size() > std::numeric_limits<uint32_t>::max()) {
+        throw std::length_error("Input too large for 32-bit token offsets");
+    }
+    offsets.clear();
+
+    size_t start = 0;
+    while (start < input.size()) {
+        size_t length = 0;
+        size_t position = delimiter.find(input, start, length);
+        if (position == std::string_view::npos) {
+            position = input.size();
+        }
+        offsets.emplace_back(static_cast<uint32_t>(start),
+                             static_cast<uint32_t>(position - start));
+        start = position + length;
+    }
+    return offsets.size();
+}
+
+}  // namespace string
+}  // namespace utils
+}  // namespace core
+}  // namespace cpp_template
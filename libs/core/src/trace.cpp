@@ -0,0 +1,285 @@
+#include "core/trace.h"
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+
+namespace cpp_template {
+namespace core {
+namespace trace {
+
+namespace detail {
+
+std::atomic<bool> g_enabled{true};
+
+}  // namespace detail
+
+namespace {
+
+static_assert((kEventsPerThread & (kEventsPerThread - 1)) == 0,
+              "kEventsPerThread must be a power of two");
+
+// Slots are atomics so that collect() may read while the owner writes;
+// relaxed stores compile to plain moves
+struct Slot {
+    std::atomic<const char*> name{nullptr};
+    std::atomic<uint64_t> begin{0};
+    std::atomic<uint64_t> end{0};
+};
+
+struct ThreadBuffer {
+    explicit ThreadBuffer(uint32_t id) : thread(id), slots(new Slot[kEventsPerThread]) {}
+
+    uint32_t thread;  // Guarded by the registry mutex
+    std::unique_ptr<Slot[]> slots;
+    std::atomic<uint64_t> head{0};     // Zones ever written by the owner
+    std::atomic<uint64_t> cleared{0};  // Zones below this index were cleared
+    std::atomic<bool> exited{false};   // The owner thread has finished
+    uint64_t collected = 0;            // Zones below this index were collected; registry mutex
+};
+
+// Buffers outlive their threads so that zones of finished threads can be
+// exported, and are handed to new threads once those zones were collected
+// or cleared. The registry is never destroyed because threads may still
+// record during static destruction
+struct Registry {
+    std::mutex mutex;
+    std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+    uint32_t next_thread = 0;
+};
+
+Registry& registry() {
+    static Registry* instance = new Registry();
+    return *instance;
+}
+
+// Clock reading and steady_clock time at process start, used to convert ticks
+struct Epoch {
+    uint64_t ticks;
+    std::chrono::steady_clock::time_point time;
+};
+
+const Epoch& epoch() {
+    static const Epoch instance{now(), std::chrono::steady_clock::now()};
+    return instance;
+}
+
+// Start the epoch with the process, before the first zone's begin is read
+const Epoch& g_start = epoch();
+
+thread_local ThreadBuffer* t_buffer = nullptr;
+thread_local bool t_exited = false;
+
+// Releases the thread's buffer for reuse when the thread finishes. Zones
+// recorded by later thread_local destructors are dropped instead.
+struct BufferRelease {
+    ThreadBuffer* buffer = nullptr;
+
+    ~BufferRelease() {
+        t_exited = true;
+        t_buffer = nullptr;
+        if (buffer) {
+            buffer->exited.store(true, std::memory_order_release);
+        }
+    }
+};
+
+thread_local BufferRelease t_release;
+
+// A finished thread's buffer to hand to a new thread, or null. Prefers
+// buffers whose zones were all collected or cleared; past
+// kRetainedExitedThreads buffers holding unread zones, the oldest is
+// reused anyway and loses them. The caller holds the registry mutex.
+ThreadBuffer* reusableBuffer(Registry& reg) {
+    ThreadBuffer* oldest_unread = nullptr;
+    size_t unread = 0;
+    for (const auto& buffer : reg.buffers) {
+        if (!buffer->exited.load(std::memory_order_acquire)) {
+            continue;
+        }
+        uint64_t head = buffer->head.load(std::memory_order_relaxed);
+        if (std::max(buffer->collected, buffer->cleared.load(std::memory_order_relaxed)) >= head) {
+            return buffer.get();
+        }
+        if (!oldest_unread) {
+            oldest_unread = buffer.get();
+        }
+        ++unread;
+    }
+    return unread > kRetainedExitedThreads ? oldest_unread : nullptr;
+}
+
+ThreadBuffer* registerThread() noexcept {
+    if (t_exited) {
+        return nullptr;
+    }
+    Registry& reg = registry();
+    try {
+        std::lock_guard<std::mutex> lock(reg.mutex);
+        ThreadBuffer* buffer = reusableBuffer(reg);
+        if (buffer) {
+            // Continue after the previous owner's zones, none of which are reported again
+            buffer->thread = reg.next_thread++;
+            buffer->cleared.store(buffer->head.load(std::memory_order_relaxed),
+                                  std::memory_order_relaxed);
+            buffer->exited.store(false, std::memory_order_relaxed);
+        } else {
+            reg.buffers.push_back(std::make_unique<ThreadBuffer>(reg.next_thread++));
+            buffer = reg.buffers.back().get();
+        }
+        t_release.buffer = buffer;
+        t_buffer = buffer;
+    } catch (...) {
+        // Out of memory: this zone is dropped, the next one tries again
+        return nullptr;
+    }
+    return t_buffer;
+}
+
+// Nanoseconds per clock tick, measured against steady_clock since the epoch
+double nanosecondsPerTick() {
+#if defined(CORE_TRACE_HAS_TSC)
+    const Epoch& start = g_start;
+    constexpr auto kMinimumWindow = std::chrono::milliseconds(5);
+    auto elapsed = std::chrono::steady_clock::now() - start.time;
+    while (elapsed < kMinimumWindow) {
+        elapsed = std::chrono::steady_clock::now() - start.time;
+    }
+    uint64_t ticks = now() - start.ticks;
+    double nanoseconds = std::chrono::duration<double, std::nano>(elapsed).count();
+    return ticks == 0 ? 1.0 : nanoseconds / static_cast<double>(ticks);
+#else
+    return 1.0;
+#endif
+}
+
+void writeEscaped(std::ostream& out, const char* text) {
+    static constexpr char kHex[] = "0123456789abcdef";
+    for (const char* c = text; *c; ++c) {
+        auto byte = static_cast<unsigned char>(*c);
+        if (byte == '"' || byte == '\\') {
+            out << '\\' << *c;
+        } else if (byte < 0x20) {
+            out << "\\u00" << kHex[byte >> 4] << kHex[byte & 0xf];
+        } else {
+            out << *c;
+        }
+    }
+}
+
+}  // namespace
+
+namespace detail {
+
+void record(const char* name, uint64_t begin, uint64_t end) noexcept {
+    ThreadBuffer* buffer = t_buffer;
+    if (!buffer && !(buffer = registerThread())) {
+        return;
+    }
+    uint64_t index = buffer->head.load(std::memory_order_relaxed);
+    // Orders the previous head store before the slot stores, so a reader that
+    // sees the new slot contents also sees that the slot was being reused
+    std::atomic_thread_fence(std::memory_order_release);
+    Slot& slot = buffer->slots[index & (kEventsPerThread - 1)];
+    slot.name.store(name, std::memory_order_relaxed);
+    slot.begin.store(begin, std::memory_order_relaxed);
+    slot.end.store(end, std::memory_order_relaxed);
+    buffer->head.store(index + 1, std::memory_order_release);
+}
+
+}  // namespace detail
+
+void setEnabled(bool on) noexcept {
+    detail::g_enabled.store(on, std::memory_order_relaxed);
+}
+
+std::vector<TraceEvent> collect() {
+    const double ns_per_tick = nanosecondsPerTick();
+    const uint64_t epoch_ticks = g_start.ticks;
+    auto toNanoseconds = [ns_per_tick](uint64_t ticks) {
+        return static_cast<uint64_t>(static_cast<double>(ticks) * ns_per_tick);
+    };
+
+    Registry& reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    std::vector<TraceEvent> events;
+    for (const auto& buffer : reg.buffers) {
+        uint64_t head = buffer->head.load(std::memory_order_acquire);
+        uint64_t first = std::max(buffer->cleared.load(std::memory_order_relaxed),
+                                  head > kEventsPerThread ? head - kEventsPerThread : 0);
+        size_t copied_from = events.size();
+        for (uint64_t i = first; i < head; ++i) {
+            const Slot& slot = buffer->slots[i & (kEventsPerThread - 1)];
+            TraceEvent event;
+            event.name = slot.name.load(std::memory_order_relaxed);
+            uint64_t begin = slot.begin.load(std::memory_order_relaxed);
+            uint64_t end = slot.end.load(std::memory_order_relaxed);
+            event.thread = buffer->thread;
+            event.begin_ns = begin > epoch_ticks ? toNanoseconds(begin - epoch_ticks) : 0;
+            event.duration_ns = end > begin ? toNanoseconds(end - begin) : 0;
+            events.push_back(event);
+        }
+
+        buffer->collected = head;
+
+        // Drop the oldest copies if the owner has since started overwriting them
+        std::atomic_thread_fence(std::memory_order_acquire);
+        uint64_t head_after = buffer->head.load(std::memory_order_relaxed);
+        if (head_after + 1 > first + kEventsPerThread) {
+            uint64_t stale = std::min(head_after + 1 - kEventsPerThread - first, head - first);
+            events.erase(events.begin() + static_cast<std::ptrdiff_t>(copied_from),
+                         events.begin() + static_cast<std::ptrdiff_t>(copied_from + stale));
+        }
+    }
+    return events;
+}
+
+size_t bufferCount() noexcept {
+    Registry& reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    return reg.buffers.size();
+}
+
+void clear() noexcept {
+    Registry& reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    for (const auto& buffer : reg.buffers) {
+        buffer->cleared.store(buffer->head.load(std::memory_order_acquire),
+                              std::memory_order_relaxed);
+    }
+}
+
+void writeChromeTrace(std::ostream& out) {
+    std::vector<TraceEvent> events = collect();
+    std::ios_base::fmtflags flags = out.flags();
+    std::streamsize precision = out.precision();
+    out << std::fixed << std::setprecision(3);
+    out << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+    bool first = true;
+    for (const TraceEvent& event : events) {
+        out << (first ? "\n" : ",\n") << "{\"name\":\"";
+        writeEscaped(out, event.name ? event.name : "");
+        // Chrome trace times are microseconds
+        out << "\",\"cat\":\"cpp-template\",\"ph\":\"X\",\"pid\":1,\"tid\":" << event.thread
+            << ",\"ts\":" << static_cast<double>(event.begin_ns) / 1000.0
+            << ",\"dur\":" << static_cast<double>(event.duration_ns) / 1000.0 << '}';
+        first = false;
+    }
+    out << "\n]}\n";
+    out.flags(flags);
+    out.precision(precision);
+}
+
+bool writeChromeTrace(const std::string& path) {
+    std::ofstream file(path, std::ios::trunc);
+    if (!file) {
+        return false;
+    }
+    writeChromeTrace(file);
+    return static_cast<bool>(file.flush());
+}
+
+}  // namespace trace
+}  // namespace core
+}  // namespace cpp_template
@@ -1,59 +1,230 @@
 #include "core/utils.h"
-#include <algorithm>
-#include <cctype>
-#include <sstream>
+#include "core/memory_tracking.h"
+#include "core/string_batch.h"
+#include "core/tokenizer.h"
+#include "ascii_kernels.h"
 
 namespace cpp_template {
 namespace core {
 namespace utils {
 namespace string {
 
+namespace {
+
+template <typename Container>
+void joinInto(const Container& strings, std::string_view delimiter, std::string& output) {
+    if (strings.empty()) {
+        return;
+    }
+
+    size_t total = delimiter.size() * (strings.size() - 1);
+    for (const auto& part : strings) {
+        total += part.size();
+    }
+    output.reserve(output.size() + total);
+
+    output.append(strings[0]);
+    for (size_t i = 1; i < strings.size(); ++i) {
+        output.append(delimiter);
+        output.append(strings[i]);
+    }
+}
+
+}  // namespace
+
 std::string toUpper(const std::string& input) {
+    CORE_MEMORY_SCOPE(STRING_UTILS);
     std::string result = input;
-    std::transform(result.begin(), result.end(), result.begin(),
-                   [](unsigned char c) { return std::toupper(c); });
+    toUpperInPlace(result);
     return result;
 }
 
 std::string toLower(const std::string& input) {
+    CORE_MEMORY_SCOPE(STRING_UTILS);
     std::string result = input;
-    std::transform(result.begin(), result.end(), result.begin(),
-                   [](unsigned char c) { return std::tolower(c); });
+    toLowerInPlace(result);
     return result;
 }
 
 std::vector<std::string> split(const std::string& input, char delimiter) {
-    std::vector<std::string> result;
-    std::stringstream ss(input);
-    std::string item;
+    CORE_MEMORY_SCOPE(STRING_UTILS);
+    std::vector<std::string_view> parts;
+    split(input, delimiter, parts);
 
-    while (std::getline(ss, item, delimiter)) {
-        result.push_back(item);
-    }
+    return std::vector<std::string>(parts.begin(), parts.end());
+}
 
+std::string join(const std::vector<std::string>& strings, const std::string& delimiter) {
+    CORE_MEMORY_SCOPE(STRING_UTILS);
+    std::string result;
+    joinInto(strings, delimiter, result);
     return result;
 }
 
-std::string join(const std::vector<std::string>& strings, const std::string& delimiter) {
-    if (strings.empty()) {
-        return "";
+void toUpperInPlace(std::string& inout) {
+    detail::asciiKernels().to_upper(inout.data(), inout.size());
+}
+
+void toLowerInPlace(std::string& inout) {
+    detail::asciiKernels().to_lower(inout.data(), inout.size());
+}
+
+void toUpperInPlace(char* data, size_t length) {
+    detail::asciiKernels().to_upper(data, length);
+}
+
+void toLowerInPlace(char* data, size_t length) {
+    detail::asciiKernels().to_lower(data, length);
+}
+
+void toUpper(std::string_view input, std::string& output) {
+    CORE_MEMORY_SCOPE(STRING_UTILS);
+    output.assign(input);
+    toUpperInPlace(output);
+}
+
+void toLower(std::string_view input, std::string& output) {
+    CORE_MEMORY_SCOPE(STRING_UTILS);
+    output.assign(input);
+    toLowerInPlace(output);
+}
+
+size_t split(std::string_view input, char delimiter, std::vector<std::string_view>& output) {
+    CORE_MEMORY_SCOPE(STRING_UTILS);
+    output.clear();
+
+    // tokens() mirrors std::getline semantics: no trailing empty part after the last delimiter
+    for (std::string_view part : tokens(input, delimiter)) {
+        output.push_back(part);
     }
 
-    std::string result = strings[0];
-    for (size_t i = 1; i < strings.size(); ++i) {
-        result += delimiter + strings[i];
+    return output.size();
+}
+
+void join(const std::vector<std::string_view>& strings, std::string_view delimiter,
+          std::string& output) {
+    CORE_MEMORY_SCOPE(STRING_UTILS);
+    joinInto(strings, delimiter, output);
+}
+
+void join(const std::vector<std::string>& strings, std::string_view delimiter,
+          std::string& output) {
+    CORE_MEMORY_SCOPE(STRING_UTILS);
+    joinInto(strings, delimiter, output);
+}
+
+void toUpperInPlace(StringBatch& batch) {
+    detail::asciiKernels().to_upper(batch.data(), batch.bytes());
+}
+
+void toLowerInPlace(StringBatch& batch) {
+    detail::asciiKernels().to_lower(batch.data(), batch.bytes());
+}
+
+void toUpper(const StringBatch& input, StringBatch& output) {
+    CORE_MEMORY_SCOPE(STRING_UTILS);
+    output = input;
+    toUpperInPlace(output);
+}
+
+void toLower(const StringBatch& input, StringBatch& output) {
+    CORE_MEMORY_SCOPE(STRING_UTILS);
+    output = input;
+    toLowerInPlace(output);
+}
+
+void trim(const StringBatch& input, StringBatch& output, std::string_view characters) {
+    CORE_MEMORY_SCOPE(STRING_UTILS);
+    if (&input == &output) {
+        StringBatch trimmed;
+        trim(input, trimmed, characters);
+        output = std::move(trimmed);
+        return;
     }
 
-    return result;
+    output.clear();
+    output.reserve(input.size(), input.bytes());
+    for (std::string_view text : input) {
+        size_t first = text.find_first_not_of(characters);
+        if (first == std::string_view::npos) {
+            output.append({});
+            continue;
+        }
+        size_t last = text.find_last_not_of(characters);
+        output.append(text.substr(first, last - first + 1));
+    }
+}
+
+size_t split(std::string_view input, char delimiter, StringBatch& output) {
+    CORE_MEMORY_SCOPE(STRING_UTILS);
+    output.clear();
+    output.reserve(0, input.size());
+    for (std::string_view part : tokens(input, delimiter)) {
+        output.append(part);
+    }
+    return output.size();
+}
+
+void join(const StringBatch& strings, std::string_view delimiter, std::string& output) {
+    CORE_MEMORY_SCOPE(STRING_UTILS);
+    if (strings.empty()) {
+        return;
+    }
+
+    output.reserve(output.size() + strings.bytes() + delimiter.size() * (strings.size() - 1));
+    bool first = true;
+    for (std::string_view text : strings) {
+        if (!first) {
+            output.append(delimiter);
+        }
+        first = false;
+        output.append(text);
+    }
 }
 
 }  // namespace string
 
 namespace validation {
 
+namespace {
+
+// Character classes of the email pattern, one bit per class
+enum EmailCharClass : unsigned char {
+    kEmailLocal = 1 << 0,   // [a-zA-Z0-9._%+-]
+    kEmailDomain = 1 << 1,  // [a-zA-Z0-9.-]
+    kEmailAlpha = 1 << 2,   // [a-zA-Z]
+};
+
+struct EmailCharTable {
+    unsigned char classes[256];
+};
+
+constexpr EmailCharTable makeEmailCharTable() {
+    EmailCharTable table{};
+    for (int c = 0; c < 256; ++c) {
+        bool alpha = (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+        bool digit = c >= '0' && c <= '9';
+        unsigned char bits = 0;
+        if (alpha || digit || c == '.' || c == '-') {
+            bits |= kEmailLocal | kEmailDomain;
+        }
+        if (c == '_' || c == '%' || c == '+') {
+            bits |= kEmailLocal;
+        }
+        if (alpha) {
+            bits |= kEmailAlpha;
+        }
+        table.classes[c] = bits;
+    }
+    return table;
+}
+
+constexpr EmailCharTable kEmailChars = makeEmailCharTable();
+
+}  // namespace
+
 bool isEmpty(const std::string& input) {
-    return input.empty() ||
-           std::all_of(input.begin(), input.end(), [](unsigned char c) { return std::isspace(c); });
+    return input.empty() || detail::asciiKernels().all_space(input.data(), input.size());
 }
 
 bool isAlphanumeric(const std::string& input) {
@@ -61,7 +232,58 @@ bool isAlphanumeric(const std::string& input) {
         return false;
     }
 
-    return std::all_of(input.begin(), input.end(), [](unsigned char c) { return std::isalnum(c); });
+    return detail::asciiKernels().all_alnum(input.data(), input.size());
+}
+
+bool isValidEmail(std::string_view email) noexcept {
+    const size_t size = email.size();
+    size_t i = 0;
+
+    // Local part: one or more [a-zA-Z0-9._%+-], terminated by '@'
+    while (i < size && (kEmailChars.classes[static_cast<unsigned char>(email[i])] & kEmailLocal)) {
+        ++i;
+    }
+    if (i == 0 || i == size || email[i] != '@') {
+        return false;
+    }
+    const size_t domain_start = ++i;
+
+    // Domain: [a-zA-Z0-9.-]+ '.' [a-zA-Z]{2,}. The TLD cannot contain a dot, so
+    // it is whatever follows the last dot; track that dot and the TLD shape.
+    size_t last_dot = std::string_view::npos;
+    size_t tld_length = 0;
+    bool tld_alpha = false;
+    for (; i < size; ++i) {
+        unsigned char bits = kEmailChars.classes[static_cast<unsigned char>(email[i])];
+        if (!(bits & kEmailDomain)) {
+            return false;
+        }
+        if (email[i] == '.') {
+            last_dot = i;
+            tld_length = 0;
+            tld_alpha = true;
+        } else {
+            ++tld_length;
+            tld_alpha = tld_alpha && (bits & kEmailAlpha);
+        }
+    }
+
+    return last_dot != std::string_view::npos && last_dot > domain_start && tld_alpha &&
+           tld_length >= 2;
+}
+
+size_t validateEmails(const std::vector<std::string_view>& emails,
+                      std::vector<unsigned char>& results) {
+    CORE_MEMORY_SCOPE(STRING_UTILS);
+    results.resize(emails.size());
+
+    size_t valid = 0;
+    for (size_t i = 0; i < emails.size(); ++i) {
+        bool ok = isValidEmail(emails[i]);
+        results[i] = ok ? 1 : 0;
+        valid += ok ? 1 : 0;
+    }
+    return valid;
 }
 
 }  // namespace validation
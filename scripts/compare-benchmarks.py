@@ -0,0 +1,301 @@
+#!/usr/bin/env python3
+# =============================================================================
+# compare-benchmarks.py - Benchmark Regression Check
+# Compares Google Benchmark JSON results against a stored baseline
+#
+# For every benchmark present in both files, the per-repetition times are
+# compared with a two-sided Mann-Whitney U test. A benchmark regresses when
+# its median got slower by more than the threshold AND the difference is
+# statistically significant (p < alpha). With fewer than --min-repetitions
+# samples on either side the threshold alone decides. A benchmark of the
+# baseline that is missing from the current results, or reported an error
+# there, also fails the check; --allow-missing accepts missing ones.
+#
+# Both inputs must keep the per-repetition entries, i.e. be written with
+# --benchmark_repetitions=N and NOT --benchmark_report_aggregates_only.
+# Benchmarks using UseRealTime() are compared on real time, all others on
+# CPU time.
+#
+# Usage:
+#   ./scripts/compare-benchmarks.py BASELINE.json CURRENT.json [options]
+#   ./scripts/compare-benchmarks.py BASELINE.json --run BENCHMARK_BINARY [options]
+#
+# Options:
+#   --run BINARY            Run the benchmark binary instead of reading CURRENT
+#   --filter REGEX          Benchmarks to run and compare (default: all)
+#   --repetitions N         Repetitions per benchmark with --run (default: 10)
+#   --min-time SECONDS      Minimum time per repetition with --run (default: 0.05)
+#   --threshold FRACTION    Allowed median slowdown, e.g. 0.10 for 10% (default: 0.10)
+#   --threshold-for R=F     Threshold F for benchmarks matching regex R (repeatable;
+#                           the last match wins)
+#   --alpha P               Significance level (default: 0.05)
+#   --min-repetitions N     Samples needed for the significance test (default: 5)
+#   --allow-missing         Do not fail on baseline benchmarks absent from CURRENT
+#   --json-out FILE         Write a machine-readable report
+#
+# Exit codes: 0 no regression, 1 regression or missing/failed benchmark,
+#             2 usage or input error,
+#             77 baseline missing (CTest SKIP_RETURN_CODE)
+# =============================================================================
+
+import argparse
+import json
+import math
+import os
+import re
+import subprocess
+import sys
+import tempfile
+
+EXIT_OK = 0
+EXIT_REGRESSION = 1
+EXIT_ERROR = 2
+EXIT_SKIPPED = 77
+
+TIME_UNIT_NS = {"ns": 1.0, "us": 1e3, "ms": 1e6, "s": 1e9}
+
+
+def load_samples(path, name_filter):
+    """Map benchmark name to its per-repetition times in nanoseconds.
+
+    Also returns the names of benchmarks that reported an error."""
+    with open(path, encoding="utf-8") as file:
+        data = json.load(file)
+
+    samples = {}
+    errors = set()
+    for entry in data.get("benchmarks", []):
+        if entry.get("run_type", "iteration") != "iteration":
+            continue
+        name = entry.get("run_name", entry["name"])
+        if name_filter and not name_filter.search(name):
+            continue
+        if entry.get("error_occurred"):
+            errors.add(name)
+            continue
+        metric = "real_time" if "/real_time" in name else "cpu_time"
+        scale = TIME_UNIT_NS.get(entry.get("time_unit", "ns"), 1.0)
+        samples.setdefault(name, []).append(float(entry[metric]) * scale)
+    return samples, errors
+
+
+def median(values):
+    ordered = sorted(values)
+    middle = len(ordered) // 2
+    if len(ordered) % 2:
+        return ordered[middle]
+    return (ordered[middle - 1] + ordered[middle]) / 2.0
+
+
+def mann_whitney_p(first, second):
+    """Two-sided p-value of the Mann-Whitney U test (normal approximation, tie-corrected)."""
+    n1, n2 = len(first), len(second)
+    combined = sorted([(value, 0) for value in first] + [(value, 1) for value in second])
+    total = n1 + n2
+
+    rank_sum = 0.0
+    tie_term = 0.0
+    index = 0
+    while index < total:
+        end = index
+        while end + 1 < total and combined[end + 1][0] == combined[index][0]:
+            end += 1
+        average_rank = (index + end) / 2.0 + 1.0
+        ties = end - index + 1
+        tie_term += ties**3 - ties
+        rank_sum += average_rank * sum(1 for k in range(index, end + 1) if combined[k][1] == 0)
+        index = end + 1
+
+    u = rank_sum - n1 * (n1 + 1) / 2.0
+    mean = n1 * n2 / 2.0
+    variance = n1 * n2 / 12.0 * ((total + 1) - tie_term / (total * (total - 1)))
+    if variance <= 0:
+        return 1.0
+    z = max(abs(u - mean) - 0.5, 0.0) / math.sqrt(variance)
+    return math.erfc(z / math.sqrt(2.0))
+
+
+def threshold_for(name, default, overrides):
+    threshold = default
+    for pattern, value in overrides:
+        if pattern.search(name):
+            threshold = value
+    return threshold
+
+
+def compare(baseline, current, current_errors, args, overrides):
+    """Classify every benchmark; returns the report rows."""
+    rows = []
+    for name in sorted(set(baseline) | set(current) | current_errors):
+        row = {"name": name}
+        if name in current_errors:
+            row["status"] = "error"
+            rows.append(row)
+            continue
+        if name not in current:
+            row["status"] = "missing"
+            rows.append(row)
+            continue
+        if name not in baseline:
+            row["status"] = "new"
+            rows.append(row)
+            continue
+
+        base, cur = baseline[name], current[name]
+        base_median, cur_median = median(base), median(cur)
+        change = (cur_median - base_median) / base_median if base_median > 0 else 0.0
+        threshold = threshold_for(name, args.threshold, overrides)
+        tested = min(len(base), len(cur)) >= args.min_repetitions
+        p_value = mann_whitney_p(base, cur) if tested else None
+        significant = p_value < args.alpha if tested else True
+
+        if change > threshold and significant:
+            status = "regression"
+        elif change < -threshold and significant:
+            status = "improvement"
+        else:
+            status = "ok"
+
+        row.update({
+            "status": status,
+            "baseline_median_ns": base_median,
+            "current_median_ns": cur_median,
+            "baseline_repetitions": len(base),
+            "current_repetitions": len(cur),
+            "change": change,
+            "threshold": threshold,
+            "p_value": p_value,
+        })
+        rows.append(row)
+    return rows
+
+
+def run_benchmarks(args, output_path):
+    command = [
+        args.run,
+        "--benchmark_repetitions=%d" % args.repetitions,
+        "--benchmark_min_time=%s" % args.min_time,
+        "--benchmark_display_aggregates_only=true",
+        "--benchmark_enable_random_interleaving=true",
+        "--benchmark_out=%s" % output_path,
+        "--benchmark_out_format=json",
+    ]
+    if args.filter:
+        command.append("--benchmark_filter=%s" % args.filter)
+    print("Running: " + " ".join(command), flush=True)
+    return subprocess.run(command, check=False).returncode
+
+
+def failing(row, args):
+    """Whether a row fails the check."""
+    if row["status"] == "missing":
+        return not args.allow_missing
+    return row["status"] in ("regression", "error")
+
+
+def print_report(rows, args):
+    width = max([len(row["name"]) for row in rows] + [10])
+    print()
+    print("%-*s %14s %14s %9s %9s  %s" %
+          (width, "Benchmark", "Baseline", "Current", "Change", "p-value", "Status"))
+    print("-" * (width + 65))
+    for row in rows:
+        if "change" not in row:
+            print("%-*s %14s %14s %9s %9s  %s" % (width, row["name"], "-", "-", "-", "-",
+                                                  row["status"]))
+            continue
+        p_value = "-" if row["p_value"] is None else "%.4f" % row["p_value"]
+        print("%-*s %12.1fns %12.1fns %+8.1f%% %9s  %s" %
+              (width, row["name"], row["baseline_median_ns"], row["current_median_ns"],
+               row["change"] * 100.0, p_value, row["status"]))
+
+    regressions = [row for row in rows if row["status"] == "regression"]
+    print()
+    print("%d compared, %d regressed (threshold %.1f%%, alpha %.3f)" %
+          (sum(1 for row in rows if "change" in row), len(regressions), args.threshold * 100.0,
+           args.alpha))
+    missing = sum(1 for row in rows if row["status"] == "missing")
+    errors = sum(1 for row in rows if row["status"] == "error")
+    if missing or errors:
+        print("%d missing from the current run%s, %d failed" %
+              (missing, " (allowed)" if args.allow_missing else "", errors))
+
+
+def parse_override(text):
+    pattern, separator, value = text.rpartition("=")
+    if not separator or not pattern:
+        raise argparse.ArgumentTypeError("expected REGEX=FRACTION, got '%s'" % text)
+    try:
+        return re.compile(pattern), float(value)
+    except (re.error, ValueError) as error:
+        raise argparse.ArgumentTypeError("invalid override '%s': %s" % (text, error))
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Compare Google Benchmark results against a stored baseline")
+    parser.add_argument("baseline", help="Baseline JSON written by the benchmark suite")
+    parser.add_argument("current", nargs="?", help="Current JSON (omit with --run)")
+    parser.add_argument("--run", metavar="BINARY", help="Run this benchmark binary")
+    parser.add_argument("--filter", default="", help="Benchmarks to run and compare")
+    parser.add_argument("--repetitions", type=int, default=10)
+    parser.add_argument("--min-time", default="0.05")
+    parser.add_argument("--threshold", type=float, default=0.10)
+    parser.add_argument("--threshold-for", type=parse_override, action="append", default=[],
+                        metavar="REGEX=FRACTION")
+    parser.add_argument("--alpha", type=float, default=0.05)
+    parser.add_argument("--min-repetitions", type=int, default=5)
+    parser.add_argument("--allow-missing", action="store_true",
+                        help="Do not fail on baseline benchmarks absent from the current run")
+    parser.add_argument("--json-out", metavar="FILE")
+    args = parser.parse_args()
+
+    if bool(args.current) == bool(args.run):
+        parser.error("give either CURRENT or --run BINARY")
+    if not os.path.isfile(args.baseline):
+        print("No baseline at %s; build the benchmark_baseline target to record one" %
+              args.baseline)
+        return EXIT_SKIPPED
+
+    name_filter = re.compile(args.filter) if args.filter else None
+    try:
+        if args.run:
+            with tempfile.TemporaryDirectory() as directory:
+                current_path = os.path.join(directory, "current.json")
+                if run_benchmarks(args, current_path) != 0:
+                    print("Benchmark binary failed", file=sys.stderr)
+                    return EXIT_ERROR
+                current, current_errors = load_samples(current_path, name_filter)
+        else:
+            current, current_errors = load_samples(args.current, name_filter)
+        baseline, _ = load_samples(args.baseline, name_filter)
+    except (OSError, ValueError, KeyError) as error:
+        print("Cannot read benchmark results: %s" % error, file=sys.stderr)
+        return EXIT_ERROR
+
+    rows = compare(baseline, current, current_errors, args, args.threshold_for)
+    print_report(rows, args)
+
+    if args.json_out:
+        report = {
+            "baseline": os.path.abspath(args.baseline),
+            "threshold": args.threshold,
+            "alpha": args.alpha,
+            "min_repetitions": args.min_repetitions,
+            "regressions": sum(1 for row in rows if row["status"] == "regression"),
+            "missing": sum(1 for row in rows if row["status"] == "missing"),
+            "errors": sum(1 for row in rows if row["status"] == "error"),
+            "allow_missing": args.allow_missing,
+            "benchmarks": rows,
+        }
+        with open(args.json_out, "w", encoding="utf-8") as file:
+            json.dump(report, file, indent=2)
+            file.write("\n")
+
+    if any(failing(row, args) for row in rows):
+        return EXIT_REGRESSION
+    return EXIT_OK
+
+
+if __name__ == "__main__":
+    sys.exit(main())
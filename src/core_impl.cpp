@@ -1,10 +1,12 @@
+#include <new>
 #include <stdexcept>
+#include <utility>
 #include "core/core.h"  // Internal core library
 #include "cpp-template/core.h"
 
 namespace cpp_template {
 
-// PIMPL implementation class
+// PIMPL implementation class, constructed in Core::storage_
 class Core::Impl {
   public:
     explicit Impl(const std::string& name) : internal_core_(name) {}
@@ -12,44 +14,75 @@ class Core::Impl {
     core::Core internal_core_;
 };
 
-Core::Core(const std::string& name) : pImpl_(std::make_unique<Impl>(name)) {}
+Core::Core(const std::string& name) {
+    static_assert(sizeof(core::Core) <= kImplSize && sizeof(Impl) <= kImplSize,
+                  "Core::kImplSize is too small for core::Core; raising it changes the ABI");
+    static_assert(alignof(Impl) <= kImplAlignment, "Core::Impl is over-aligned for its storage");
+    new (storage_) Impl(name);
+}
 
-Core::~Core() = default;
+Core::~Core() {
+    impl().~Impl();
+}
 
-Core::Core(const Core& other)
-    : pImpl_(std::make_unique<Impl>(other.pImpl_->internal_core_.getName())) {
-    pImpl_->internal_core_ = other.pImpl_->internal_core_;
+Core::Core(const Core& other) {
+    new (storage_) Impl(other.impl());
 }
 
 Core& Core::operator=(const Core& other) {
     if (this != &other) {
-        pImpl_ = std::make_unique<Impl>(other.pImpl_->internal_core_.getName());
-        pImpl_->internal_core_ = other.pImpl_->internal_core_;
+        impl() = other.impl();
+    }
+    return *this;
+}
+
+Core::Core(Core&& other) noexcept {
+    new (storage_) Impl(std::move(other.impl()));
+}
+
+Core& Core::operator=(Core&& other) noexcept {
+    if (this != &other) {
+        impl() = std::move(other.impl());
     }
     return *this;
 }
 
-Core::Core(Core&& other) noexcept = default;
-Core& Core::operator=(Core&& other) noexcept = default;
+Core::Impl& Core::impl() noexcept {
+    return *std::launder(reinterpret_cast<Impl*>(storage_));
+}
+
+const Core::Impl& Core::impl() const noexcept {
+    return *std::launder(reinterpret_cast<const Impl*>(storage_));
+}
 
 const std::string& Core::getName() const {
-    return pImpl_->internal_core_.getName();
+    return impl().internal_core_.getName();
 }
 
 void Core::setName(const std::string& name) {
-    pImpl_->internal_core_.setName(name);
+    impl().internal_core_.setName(name);
 }
 
 std::string Core::process(const std::string& input) const {
-    return pImpl_->internal_core_.process(input);
+    return impl().internal_core_.process(input);
+}
+
+void Core::processMany(const std::string_view* inputs, size_t count,
+                       const ProcessedSink& sink) const {
+    impl().internal_core_.processMany(inputs, count, sink);
+}
+
+void Core::processMany(const std::vector<std::string_view>& inputs,
+                       const ProcessedSink& sink) const {
+    impl().internal_core_.processMany(inputs.data(), inputs.size(), sink);
 }
 
 bool Core::initialize() {
-    return pImpl_->internal_core_.initialize();
+    return impl().internal_core_.initialize();
 }
 
 bool Core::isInitialized() const {
-    return pImpl_->internal_core_.isInitialized();
+    return impl().internal_core_.isInitialized();
 }
 
 std::unique_ptr<Core> createCore(const std::string& name) {
@@ -1,12 +1,177 @@
 // Main application entry point
-// Demonstrates usage of the cpp-template library
+// Demonstrates usage of the cpp-template library, or processes a file with
+//   cpp-template process --mode advanced --in input.txt --out output.txt
+// or precompiles a configuration file for ConfigManager::loadFromImage() with
+//   cpp-template compile-config --in app.conf --out app.cfgimg
 
 #include <cpp-template/cpp-template.h>
+#include <charconv>
+#include <chrono>
+#include <cstring>
 #include <iostream>
+#include <memory>
+#include <string>
 #include "modules/config_manager.h"
 #include "modules/data_processor.h"
+#include "modules/file_processor.h"
+
+namespace {
+
+// Parse a whole decimal argument no smaller than minimum
+bool parseCount(const char* text, int minimum, int& value) {
+    const char* end = text + std::strlen(text);
+    auto parsed = std::from_chars(text, end, value);
+    return parsed.ec == std::errc() && parsed.ptr == end && value >= minimum;
+}
+
+void printProcessUsage(std::ostream& out) {
+    out << "Usage: cpp-template process --in FILE --out FILE [options]\n"
+        << "Processes every non-empty line of the input file into one output line.\n\n"
+        << "Options:\n"
+        << "  --mode MODE     simple, advanced or batch (default: batch)\n"
+        << "  --threads N     worker threads, 0 for one per usable CPU (default: 0)\n"
+        << "  --window N      lines processed per parallel window (default: 65536)\n"
+        << "  --stats         print processing statistics to stderr\n";
+}
+
+// Returns the process exit code: 0 on success, 1 on failure, 2 on bad arguments
+int runProcess(int argc, char* argv[]) {
+    cpp_template::modules::FileProcessOptions options;
+    std::string input_path;
+    std::string output_path;
+    int threads = 0;
+    int window = 65536;
+    bool print_stats = false;
+
+    for (int i = 2; i < argc; ++i) {
+        const char* arg = argv[i];
+        if (std::strcmp(arg, "--help") == 0 || std::strcmp(arg, "-h") == 0) {
+            printProcessUsage(std::cout);
+            return 0;
+        }
+        if (std::strcmp(arg, "--stats") == 0) {
+            print_stats = true;
+            continue;
+        }
+        if (i + 1 >= argc) {
+            std::cerr << "Error: unknown option or missing value: " << arg << "\n";
+            printProcessUsage(std::cerr);
+            return 2;
+        }
+        const char* value = argv[++i];
+        if (std::strcmp(arg, "--in") == 0) {
+            input_path = value;
+        } else if (std::strcmp(arg, "--out") == 0) {
+            output_path = value;
+        } else if (std::strcmp(arg, "--threads") == 0) {
+            if (!parseCount(value, 0, threads)) {
+                std::cerr << "Error: --threads needs a count of 0 or more\n";
+                return 2;
+            }
+        } else if (std::strcmp(arg, "--window") == 0) {
+            if (!parseCount(value, 1, window)) {
+                std::cerr << "Error: --window needs a positive count\n";
+                return 2;
+            }
+        } else if (std::strcmp(arg, "--mode") == 0) {
+            if (!cpp_template::modules::parseProcessingMode(value, options.mode)) {
+                std::cerr << "Error: unknown mode: " << value << "\n";
+                return 2;
+            }
+        } else {
+            std::cerr << "Error: unknown option: " << arg << "\n";
+            printProcessUsage(std::cerr);
+            return 2;
+        }
+    }
+    if (input_path.empty() || output_path.empty()) {
+        std::cerr << "Error: --in and --out are required\n";
+        printProcessUsage(std::cerr);
+        return 2;
+    }
+
+    std::shared_ptr<cpp_template::modules::ConfigManager> config_manager(
+        cpp_template::modules::createConfigManager());
+    auto data_processor = cpp_template::modules::createDataProcessor(config_manager);
+    data_processor->setProcessingConfig("threads", std::to_string(threads));
+    data_processor->setProcessingConfig("stream_buffer", std::to_string(window));
+
+    auto start = std::chrono::steady_clock::now();
+    auto result =
+        cpp_template::modules::processFile(*data_processor, input_path, output_path, options);
+    auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start);
+
+    if (!result.success) {
+        std::cerr << "Error: " << result.error_message << "\n";
+        return 1;
+    }
+    std::cerr << "Processed " << result.processed_items << " records in " << elapsed.count()
+              << " s\n";
+    if (print_stats) {
+        std::cerr << data_processor->getStatistics() << "\n";
+    }
+    return 0;
+}
+
+void printCompileConfigUsage(std::ostream& out) {
+    out << "Usage: cpp-template compile-config --in FILE --out FILE\n"
+        << "Compiles a key=value configuration file into a binary config image\n"
+        << "that ConfigManager::loadFromImage() maps without parsing.\n";
+}
+
+// Returns the process exit code: 0 on success, 1 on failure, 2 on bad arguments
+int runCompileConfig(int argc, char* argv[]) {
+    std::string input_path;
+    std::string output_path;
+    for (int i = 2; i < argc; ++i) {
+        const char* arg = argv[i];
+        if (std::strcmp(arg, "--help") == 0 || std::strcmp(arg, "-h") == 0) {
+            printCompileConfigUsage(std::cout);
+            return 0;
+        }
+        if (i + 1 < argc && std::strcmp(arg, "--in") == 0) {
+            input_path = argv[++i];
+        } else if (i + 1 < argc && std::strcmp(arg, "--out") == 0) {
+            output_path = argv[++i];
+        } else {
+            std::cerr << "Error: unknown option or missing value: " << arg << "\n";
+            printCompileConfigUsage(std::cerr);
+            return 2;
+        }
+    }
+    if (input_path.empty() || output_path.empty()) {
+        std::cerr << "Error: --in and --out are required\n";
+        printCompileConfigUsage(std::cerr);
+        return 2;
+    }
+
+    cpp_template::modules::ConfigManager config;
+    if (!config.loadFromFile(input_path)) {
+        return 1;
+    }
+    if (!config.saveImage(output_path)) {
+        std::cerr << "Error: Could not write config image: " << output_path << "\n";
+        return 1;
+    }
+    std::cerr << "Compiled " << config.snapshot()->size() << " keys into " << output_path
+              << "\n";
+    return 0;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    if (argc > 1 && (std::strcmp(argv[1], "process") == 0 ||
+                     std::strcmp(argv[1], "compile-config") == 0)) {
+        try {
+            return std::strcmp(argv[1], "process") == 0 ? runProcess(argc, argv)
+                                                        : runCompileConfig(argc, argv);
+        } catch (const std::exception& e) {
+            std::cerr << "Error: " << e.what() << std::endl;
+            return 1;
+        }
+    }
 
-int main() {
     std::cout << "=== " << cpp_template::info::getName() << " v" << cpp_template::info::getVersion()
               << " ===" << std::endl;
     std::cout << cpp_template::info::getDescription() << std::endl << std::endl;
@@ -0,0 +1,491 @@
+#pragma once
+
+/**
+ * @file async_processor.h
+ * @brief Asynchronous front end for DataProcessor with a pluggable executor
+ *
+ * Translation units compiled as C++20 get a coroutine interface:
+ *
+ *     Task<ProcessingResult> handle(AsyncDataProcessor& async, std::string line) {
+ *         ProcessingResult result = co_await async.processItemAsync(std::move(line));
+ *         co_return result;
+ *     }
+ *
+ *     auto batch = async.processBatchAsync(std::move(lines));
+ *     while (const ProcessingResult* result = co_await batch.next()) { ... }
+ *
+ * Earlier standards get the same member names returning std::future objects
+ * (one per batch item, in input order). CPP_TEMPLATE_HAS_COROUTINES tells
+ * which interface is available. Work always runs on the executor; nothing
+ * blocks the awaiting thread.
+ */
+
+#include <core/thread_pool.h>
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+#include "data_processor.h"
+
+#if defined(__cpp_impl_coroutine) && __cpp_impl_coroutine >= 201902L && __has_include(<coroutine>)
+#include <chrono>
+#include <condition_variable>
+#include <coroutine>
+#include <mutex>
+#define CPP_TEMPLATE_HAS_COROUTINES 1
+#else
+#define CPP_TEMPLATE_HAS_COROUTINES 0
+#endif
+
+namespace cpp_template {
+namespace modules {
+
+/**
+ * @brief Where asynchronous processing work runs
+ *
+ * Implement this to run work on an event loop or an existing thread pool.
+ */
+class Executor {
+  public:
+    virtual ~Executor() = default;
+
+    /**
+     * @brief Run a unit of work, now or later, on some thread
+     *
+     * @param work The work to run exactly once
+     */
+    virtual void execute(std::function<void()> work) = 0;
+};
+
+/**
+ * @brief Executor that runs work immediately on the calling thread
+ */
+class InlineExecutor : public Executor {
+  public:
+    void execute(std::function<void()> work) override { work(); }
+};
+
+/**
+ * @brief Executor that submits work to a core::ThreadPool
+ */
+class ThreadPoolExecutor : public Executor {
+  public:
+    /**
+     * @brief Construct a new Thread Pool Executor object
+     *
+     * @param pool The pool to submit to; must outlive the executor
+     */
+    explicit ThreadPoolExecutor(core::ThreadPool& pool) : pool_(pool) {}
+
+    void execute(std::function<void()> work) override { pool_.submit(std::move(work)); }
+
+  private:
+    core::ThreadPool& pool_;
+};
+
+#if CPP_TEMPLATE_HAS_COROUTINES
+
+/**
+ * @brief Awaitable that continues the awaiting coroutine on an executor
+ *
+ * @param executor The executor to resume on
+ * @return auto The awaitable
+ */
+inline auto schedule(Executor& executor) {
+    struct Awaiter {
+        Executor& executor;
+
+        bool await_ready() const noexcept { return false; }
+        void await_suspend(std::coroutine_handle<> handle) {
+            executor.execute([handle] { handle.resume(); });
+        }
+        void await_resume() const noexcept {}
+    };
+    return Awaiter{executor};
+}
+
+/**
+ * @brief Lazily started coroutine producing one value
+ *
+ * The body starts when the task is awaited and the awaiting coroutine
+ * resumes on whichever thread the body finishes on.
+ *
+ * @tparam T The result type
+ */
+template <typename T>
+class Task {
+  public:
+    struct promise_type {
+        std::optional<T> value;
+        std::exception_ptr error;
+        std::coroutine_handle<> continuation;
+
+        Task get_return_object() {
+            return Task(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+        std::suspend_always initial_suspend() noexcept { return {}; }
+        auto final_suspend() noexcept {
+            struct FinalAwaiter {
+                bool await_ready() const noexcept { return false; }
+                std::coroutine_handle<> await_suspend(
+                    std::coroutine_handle<promise_type> handle) noexcept {
+                    auto continuation = handle.promise().continuation;
+                    return continuation ? continuation : std::noop_coroutine();
+                }
+                void await_resume() const noexcept {}
+            };
+            return FinalAwaiter{};
+        }
+        template <typename U>
+        void return_value(U&& result) {
+            value.emplace(std::forward<U>(result));
+        }
+        void unhandled_exception() noexcept { error = std::current_exception(); }
+    };
+
+    Task(Task&& other) noexcept : handle_(std::exchange(other.handle_, nullptr)) {}
+    Task& operator=(Task&& other) noexcept {
+        if (this != &other) {
+            destroy();
+            handle_ = std::exchange(other.handle_, nullptr);
+        }
+        return *this;
+    }
+    ~Task() { destroy(); }
+
+    Task(const Task&) = delete;
+    Task& operator=(const Task&) = delete;
+
+    bool await_ready() const noexcept { return false; }
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept {
+        handle_.promise().continuation = awaiting;
+        return handle_;
+    }
+    T await_resume() {
+        auto& promise = handle_.promise();
+        if (promise.error) {
+            std::rethrow_exception(promise.error);
+        }
+        return std::move(*promise.value);
+    }
+
+  private:
+    explicit Task(std::coroutine_handle<promise_type> handle) : handle_(handle) {}
+
+    void destroy() {
+        if (handle_) {
+            handle_.destroy();
+        }
+    }
+
+    std::coroutine_handle<promise_type> handle_;
+};
+
+/**
+ * @brief Coroutine producing a sequence of values asynchronously
+ *
+ * Consumers call `co_await next()` repeatedly; it yields a pointer to the
+ * next value (valid until the following next()) or nullptr at the end.
+ *
+ * @tparam T The element type
+ */
+template <typename T>
+class AsyncGenerator {
+  public:
+    struct promise_type {
+        const T* current = nullptr;
+        std::exception_ptr error;
+        std::coroutine_handle<> consumer;
+
+        AsyncGenerator get_return_object() {
+            return AsyncGenerator(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+        std::suspend_always initial_suspend() noexcept { return {}; }
+        auto final_suspend() noexcept {
+            current = nullptr;
+            return yieldToConsumer();
+        }
+        auto yield_value(const T& value) noexcept {
+            current = std::addressof(value);
+            return yieldToConsumer();
+        }
+        void return_void() noexcept {}
+        void unhandled_exception() noexcept { error = std::current_exception(); }
+
+      private:
+        auto yieldToConsumer() noexcept {
+            struct YieldAwaiter {
+                bool await_ready() const noexcept { return false; }
+                std::coroutine_handle<> await_suspend(
+                    std::coroutine_handle<promise_type> handle) noexcept {
+                    return handle.promise().consumer;
+                }
+                void await_resume() const noexcept {}
+            };
+            return YieldAwaiter{};
+        }
+    };
+
+    AsyncGenerator(AsyncGenerator&& other) noexcept
+        : handle_(std::exchange(other.handle_, nullptr)) {}
+    ~AsyncGenerator() {
+        if (handle_) {
+            handle_.destroy();
+        }
+    }
+
+    AsyncGenerator(const AsyncGenerator&) = delete;
+    AsyncGenerator& operator=(const AsyncGenerator&) = delete;
+    AsyncGenerator& operator=(AsyncGenerator&&) = delete;
+
+    /**
+     * @brief Await the next value
+     *
+     * @return auto Awaitable producing `const T*`, nullptr once the sequence ends
+     */
+    auto next() {
+        struct NextAwaiter {
+            std::coroutine_handle<promise_type> handle;
+
+            bool await_ready() const noexcept { return handle.done(); }
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<> consumer) noexcept {
+                handle.promise().consumer = consumer;
+                return handle;
+            }
+            const T* await_resume() {
+                auto& promise = handle.promise();
+                if (promise.error) {
+                    std::rethrow_exception(std::exchange(promise.error, nullptr));
+                }
+                return handle.done() ? nullptr : promise.current;
+            }
+        };
+        return NextAwaiter{handle_};
+    }
+
+  private:
+    explicit AsyncGenerator(std::coroutine_handle<promise_type> handle) : handle_(handle) {}
+
+    std::coroutine_handle<promise_type> handle_;
+};
+
+namespace detail {
+
+// One-shot flag a synchronous caller blocks on
+struct SyncLatch {
+    std::mutex mutex;
+    std::condition_variable finished;
+    bool done = false;
+
+    void signal() {
+        std::lock_guard<std::mutex> lock(mutex);
+        done = true;
+        finished.notify_one();
+    }
+
+    void wait() {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (!done) {
+            finished.wait_for(lock, std::chrono::milliseconds(10));
+        }
+    }
+};
+
+// Coroutine that awaits a task and signals a latch once fully suspended, so
+// the waiting thread may destroy it as soon as the latch opens
+struct SyncWaitTask {
+    struct promise_type {
+        SyncLatch* latch = nullptr;
+
+        SyncWaitTask get_return_object() {
+            return SyncWaitTask{std::coroutine_handle<promise_type>::from_promise(*this)};
+        }
+        std::suspend_always initial_suspend() noexcept { return {}; }
+        auto final_suspend() noexcept {
+            struct SignalAwaiter {
+                bool await_ready() const noexcept { return false; }
+                void await_suspend(std::coroutine_handle<promise_type> handle) noexcept {
+                    handle.promise().latch->signal();
+                }
+                void await_resume() const noexcept {}
+            };
+            return SignalAwaiter{};
+        }
+        void return_void() noexcept {}
+        void unhandled_exception() noexcept { std::terminate(); }
+    };
+
+    std::coroutine_handle<promise_type> handle;
+};
+
+template <typename T>
+SyncWaitTask makeSyncWaitTask(Task<T>& task, std::optional<T>& value, std::exception_ptr& error) {
+    try {
+        value.emplace(co_await task);
+    } catch (...) {
+        error = std::current_exception();
+    }
+}
+
+}  // namespace detail
+
+/**
+ * @brief Block the calling thread until a task finishes
+ *
+ * Bridges coroutine code to synchronous callers such as main() and tests.
+ *
+ * @param task The task to run
+ * @return T The task's result (its exception is rethrown)
+ */
+template <typename T>
+T syncWait(Task<T> task) {
+    std::optional<T> value;
+    std::exception_ptr error;
+    detail::SyncLatch latch;
+
+    auto waiter = detail::makeSyncWaitTask(task, value, error);
+    waiter.handle.promise().latch = &latch;
+    waiter.handle.resume();
+    latch.wait();
+    waiter.handle.destroy();
+
+    if (error) {
+        std::rethrow_exception(error);
+    }
+    return std::move(*value);
+}
+
+#endif  // CPP_TEMPLATE_HAS_COROUTINES
+
+/**
+ * @brief Runs DataProcessor operations on an executor
+ *
+ * Holds references only; the processor and executor must outlive every
+ * pending operation.
+ */
+class AsyncDataProcessor {
+  public:
+    /**
+     * @brief Construct a new Async Data Processor object
+     *
+     * @param processor The processor doing the work
+     * @param executor Where the work runs
+     * @param batch_chunk Items processed per executor hop in processBatchAsync()
+     */
+    AsyncDataProcessor(DataProcessor& processor, Executor& executor, size_t batch_chunk = 64)
+        : processor_(processor),
+          executor_(executor),
+          batch_chunk_(std::max<size_t>(1, batch_chunk)) {}
+
+#if CPP_TEMPLATE_HAS_COROUTINES
+    /**
+     * @brief Process one item on the executor
+     *
+     * @param input The input data (owned by the coroutine while it runs)
+     * @param mode The processing mode
+     * @return Task<ProcessingResult> Awaitable result of DataProcessor::processItem()
+     */
+    Task<ProcessingResult> processItemAsync(std::string input,
+                                            ProcessingMode mode = ProcessingMode::SIMPLE) {
+        co_await schedule(executor_);
+        co_return processor_.processItem(input, mode);
+    }
+
+    /**
+     * @brief Process items on the executor, yielding each result in input order
+     *
+     * Empty inputs yield a failed result, as processItem() reports them. The
+     * generator hops to the executor once per batch_chunk items so long
+     * batches interleave with other work.
+     *
+     * @param inputs The input items (owned by the generator)
+     * @param mode The processing mode
+     * @return AsyncGenerator<ProcessingResult> The result sequence
+     */
+    AsyncGenerator<ProcessingResult> processBatchAsync(
+        std::vector<std::string> inputs, ProcessingMode mode = ProcessingMode::SIMPLE) {
+        for (size_t i = 0; i < inputs.size(); ++i) {
+            if (i % batch_chunk_ == 0) {
+                co_await schedule(executor_);
+            }
+            ProcessingResult result = processor_.processItem(inputs[i], mode);
+            co_yield result;
+        }
+    }
+#else
+    /**
+     * @brief Process one item on the executor
+     *
+     * @param input The input data
+     * @param mode The processing mode
+     * @return std::future<ProcessingResult> Result of DataProcessor::processItem()
+     */
+    std::future<ProcessingResult> processItemAsync(std::string input,
+                                                   ProcessingMode mode = ProcessingMode::SIMPLE) {
+        auto promise = std::make_shared<std::promise<ProcessingResult>>();
+        auto future = promise->get_future();
+        executor_.execute([this, promise, input = std::move(input), mode] {
+            try {
+                promise->set_value(processor_.processItem(input, mode));
+            } catch (...) {
+                promise->set_exception(std::current_exception());
+            }
+        });
+        return future;
+    }
+
+    /**
+     * @brief Process items on the executor, one future per input in input order
+     *
+     * Items are submitted in chunks of batch_chunk; empty inputs yield a
+     * failed result, as processItem() reports them.
+     *
+     * @param inputs The input items
+     * @param mode The processing mode
+     * @return std::vector<std::future<ProcessingResult>> The pending results
+     */
+    std::vector<std::future<ProcessingResult>> processBatchAsync(
+        std::vector<std::string> inputs, ProcessingMode mode = ProcessingMode::SIMPLE) {
+        struct Batch {
+            std::vector<std::string> inputs;
+            std::vector<std::promise<ProcessingResult>> results;
+        };
+        auto batch = std::make_shared<Batch>();
+        batch->inputs = std::move(inputs);
+        batch->results.resize(batch->inputs.size());
+
+        std::vector<std::future<ProcessingResult>> futures;
+        futures.reserve(batch->results.size());
+        for (auto& result : batch->results) {
+            futures.push_back(result.get_future());
+        }
+        for (size_t begin = 0; begin < batch->inputs.size(); begin += batch_chunk_) {
+            size_t end = std::min(begin + batch_chunk_, batch->inputs.size());
+            executor_.execute([this, batch, begin, end, mode] {
+                for (size_t i = begin; i < end; ++i) {
+                    try {
+                        batch->results[i].set_value(processor_.processItem(batch->inputs[i], mode));
+                    } catch (...) {
+                        batch->results[i].set_exception(std::current_exception());
+                    }
+                }
+            });
+        }
+        return futures;
+    }
+#endif
+
+  private:
+    DataProcessor& processor_;
+    Executor& executor_;
+    size_t batch_chunk_;
+};
+
+}  // namespace modules
+}  // namespace cpp_template
@@ -0,0 +1,252 @@
+#pragma once
+
+/**
+ * @file config_handle.h
+ * @brief Typed, pre-resolved configuration handles
+ *
+ * A ConfigHandle resolves one key, parses its value once and caches the
+ * result. Reads compare the cached version against ConfigManager::version()
+ * and only go back to the snapshot and parser after a change was published.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <charconv>
+#include <cstdint>
+#include <iterator>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include "config_manager.h"
+
+namespace cpp_template {
+namespace modules {
+
+/**
+ * @brief Parser used by ConfigHandle to convert configuration text to a value
+ *
+ * Specializations exist for arithmetic types and bool; specialize this
+ * template (or pass a parser to the handle) to support enums and other types.
+ *
+ * @tparam T The value type
+ */
+template <typename T, typename Enable = void>
+struct ConfigValueParser;
+
+/**
+ * @brief Integer and floating-point parser built on std::from_chars
+ */
+template <typename T>
+struct ConfigValueParser<
+    T, std::enable_if_t<std::is_arithmetic_v<T> && !std::is_same_v<T, bool>>> {
+    /**
+     * @brief Parse a number; the whole text must be consumed
+     *
+     * @param text The configuration text
+     * @param value Receives the parsed number
+     * @return true if the text is a valid number of type T
+     */
+    static bool parse(std::string_view text, T& value) {
+        const char* end = text.data() + text.size();
+        auto parsed = std::from_chars(text.data(), end, value);
+        return parsed.ec == std::errc() && parsed.ptr == end;
+    }
+};
+
+/**
+ * @brief Boolean parser accepting true/false, yes/no, on/off and 1/0
+ */
+template <>
+struct ConfigValueParser<bool> {
+    /**
+     * @brief Parse a boolean, ignoring ASCII case
+     *
+     * @param text The configuration text
+     * @param value Receives the parsed flag
+     * @return true if the text names a boolean
+     */
+    static bool parse(std::string_view text, bool& value) {
+        auto equals = [text](std::string_view word) {
+            return text.size() == word.size() &&
+                   std::equal(text.begin(), text.end(), word.begin(), [](char a, char b) {
+                       return std::tolower(static_cast<unsigned char>(a)) == b;
+                   });
+        };
+        if (equals("true") || equals("yes") || equals("on") || equals("1")) {
+            value = true;
+            return true;
+        }
+        if (equals("false") || equals("no") || equals("off") || equals("0")) {
+            value = false;
+            return true;
+        }
+        return false;
+    }
+};
+
+/**
+ * @brief Cached, typed view of one configuration key
+ *
+ * get() is a version comparison plus a relaxed load of the cached value on
+ * the common path; the key is looked up and parsed again only when the
+ * manager publishes a new version (through setValue, loadFromFile or clear).
+ * A missing key yields the default value; text the parser rejects makes
+ * get() throw std::invalid_argument until the key is fixed.
+ *
+ * Handles are safe to read from several threads. T must be trivially
+ * copyable. The manager must outlive the handle and must not be moved from.
+ *
+ * @tparam T The value type (integral, floating point, bool or enum)
+ */
+template <typename T>
+class ConfigHandle {
+    static_assert(std::is_trivially_copyable_v<T>, "ConfigHandle requires a trivially copyable T");
+
+  public:
+    using Parser = bool (*)(std::string_view text, T& value);
+
+    /**
+     * @brief Construct a new Config Handle object
+     *
+     * @param manager The configuration manager to read from
+     * @param key The configuration key
+     * @param defaultValue The value used while the key is not set
+     * @param parser Converts configuration text to T
+     */
+    ConfigHandle(const ConfigManager& manager, std::string key, T defaultValue,
+                 Parser parser = &ConfigValueParser<T>::parse)
+        : manager_(&manager),
+          key_(std::move(key)),
+          default_value_(defaultValue),
+          parser_(parser),
+          value_(defaultValue),
+          invalid_(false),
+          version_(0) {}
+
+    // Non-copyable and non-movable: readers may hold a reference concurrently
+    ConfigHandle(const ConfigHandle&) = delete;
+    ConfigHandle& operator=(const ConfigHandle&) = delete;
+
+    /**
+     * @brief Get the current value
+     *
+     * @return T The parsed value, or the default if the key is not set
+     * @throws std::invalid_argument if the configured text cannot be parsed
+     */
+    T get() const {
+        uint64_t version;
+        return get(version);
+    }
+
+    /**
+     * @brief Get the current value and the configuration version it was parsed from
+     *
+     * Handles refresh independently, so two get() calls may straddle a
+     * publication; comparing versions tells whether values belong to the
+     * same snapshot (see getConsistent()).
+     *
+     * @param version Receives the version of the snapshot the value came from
+     * @return T The parsed value, or the default if the key is not set
+     * @throws std::invalid_argument if the configured text cannot be parsed
+     */
+    T get(uint64_t& version) const {
+        for (;;) {
+            uint64_t cached = version_.load(std::memory_order_acquire);
+            if (cached != manager_->version()) {
+                refresh();
+                cached = version_.load(std::memory_order_acquire);
+            }
+            bool invalid = invalid_.load(std::memory_order_relaxed);
+            T value = value_.load(std::memory_order_relaxed);
+            // A refresh in between marks the version as updating first
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (cached == kUpdating || version_.load(std::memory_order_relaxed) != cached) {
+                continue;
+            }
+            if (invalid) {
+                throw std::invalid_argument("Invalid value for configuration key " + key_);
+            }
+            version = cached;
+            return value;
+        }
+    }
+
+    /**
+     * @brief Get the configuration key this handle resolves
+     *
+     * @return const std::string& The key
+     */
+    const std::string& key() const noexcept { return key_; }
+
+  private:
+    void refresh() const {
+        std::lock_guard<std::mutex> lock(refresh_mutex_);
+        auto snapshot = manager_->snapshot();
+        if (version_.load(std::memory_order_relaxed) == snapshot->version()) {
+            return;  // Another reader refreshed first
+        }
+
+        T parsed = default_value_;
+        bool invalid = false;
+        if (auto text = snapshot->find(key_)) {
+            invalid = !parser_(*text, parsed);
+        }
+        version_.store(kUpdating, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        value_.store(parsed, std::memory_order_relaxed);
+        invalid_.store(invalid, std::memory_order_relaxed);
+        version_.store(snapshot->version(), std::memory_order_release);
+    }
+
+    // Cached version while value_ and invalid_ are being replaced
+    static constexpr uint64_t kUpdating = UINT64_MAX;
+
+    const ConfigManager* manager_;
+    std::string key_;
+    T default_value_;
+    Parser parser_;
+
+    mutable std::atomic<T> value_;
+    mutable std::atomic<bool> invalid_;
+    mutable std::atomic<uint64_t> version_;
+    mutable std::mutex refresh_mutex_;
+};
+
+namespace detail {
+
+template <typename... T, size_t... I>
+std::tuple<T...> getConsistent(std::index_sequence<I...>, const ConfigHandle<T>&... handles) {
+    for (;;) {
+        uint64_t versions[sizeof...(T)] = {};
+        std::tuple<T...> values{handles.get(versions[I])...};
+        if (std::all_of(std::begin(versions), std::end(versions),
+                        [&versions](uint64_t version) { return version == versions[0]; })) {
+            return values;
+        }
+    }
+}
+
+}  // namespace detail
+
+/**
+ * @brief Read several handles as of one configuration version
+ *
+ * Retries until every value was parsed from the same snapshot, so settings
+ * that only make sense together never mix an old value with a new one.
+ *
+ * @param handles The handles to read
+ * @return std::tuple<T...> The values, in argument order
+ * @throws std::invalid_argument if a configured text cannot be parsed
+ */
+template <typename... T>
+std::tuple<T...> getConsistent(const ConfigHandle<T>&... handles) {
+    return detail::getConsistent(std::index_sequence_for<T...>(), handles...);
+}
+
+}  // namespace modules
+}  // namespace cpp_template
@@ -0,0 +1,328 @@
+#include "config_image.h"
+#include <core/file_writer.h>
+#include <core/trace.h>
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <limits>
+#include <stdexcept>
+#include <system_error>
+
+namespace cpp_template {
+namespace modules {
+
+struct ConfigImage::Header {
+    char magic[8];
+    uint32_t format_version;
+    uint32_t byte_order;
+    uint64_t file_size;
+    uint64_t checksum;  // Of bytes [sizeof(Header), file_size)
+    uint32_t entry_count;
+    uint32_t bucket_count;
+    uint64_t entries_offset;
+    uint64_t seeds_offset;
+    uint64_t slots_offset;
+    uint64_t strings_offset;
+};
+
+struct ConfigImage::EntryRecord {
+    uint32_t key_offset;
+    uint32_t key_length;
+    uint32_t value_offset;
+    uint32_t value_length;
+};
+
+namespace {
+
+constexpr char kMagic[8] = {'C', 'P', 'T', 'C', 'F', 'G', 'I', 'M'};
+constexpr uint32_t kByteOrder = 0x01020304;
+
+// FNV-1a with a seeded basis and a final mix, so the low bits taken by the
+// modulo depend on every byte of the key
+uint64_t hashKey(std::string_view key, uint64_t seed) noexcept {
+    uint64_t hash = 14695981039346656037ull ^ (seed * 0x9E3779B97F4A7C15ull);
+    for (char c : key) {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 1099511628211ull;
+    }
+    hash ^= hash >> 29;
+    hash *= 0xBF58476D1CE4E5B9ull;
+    hash ^= hash >> 32;
+    return hash;
+}
+
+// FNV-1a over 64-bit words. Each step is a bijection of the state, so any
+// single corrupted word changes the result.
+uint64_t checksum(const char* data, size_t size) noexcept {
+    uint64_t hash = 14695981039346656037ull;
+    size_t i = 0;
+    for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t)) {
+        uint64_t word;
+        std::memcpy(&word, data + i, sizeof(word));
+        hash = (hash ^ word) * 1099511628211ull;
+    }
+    for (; i < size; ++i) {
+        hash = (hash ^ static_cast<unsigned char>(data[i])) * 1099511628211ull;
+    }
+    return hash;
+}
+
+constexpr uint64_t alignUp(uint64_t offset) noexcept {
+    return (offset + 7) & ~uint64_t{7};
+}
+
+// Hash-and-displace construction of a minimal perfect hash: one bucket per
+// key, buckets placed largest first, each searching for a seed that sends
+// all its keys to free slots; single-key buckets take a free slot directly
+void buildIndex(const std::vector<ConfigSnapshot::Entry>& entries, std::vector<int32_t>& seeds,
+                std::vector<uint32_t>& slots) {
+    const size_t count = entries.size();
+    const size_t bucket_count = std::max<size_t>(count, 1);
+    std::vector<std::vector<uint32_t>> buckets(bucket_count);
+    for (size_t i = 0; i < count; ++i) {
+        buckets[hashKey(entries[i].key, 0) % bucket_count].push_back(static_cast<uint32_t>(i));
+    }
+    std::vector<size_t> order(bucket_count);
+    for (size_t b = 0; b < bucket_count; ++b) {
+        order[b] = b;
+    }
+    std::stable_sort(order.begin(), order.end(), [&buckets](size_t a, size_t b) {
+        return buckets[a].size() > buckets[b].size();
+    });
+
+    seeds.assign(bucket_count, 0);
+    slots.assign(count, 0);
+    std::vector<bool> taken(count, false);
+    std::vector<size_t> candidate;
+    size_t next_free = 0;
+    for (size_t b : order) {
+        const std::vector<uint32_t>& members = buckets[b];
+        if (members.empty()) {
+            break;
+        }
+        if (members.size() == 1) {
+            while (taken[next_free]) {
+                ++next_free;
+            }
+            taken[next_free] = true;
+            slots[next_free] = members[0];
+            seeds[b] = -static_cast<int32_t>(next_free) - 1;
+            continue;
+        }
+        for (int32_t seed = 1;; ++seed) {
+            if (seed == std::numeric_limits<int32_t>::max()) {
+                throw std::runtime_error("Config image index construction failed");
+            }
+            candidate.clear();
+            bool placed = true;
+            for (uint32_t member : members) {
+                size_t slot = hashKey(entries[member].key, static_cast<uint64_t>(seed)) % count;
+                if (taken[slot] ||
+                    std::find(candidate.begin(), candidate.end(), slot) != candidate.end()) {
+                    placed = false;
+                    break;
+                }
+                candidate.push_back(slot);
+            }
+            if (!placed) {
+                continue;
+            }
+            for (size_t i = 0; i < members.size(); ++i) {
+                taken[candidate[i]] = true;
+                slots[candidate[i]] = members[i];
+            }
+            seeds[b] = seed;
+            break;
+        }
+    }
+}
+
+}  // namespace
+
+std::string ConfigImage::compile(const std::vector<ConfigSnapshot::Entry>& entries) {
+    CORE_TRACE_SCOPE("ConfigImage::compile");
+    if (entries.size() > std::numeric_limits<uint32_t>::max()) {
+        throw std::length_error("Config image holds at most 2^32 - 1 entries");
+    }
+    std::vector<int32_t> seeds;
+    std::vector<uint32_t> slots;
+    buildIndex(entries, seeds, slots);
+
+    Header header{};
+    std::memcpy(header.magic, kMagic, sizeof(kMagic));
+    header.format_version = kFormatVersion;
+    header.byte_order = kByteOrder;
+    header.entry_count = static_cast<uint32_t>(entries.size());
+    header.bucket_count = static_cast<uint32_t>(seeds.size());
+    header.entries_offset = alignUp(sizeof(Header));
+    header.seeds_offset = alignUp(header.entries_offset + entries.size() * sizeof(EntryRecord));
+    header.slots_offset = alignUp(header.seeds_offset + seeds.size() * sizeof(int32_t));
+    header.strings_offset = alignUp(header.slots_offset + slots.size() * sizeof(uint32_t));
+
+    uint64_t string_bytes = 0;
+    for (const ConfigSnapshot::Entry& entry : entries) {
+        string_bytes += entry.key.size() + entry.value.size();
+    }
+    if (string_bytes > std::numeric_limits<uint32_t>::max()) {
+        throw std::length_error("Config image strings exceed the 4 GiB offset range");
+    }
+    header.file_size = header.strings_offset + string_bytes;
+
+    std::string image(static_cast<size_t>(header.file_size), '\0');
+    char* base = image.data();
+    auto* records = reinterpret_cast<EntryRecord*>(base + header.entries_offset);
+    char* strings = base + header.strings_offset;
+    uint32_t position = 0;
+    for (size_t i = 0; i < entries.size(); ++i) {
+        const ConfigSnapshot::Entry& entry = entries[i];
+        EntryRecord record;
+        record.key_offset = position;
+        record.key_length = static_cast<uint32_t>(entry.key.size());
+        std::memcpy(strings + position, entry.key.data(), entry.key.size());
+        position += record.key_length;
+        record.value_offset = position;
+        record.value_length = static_cast<uint32_t>(entry.value.size());
+        std::memcpy(strings + position, entry.value.data(), entry.value.size());
+        position += record.value_length;
+        std::memcpy(&records[i], &record, sizeof(record));
+    }
+    std::memcpy(base + header.seeds_offset, seeds.data(), seeds.size() * sizeof(int32_t));
+    std::memcpy(base + header.slots_offset, slots.data(), slots.size() * sizeof(uint32_t));
+
+    header.checksum = checksum(base + sizeof(Header), image.size() - sizeof(Header));
+    std::memcpy(base, &header, sizeof(header));
+    return image;
+}
+
+bool ConfigImage::write(const ConfigSnapshot& snapshot, const std::string& filename) {
+    std::string image = compile(snapshot.entries());
+    std::string staging = filename + ".tmp";
+    core::FileWriter writer;
+    if (!writer.open(staging) || !writer.write(image) || !writer.close()) {
+        std::error_code ignored;
+        std::filesystem::remove(staging, ignored);
+        return false;
+    }
+    std::error_code error;
+    std::filesystem::rename(staging, filename, error);
+    if (error) {
+        std::filesystem::remove(staging, error);
+        return false;
+    }
+    return true;
+}
+
+std::shared_ptr<const ConfigImage> ConfigImage::open(const std::string& filename,
+                                                     std::string* error) {
+    CORE_TRACE_SCOPE("ConfigImage::open");
+    std::shared_ptr<ConfigImage> image(new ConfigImage());
+    std::string reason;
+    if (!image->file_.open(filename)) {
+        reason = "cannot map " + filename;
+    } else if (!image->validate(reason)) {
+        reason = filename + ": " + reason;
+    }
+    if (!reason.empty()) {
+        if (error) {
+            *error = std::move(reason);
+        }
+        return nullptr;
+    }
+    return image;
+}
+
+bool ConfigImage::validate(std::string& error) {
+    std::string_view bytes = file_.view();
+    if (bytes.size() < sizeof(Header)) {
+        error = "too small for a config image";
+        return false;
+    }
+    Header header;
+    std::memcpy(&header, bytes.data(), sizeof(header));
+    if (std::memcmp(header.magic, kMagic, sizeof(kMagic)) != 0) {
+        error = "not a config image";
+        return false;
+    }
+    if (header.format_version != kFormatVersion) {
+        error = "unsupported format version " + std::to_string(header.format_version);
+        return false;
+    }
+    if (header.byte_order != kByteOrder) {
+        error = "written with a different byte order";
+        return false;
+    }
+    if (header.file_size != bytes.size()) {
+        error = "truncated or padded";
+        return false;
+    }
+    if (header.checksum != checksum(bytes.data() + sizeof(Header), bytes.size() - sizeof(Header))) {
+        error = "checksum mismatch";
+        return false;
+    }
+
+    // Sections must be aligned and inside the file; the counts are 32-bit,
+    // so none of the sums below can overflow
+    const uint64_t size = bytes.size();
+    const uint64_t count = header.entry_count;
+    auto section_fits = [size](uint64_t offset, uint64_t length) {
+        return offset % 8 == 0 && offset >= sizeof(Header) && offset <= size &&
+               length <= size - offset;
+    };
+    if (header.bucket_count == 0 ||
+        !section_fits(header.entries_offset, count * sizeof(EntryRecord)) ||
+        !section_fits(header.seeds_offset, uint64_t{header.bucket_count} * sizeof(int32_t)) ||
+        !section_fits(header.slots_offset, count * sizeof(uint32_t)) ||
+        !section_fits(header.strings_offset, 0)) {
+        error = "section out of bounds";
+        return false;
+    }
+
+    entries_ = reinterpret_cast<const EntryRecord*>(bytes.data() + header.entries_offset);
+    seeds_ = reinterpret_cast<const int32_t*>(bytes.data() + header.seeds_offset);
+    slots_ = reinterpret_cast<const uint32_t*>(bytes.data() + header.slots_offset);
+    strings_ = bytes.data() + header.strings_offset;
+    entry_count_ = header.entry_count;
+    bucket_count_ = header.bucket_count;
+
+    // Checked once here so lookups can trust every offset and index
+    const uint64_t string_bytes = size - header.strings_offset;
+    for (uint32_t i = 0; i < entry_count_; ++i) {
+        const EntryRecord& record = entries_[i];
+        if (uint64_t{record.key_offset} + record.key_length > string_bytes ||
+            uint64_t{record.value_offset} + record.value_length > string_bytes ||
+            slots_[i] >= entry_count_ || (i > 0 && !(entry(i - 1).key < entry(i).key))) {
+            error = "corrupt entry table";
+            return false;
+        }
+    }
+    for (uint32_t b = 0; b < bucket_count_; ++b) {
+        if (seeds_[b] < 0 && static_cast<uint64_t>(-(int64_t{seeds_[b]} + 1)) >= entry_count_) {
+            error = "corrupt index";
+            return false;
+        }
+    }
+    return true;
+}
+
+std::optional<std::string_view> ConfigImage::find(std::string_view key) const noexcept {
+    if (entry_count_ == 0) {
+        return std::nullopt;
+    }
+    int32_t seed = seeds_[hashKey(key, 0) % bucket_count_];
+    size_t slot = seed < 0 ? static_cast<size_t>(-(int64_t{seed} + 1))
+                           : hashKey(key, static_cast<uint64_t>(seed)) % entry_count_;
+    const EntryRecord& record = entries_[slots_[slot]];
+    if (std::string_view(strings_ + record.key_offset, record.key_length) != key) {
+        return std::nullopt;
+    }
+    return std::string_view(strings_ + record.value_offset, record.value_length);
+}
+
+ConfigSnapshot::Entry ConfigImage::entry(size_t index) const noexcept {
+    const EntryRecord& record = entries_[index];
+    return {std::string_view(strings_ + record.key_offset, record.key_length),
+            std::string_view(strings_ + record.value_offset, record.value_length)};
+}
+
+}  // namespace modules
+}  // namespace cpp_template
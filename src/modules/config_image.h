@@ -0,0 +1,130 @@
+#pragma once
+
+/**
+ * @file config_image.h
+ * @brief Precompiled binary configuration images
+ *
+ * A config image is a configuration compiled ahead of time into the form
+ * lookups need: a key-sorted entry table, a minimal perfect-hash index over
+ * it and one string table with every key and value. Loading one maps the
+ * file and checks its header and checksum; nothing is parsed or copied,
+ * and the values handed out are views into the mapping.
+ *
+ * Layout (native byte order, every section 8-byte aligned):
+ *
+ *     Header    magic "CPTCFGIM", format version, byte-order tag, file size,
+ *               checksum of everything after the header, entry and bucket
+ *               counts, section offsets
+ *     Entries   entry_count x {key offset, key length, value offset, value length}
+ *     Seeds     bucket_count x int32: > 0 re-hash seed, < 0 direct slot -seed - 1
+ *     Slots     entry_count x uint32 entry index
+ *     Strings   key and value bytes
+ */
+
+#include <core/mapped_file.h>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "config_manager.h"
+
+namespace cpp_template {
+namespace modules {
+
+/**
+ * @brief Memory-mapped, read-only configuration image
+ *
+ * Images are immutable once opened and may be read from any number of
+ * threads. Views returned by the accessors stay valid for the lifetime of
+ * the image object.
+ */
+class ConfigImage {
+  public:
+    /**
+     * @brief Version of the layout written by compile(); open() rejects any other
+     */
+    static constexpr uint32_t kFormatVersion = 1;
+
+    /**
+     * @brief Compile key-sorted, unique entries into image bytes
+     *
+     * @param entries The entries, sorted by key without duplicates (as ConfigSnapshot holds them)
+     * @return std::string The image
+     * @throws std::length_error if the strings exceed the 4 GiB offset range
+     */
+    static std::string compile(const std::vector<ConfigSnapshot::Entry>& entries);
+
+    /**
+     * @brief Compile a snapshot and write it to a file
+     *
+     * The image is written next to @p filename and renamed over it, so
+     * processes that still map the previous image keep a consistent view.
+     *
+     * @param snapshot The configuration to compile
+     * @param filename The image file to create or replace
+     * @return true if the image was written
+     * @return false if writing or renaming failed
+     */
+    static bool write(const ConfigSnapshot& snapshot, const std::string& filename);
+
+    /**
+     * @brief Map and validate an image file
+     *
+     * Checks the magic, format version, byte order, size, checksum and that
+     * every offset stays inside the file.
+     *
+     * @param filename The image file
+     * @param error Receives the reason when the image is rejected (may be null)
+     * @return std::shared_ptr<const ConfigImage> The image, or null if it is missing or invalid
+     */
+    static std::shared_ptr<const ConfigImage> open(const std::string& filename,
+                                                   std::string* error = nullptr);
+
+    /**
+     * @brief Look up a value through the perfect-hash index
+     *
+     * Hashes the key twice and compares it once; never allocates.
+     *
+     * @param key The configuration key
+     * @return std::optional<std::string_view> View into the mapping, or nullopt
+     */
+    std::optional<std::string_view> find(std::string_view key) const noexcept;
+
+    /**
+     * @brief Get entry @p index in key order
+     *
+     * @param index Entry index; must be less than size()
+     * @return ConfigSnapshot::Entry Views into the mapping
+     */
+    ConfigSnapshot::Entry entry(size_t index) const noexcept;
+
+    /**
+     * @brief Get the number of keys
+     *
+     * @return size_t The key count
+     */
+    size_t size() const noexcept { return entry_count_; }
+
+  private:
+    struct Header;
+    struct EntryRecord;
+
+    ConfigImage() = default;
+
+    // Point the section pointers into file_ after checking every bound
+    bool validate(std::string& error);
+
+    core::MappedFile file_;
+    const EntryRecord* entries_ = nullptr;
+    const int32_t* seeds_ = nullptr;
+    const uint32_t* slots_ = nullptr;
+    const char* strings_ = nullptr;
+    uint32_t entry_count_ = 0;
+    uint32_t bucket_count_ = 0;
+};
+
+}  // namespace modules
+}  // namespace cpp_template
@@ -1,92 +1,460 @@
 #include "config_manager.h"
+#include "config_image.h"
+#include <core/mapped_file.h>
+#include <core/memory_tracking.h>
+#include <core/trace.h>
 #include <algorithm>
+#include <cstring>
 #include <fstream>
 #include <iostream>
-#include <sstream>
+#include <iterator>
 
 namespace cpp_template {
 namespace modules {
 
-ConfigManager::ConfigManager() : is_loaded_(false) {
-    // Set some default configuration values
-    config_data_["app.name"] = "cpp-template";
-    config_data_["app.version"] = "1.0.0";
-    config_data_["processing.mode"] = "simple";
-    config_data_["processing.batch_size"] = "10";
-    config_data_["logging.level"] = "info";
+namespace {
+
+bool keyLess(const ConfigSnapshot::Entry& a, const ConfigSnapshot::Entry& b) {
+    return a.key < b.key;
 }
 
-bool ConfigManager::loadFromFile(const std::string& filename) {
-    std::ifstream file(filename);
-    if (!file.is_open()) {
-        std::cerr << "Warning: Could not open config file: " << filename << std::endl;
-        return false;
+// FNV-1a; config keys are short, so a byte-at-a-time hash is enough
+uint64_t hashKey(std::string_view key) noexcept {
+    uint64_t hash = 14695981039346656037ull;
+    for (char c : key) {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 1099511628211ull;
     }
+    return hash;
+}
 
-    // Clear existing configuration to ensure file values take precedence
-    config_data_.clear();
+std::string_view trimBlanks(std::string_view text) {
+    size_t begin = text.find_first_not_of(" \t");
+    if (begin == std::string_view::npos) {
+        return {};
+    }
+    size_t end = text.find_last_not_of(" \t");
+    return text.substr(begin, end - begin + 1);
+}
+
+// Parse `key=value` lines into views of text. Matches the historical
+// getline-based parser: lines split on '\n' only, empty lines and lines
+// starting with '#' are skipped, lines without '=' are ignored, and keys and
+// values are trimmed of spaces and tabs.
+void parseConfigText(std::string_view text, std::vector<ConfigSnapshot::Entry>& entries) {
+    entries.reserve(static_cast<size_t>(std::count(text.begin(), text.end(), '\n')) + 1);
+
+    const char* cursor = text.data();
+    const char* const end = text.data() + text.size();
+    while (cursor < end) {
+        const void* newline = std::memchr(cursor, '\n', static_cast<size_t>(end - cursor));
+        const char* line_end = newline ? static_cast<const char*>(newline) : end;
+        std::string_view line(cursor, static_cast<size_t>(line_end - cursor));
+        cursor = line_end + 1;
 
-    std::string line;
-    while (std::getline(file, line)) {
-        // Skip empty lines and comments
         if (line.empty() || line[0] == '#') {
             continue;
         }
-
-        // Find the '=' separator
         size_t pos = line.find('=');
-        if (pos != std::string::npos) {
-            std::string key = line.substr(0, pos);
-            std::string value = line.substr(pos + 1);
+        if (pos != std::string_view::npos) {
+            entries.push_back({trimBlanks(line.substr(0, pos)), trimBlanks(line.substr(pos + 1))});
+        }
+    }
+}
+
+// Distinguishes managers in the per-thread snapshot cache; never reused, so
+// a manager allocated where a destroyed one was cannot hit its stale entry
+std::atomic<uint64_t> next_manager_id{1};
 
-            // Trim whitespace
-            key.erase(0, key.find_first_not_of(" \t"));
-            key.erase(key.find_last_not_of(" \t") + 1);
-            value.erase(0, value.find_first_not_of(" \t"));
-            value.erase(value.find_last_not_of(" \t") + 1);
+// A thread's last snapshot of one manager, valid while the version matches
+struct CachedSnapshot {
+    uint64_t manager_id = 0;
+    uint64_t version = 0;
+    std::shared_ptr<const ConfigSnapshot> snapshot;
+};
 
-            config_data_[key] = value;
+// Direct-mapped by manager id; a few slots cover threads that read several managers
+constexpr size_t kCachedManagers = 4;
+thread_local CachedSnapshot t_snapshots[kCachedManagers];
+
+}  // namespace
+
+ConfigSnapshot::ConfigSnapshot(std::vector<Entry> entries, uint64_t version, ConfigStorage storage)
+    : version_(version), storage_(storage) {
+    // Stable sort keeps duplicates in input order, so the last one can win
+    std::stable_sort(entries.begin(), entries.end(), keyLess);
+    std::vector<Entry> unique;
+    unique.reserve(entries.size());
+    for (size_t i = 0; i < entries.size(); ++i) {
+        if (i + 1 < entries.size() && entries[i + 1].key == entries[i].key) {
+            continue;
         }
+        unique.push_back(entries[i]);
+    }
+    assign(unique);
+}
+
+ConfigSnapshot::ConfigSnapshot(const ConfigSnapshot& base, std::string_view key,
+                               std::string_view value, uint64_t version)
+    : version_(version),
+      storage_(base.storage_ == ConfigStorage::IMAGE ? ConfigStorage::HASH : base.storage_) {
+    const std::vector<Entry>& base_entries = base.entries();
+    std::vector<Entry> merged;
+    merged.reserve(base_entries.size() + 1);
+    auto it = std::lower_bound(base_entries.begin(), base_entries.end(), Entry{key, {}}, keyLess);
+    merged.insert(merged.end(), base_entries.begin(), it);
+    merged.push_back({key, value});
+    if (it != base_entries.end() && it->key == key) {
+        ++it;
+    }
+    merged.insert(merged.end(), it, base_entries.end());
+    assign(merged);
+}
+
+ConfigSnapshot::ConfigSnapshot(std::shared_ptr<const ConfigImage> image, uint64_t version)
+    : image_(std::move(image)), version_(version), storage_(ConfigStorage::IMAGE) {}
+
+const std::vector<ConfigSnapshot::Entry>& ConfigSnapshot::entries() const {
+    if (image_) {
+        std::call_once(entries_once_, [this] {
+            entries_.reserve(image_->size());
+            for (size_t i = 0; i < image_->size(); ++i) {
+                entries_.push_back(image_->entry(i));
+            }
+        });
+    }
+    return entries_;
+}
+
+size_t ConfigSnapshot::size() const noexcept {
+    return image_ ? image_->size() : entries_.size();
+}
+
+void ConfigSnapshot::assign(const std::vector<Entry>& sorted) {
+    size_t total = 0;
+    for (const Entry& entry : sorted) {
+        total += entry.key.size() + entry.value.size();
     }
+    arena_ = std::make_unique<char[]>(std::max<size_t>(total, 1));
+
+    char* out = arena_.get();
+    auto copy = [&out](std::string_view text) {
+        std::memcpy(out, text.data(), text.size());
+        std::string_view stored(out, text.size());
+        out += text.size();
+        return stored;
+    };
+
+    entries_.clear();
+    entries_.reserve(sorted.size());
+    for (const Entry& entry : sorted) {
+        std::string_view stored_key = copy(entry.key);
+        entries_.push_back({stored_key, copy(entry.value)});
+    }
+
+    if (storage_ == ConfigStorage::HASH) {
+        buildHashIndex();
+    }
+}
+
+void ConfigSnapshot::buildHashIndex() {
+    // Keep the load factor at or below one half so probe sequences stay short
+    size_t capacity = 16;
+    while (capacity < entries_.size() * 2) {
+        capacity *= 2;
+    }
+    hash_slots_.assign(capacity, 0);
+
+    const size_t mask = capacity - 1;
+    for (size_t i = 0; i < entries_.size(); ++i) {
+        size_t slot = static_cast<size_t>(hashKey(entries_[i].key)) & mask;
+        while (hash_slots_[slot] != 0) {
+            slot = (slot + 1) & mask;
+        }
+        hash_slots_[slot] = static_cast<uint32_t>(i + 1);
+    }
+}
+
+std::pair<ConfigSnapshot::EntryIterator, ConfigSnapshot::EntryIterator>
+ConfigSnapshot::prefixRange(std::string_view prefix) const {
+    const std::vector<Entry>& sorted = entries();
+    auto first = std::lower_bound(sorted.begin(), sorted.end(), Entry{prefix, {}}, keyLess);
+    auto last = std::partition_point(first, sorted.end(), [prefix](const Entry& entry) {
+        return entry.key.compare(0, prefix.size(), prefix) == 0;
+    });
+    return {first, last};
+}
+
+std::optional<std::string_view> ConfigSnapshot::find(std::string_view key) const {
+    if (image_) {
+        return image_->find(key);
+    }
+    if (storage_ == ConfigStorage::HASH) {
+        const size_t mask = hash_slots_.size() - 1;
+        for (size_t slot = static_cast<size_t>(hashKey(key)) & mask;; slot = (slot + 1) & mask) {
+            uint32_t index = hash_slots_[slot];
+            if (index == 0) {
+                return std::nullopt;
+            }
+            if (entries_[index - 1].key == key) {
+                return entries_[index - 1].value;
+            }
+        }
+    }
+
+    auto it = std::lower_bound(entries_.begin(), entries_.end(), Entry{key, {}}, keyLess);
+    if (it != entries_.end() && it->key == key) {
+        return it->value;
+    }
+    return std::nullopt;
+}
+
+std::vector<ConfigChange> ConfigSnapshot::diff(const ConfigSnapshot& newer) const {
+    const std::vector<Entry>& old_entries = entries();
+    const std::vector<Entry>& new_entries = newer.entries();
+    std::vector<ConfigChange> changes;
+    auto before = old_entries.begin();
+    auto after = new_entries.begin();
+    while (before != old_entries.end() || after != new_entries.end()) {
+        if (after == new_entries.end() ||
+            (before != old_entries.end() && before->key < after->key)) {
+            changes.push_back({before->key, before->value, std::nullopt});
+            ++before;
+        } else if (before == old_entries.end() || after->key < before->key) {
+            changes.push_back({after->key, std::nullopt, after->value});
+            ++after;
+        } else {
+            if (before->value != after->value) {
+                changes.push_back({after->key, before->value, after->value});
+            }
+            ++before;
+            ++after;
+        }
+    }
+    return changes;
+}
+
+std::string_view ConfigSnapshot::getValue(std::string_view key,
+                                          std::string_view defaultValue) const {
+    return find(key).value_or(defaultValue);
+}
+
+bool ConfigSnapshot::hasKey(std::string_view key) const {
+    return find(key).has_value();
+}
 
-    is_loaded_ = true;
+ConfigManager::ConfigManager(ConfigStorage storage) : state_(std::make_unique<State>()) {
+    state_->id = next_manager_id.fetch_add(1, std::memory_order_relaxed);
+    state_->storage = storage;
+
+    // Set some default configuration values
+    std::vector<ConfigSnapshot::Entry> defaults = {
+        {"app.name", "cpp-template"},
+        {"app.version", "1.0.0"},
+        {"processing.mode", "simple"},
+        {"processing.batch_size", "10"},
+        {"logging.level", "info"},
+    };
+
+    std::unique_lock<std::mutex> lock(state_->writer_mutex);
+    publish(std::move(lock),
+            std::make_shared<const ConfigSnapshot>(std::move(defaults), nextVersion(), storage));
+}
+
+std::shared_ptr<const ConfigSnapshot> ConfigManager::snapshot() const {
+    return cachedSnapshot();
+}
+
+const std::shared_ptr<const ConfigSnapshot>& ConfigManager::cachedSnapshot() const {
+    CachedSnapshot& cached = t_snapshots[state_->id % kCachedManagers];
+    if (cached.manager_id != state_->id || cached.version != version()) {
+        // Only after a publication: the snapshot is stored before the
+        // version, so this loads one at least as new as version() was
+        cached.snapshot = std::atomic_load_explicit(&state_->current, std::memory_order_acquire);
+        cached.version = cached.snapshot->version();
+        cached.manager_id = state_->id;
+    }
+    return cached.snapshot;
+}
+
+uint64_t ConfigManager::version() const noexcept {
+    return state_->version.load(std::memory_order_acquire);
+}
+
+ConfigStorage ConfigManager::storage() const noexcept {
+    return state_->storage;
+}
+
+uint64_t ConfigManager::nextVersion() const noexcept {
+    return state_->version.load(std::memory_order_relaxed) + 1;
+}
+
+void ConfigManager::publish(std::unique_lock<std::mutex> writer_lock,
+                            std::shared_ptr<const ConfigSnapshot> snapshot) {
+    std::shared_ptr<const ConfigSnapshot> previous = state_->current;
+    std::atomic_store_explicit(&state_->current, snapshot, std::memory_order_release);
+    state_->version.store(snapshot->version(), std::memory_order_release);
+    if (!previous || state_->subscription_count.load(std::memory_order_acquire) == 0) {
+        return;
+    }
+
+    // Taken before the writer lock is released, so notifications keep the
+    // publication order while the next writer builds its snapshot
+    std::lock_guard<std::mutex> notify_lock(state_->subscriber_mutex);
+    writer_lock.unlock();
+
+    std::vector<ConfigChange> changes = previous->diff(*snapshot);
+    if (changes.empty()) {
+        return;
+    }
+    std::vector<ConfigChange> matching;
+    for (const Subscription& subscription : state_->subscriptions) {
+        const std::vector<ConfigChange>* delivered = &changes;
+        if (!subscription.prefix.empty()) {
+            matching.clear();
+            for (const ConfigChange& change : changes) {
+                if (change.key.compare(0, subscription.prefix.size(), subscription.prefix) == 0) {
+                    matching.push_back(change);
+                }
+            }
+            delivered = &matching;
+        }
+        if (!delivered->empty()) {
+            subscription.callback(*delivered, *snapshot);
+        }
+    }
+}
+
+uint64_t ConfigManager::subscribe(std::string prefix, Subscriber subscriber) {
+    std::lock_guard<std::mutex> lock(state_->subscriber_mutex);
+    uint64_t id = state_->next_subscription_id++;
+    state_->subscriptions.push_back({id, std::move(prefix), std::move(subscriber)});
+    state_->subscription_count.store(state_->subscriptions.size(), std::memory_order_release);
+    return id;
+}
+
+bool ConfigManager::unsubscribe(uint64_t id) {
+    std::lock_guard<std::mutex> lock(state_->subscriber_mutex);
+    auto& subscriptions = state_->subscriptions;
+    auto it = std::find_if(
+        subscriptions.begin(), subscriptions.end(),
+        [id](const Subscription& subscription) { return subscription.id == id; });
+    if (it == subscriptions.end()) {
+        return false;
+    }
+    subscriptions.erase(it);
+    state_->subscription_count.store(subscriptions.size(), std::memory_order_release);
     return true;
 }
 
+bool ConfigManager::loadFromFile(const std::string& filename) {
+    CORE_TRACE_SCOPE("ConfigManager::loadFromFile");
+    CORE_MEMORY_SCOPE(CONFIG);
+    core::MappedFile file;
+    if (!file.open(filename)) {
+        std::cerr << "Warning: Could not open config file: " << filename << std::endl;
+        return false;
+    }
+
+    publishText(file.view());
+    return true;
+}
+
+bool ConfigManager::reloadFromFile(const std::string& filename) {
+    CORE_TRACE_SCOPE("ConfigManager::reloadFromFile");
+    CORE_MEMORY_SCOPE(CONFIG);
+    std::ifstream file(filename, std::ios::binary);
+    if (!file) {
+        std::cerr << "Warning: Could not open config file: " << filename << std::endl;
+        return false;
+    }
+    std::string text((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    if (file.bad()) {
+        std::cerr << "Warning: Could not read config file: " << filename << std::endl;
+        return false;
+    }
+
+    publishText(text);
+    return true;
+}
+
+void ConfigManager::publishText(std::string_view text) {
+    // Parse views into the text; the snapshot copies them into its arena.
+    // Readers keep seeing the previous snapshot until the new one is published.
+    std::vector<ConfigSnapshot::Entry> entries;
+    parseConfigText(text, entries);
+
+    std::unique_lock<std::mutex> lock(state_->writer_mutex);
+    state_->is_loaded = true;
+    publish(std::move(lock), std::make_shared<const ConfigSnapshot>(
+                                 std::move(entries), nextVersion(), state_->storage));
+}
+
+bool ConfigManager::loadFromImage(const std::string& filename) {
+    CORE_TRACE_SCOPE("ConfigManager::loadFromImage");
+    CORE_MEMORY_SCOPE(CONFIG);
+    std::string error;
+    std::shared_ptr<const ConfigImage> image = ConfigImage::open(filename, &error);
+    if (!image) {
+        std::cerr << "Warning: Could not load config image: " << error << std::endl;
+        return false;
+    }
+
+    std::unique_lock<std::mutex> lock(state_->writer_mutex);
+    state_->is_loaded = true;
+    publish(std::move(lock), std::make_shared<const ConfigSnapshot>(std::move(image),
+                                                                    nextVersion()));
+    return true;
+}
+
+bool ConfigManager::saveImage(const std::string& filename) const {
+    CORE_TRACE_SCOPE("ConfigManager::saveImage");
+    CORE_MEMORY_SCOPE(CONFIG);
+    return ConfigImage::write(*snapshot(), filename);
+}
+
 void ConfigManager::setValue(const std::string& key, const std::string& value) {
-    config_data_[key] = value;
+    CORE_MEMORY_SCOPE(CONFIG);
+    std::unique_lock<std::mutex> lock(state_->writer_mutex);
+    // Copy-on-write: the published snapshot is never modified in place
+    auto updated =
+        std::make_shared<const ConfigSnapshot>(*state_->current, key, value, nextVersion());
+    publish(std::move(lock), std::move(updated));
 }
 
 std::string ConfigManager::getValue(const std::string& key, const std::string& defaultValue) const {
-    auto it = config_data_.find(key);
-    if (it != config_data_.end()) {
-        return it->second;
-    }
-    return defaultValue;
+    CORE_MEMORY_SCOPE(CONFIG);
+    auto value = cachedSnapshot()->find(key);
+    return value ? std::string(*value) : defaultValue;
 }
 
 bool ConfigManager::hasKey(const std::string& key) const {
-    return config_data_.find(key) != config_data_.end();
+    return cachedSnapshot()->hasKey(key);
 }
 
 std::vector<std::string> ConfigManager::getAllKeys() const {
+    CORE_MEMORY_SCOPE(CONFIG);
+    const ConfigSnapshot* current = cachedSnapshot().get();
     std::vector<std::string> keys;
-    keys.reserve(config_data_.size());
+    keys.reserve(current->size());
 
-    for (const auto& pair : config_data_) {
-        keys.push_back(pair.first);
+    for (const auto& entry : current->entries()) {
+        keys.emplace_back(entry.key);
     }
 
     return keys;
 }
 
 void ConfigManager::clear() {
-    config_data_.clear();
-    is_loaded_ = false;
+    std::unique_lock<std::mutex> lock(state_->writer_mutex);
+    state_->is_loaded = false;
+    publish(std::move(lock),
+            std::make_shared<const ConfigSnapshot>(std::vector<ConfigSnapshot::Entry>{},
+                                                   nextVersion(), state_->storage));
 }
 
-std::unique_ptr<ConfigManager> createConfigManager() {
-    return std::make_unique<ConfigManager>();
+std::unique_ptr<ConfigManager> createConfigManager(ConfigStorage storage) {
+    return std::make_unique<ConfigManager>(storage);
 }
 
 }  // namespace modules
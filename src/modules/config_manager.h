@@ -8,47 +8,349 @@
  * within the modular architecture of the cpp-template project.
  */
 
-#include <map>
+#include <atomic>
+#include <cstdint>
+#include <functional>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <string>
+#include <string_view>
+#include <utility>
 #include <vector>
 
 namespace cpp_template {
 namespace modules {
 
+/**
+ * @brief Lookup structure built for each configuration snapshot
+ *
+ * Both layouts keep the entries in one key-sorted array, so ordered and
+ * prefix iteration work the same way; they differ in how point lookups find
+ * an entry.
+ */
+enum class ConfigStorage {
+    SORTED,  // Binary search over the sorted entries
+    HASH,    // Open-addressing hash index over the sorted entries
+    IMAGE    // Perfect-hash index of a mapped ConfigImage (see loadFromImage())
+};
+
+class ConfigImage;
+
+/**
+ * @brief One key whose value differs between two snapshots
+ *
+ * The views point into the two snapshots that were compared.
+ */
+struct ConfigChange {
+    std::string_view key;
+    std::optional<std::string_view> old_value;  // nullopt if the key was added
+    std::optional<std::string_view> new_value;  // nullopt if the key was removed
+};
+
+/**
+ * @brief Immutable view of the configuration at one point in time
+ *
+ * Snapshots are never modified after publication, so any number of threads
+ * can read one without synchronization. Entries are kept in a flat array
+ * sorted by key, with all key and value bytes in a single arena. Lookups
+ * take a std::string_view, use the snapshot's ConfigStorage layout and do
+ * not allocate.
+ *
+ * Snapshots of a ConfigImage own no copy of the data: lookups go straight
+ * to the image's index and return views into the mapping. Their entry
+ * array is only materialized, once, by the first call that iterates
+ * (entries(), forEachWithPrefix(), diff()).
+ */
+class ConfigSnapshot {
+  public:
+    /**
+     * @brief One key/value pair; views point into the snapshot's arena
+     */
+    struct Entry {
+        std::string_view key;
+        std::string_view value;
+    };
+
+    /**
+     * @brief Construct a new Config Snapshot object
+     *
+     * The key and value bytes are copied, so @p entries may point into
+     * temporary storage. When a key occurs more than once the last entry wins.
+     *
+     * @param entries The configuration values
+     * @param version The version number this snapshot is published as
+     * @param storage The lookup structure to build
+     */
+    ConfigSnapshot(std::vector<Entry> entries, uint64_t version,
+                   ConfigStorage storage = ConfigStorage::HASH);
+
+    /**
+     * @brief Construct a copy of @p base with one key set
+     *
+     * The copy uses the same storage layout as @p base.
+     *
+     * @param base The snapshot to copy
+     * @param key The key to add or replace
+     * @param value The new value
+     * @param version The version number this snapshot is published as
+     */
+    ConfigSnapshot(const ConfigSnapshot& base, std::string_view key, std::string_view value,
+                   uint64_t version);
+
+    /**
+     * @brief Construct a snapshot that reads a config image in place
+     *
+     * Copies of it made with the key-setting constructor use ConfigStorage::HASH.
+     *
+     * @param image The mapped image, kept alive by the snapshot
+     * @param version The version number this snapshot is published as
+     */
+    ConfigSnapshot(std::shared_ptr<const ConfigImage> image, uint64_t version);
+
+    // Non-copyable: entries point into the arena
+    ConfigSnapshot(const ConfigSnapshot&) = delete;
+    ConfigSnapshot& operator=(const ConfigSnapshot&) = delete;
+
+    /**
+     * @brief Look up a configuration value
+     *
+     * @param key The configuration key
+     * @return std::optional<std::string_view> The value, or nullopt if the key is not set
+     */
+    std::optional<std::string_view> find(std::string_view key) const;
+
+    /**
+     * @brief Get a configuration value
+     *
+     * @param key The configuration key
+     * @param defaultValue The value returned if the key is not set
+     * @return std::string_view The value, valid for the snapshot's lifetime
+     */
+    std::string_view getValue(std::string_view key, std::string_view defaultValue = {}) const;
+
+    /**
+     * @brief Check if a configuration key exists
+     *
+     * @param key The configuration key to check
+     * @return true if the key exists
+     * @return false if the key does not exist
+     */
+    bool hasKey(std::string_view key) const;
+
+    /**
+     * @brief Get all entries in key order
+     *
+     * @return const std::vector<Entry>& The configuration entries
+     */
+    const std::vector<Entry>& entries() const;
+
+    /**
+     * @brief Visit every entry whose key starts with @p prefix, in key order
+     *
+     * Finds the matching range with two binary searches and hands out views
+     * into the snapshot; nothing is copied.
+     *
+     * @param prefix The key prefix, e.g. "processing."
+     * @param visit Callable invoked as visit(std::string_view key, std::string_view value)
+     */
+    template <typename Visitor>
+    void forEachWithPrefix(std::string_view prefix, Visitor&& visit) const {
+        auto range = prefixRange(prefix);
+        for (auto it = range.first; it != range.second; ++it) {
+            visit(it->key, it->value);
+        }
+    }
+
+    /**
+     * @brief List the keys whose values differ from those in another snapshot
+     *
+     * Walks both sorted entry arrays once.
+     *
+     * @param newer The snapshot to compare against
+     * @return std::vector<ConfigChange> Added, removed and modified keys, in key order
+     */
+    std::vector<ConfigChange> diff(const ConfigSnapshot& newer) const;
+
+    /**
+     * @brief Get the lookup structure of this snapshot
+     *
+     * @return ConfigStorage The storage layout
+     */
+    ConfigStorage storage() const noexcept { return storage_; }
+
+    /**
+     * @brief Get the number of keys
+     *
+     * @return size_t The key count
+     */
+    size_t size() const noexcept;
+
+    /**
+     * @brief Get the version this snapshot was published as
+     *
+     * @return uint64_t The version number
+     */
+    uint64_t version() const noexcept { return version_; }
+
+  private:
+    using EntryIterator = std::vector<Entry>::const_iterator;
+
+    // Copy sorted, unique entries into a freshly allocated arena
+    void assign(const std::vector<Entry>& sorted);
+
+    // Build hash_slots_ for ConfigStorage::HASH
+    void buildHashIndex();
+
+    std::pair<EntryIterator, EntryIterator> prefixRange(std::string_view prefix) const;
+
+    std::unique_ptr<char[]> arena_;
+    std::shared_ptr<const ConfigImage> image_;
+    // Filled on first use for image snapshots, which copy nothing up front
+    mutable std::vector<Entry> entries_;
+    mutable std::once_flag entries_once_;
+    // Power-of-two table of entry index + 1 (0 marks an empty slot)
+    std::vector<uint32_t> hash_slots_;
+    uint64_t version_;
+    ConfigStorage storage_;
+};
+
 /**
  * @brief Configuration manager for application settings
  *
  * This class provides a centralized way to manage application configuration
  * and demonstrates modular architecture patterns.
+ *
+ * The configuration is held as an immutable ConfigSnapshot. Writers build a
+ * modified copy and publish it atomically under a writer mutex, so readers
+ * never take that mutex. Each thread caches the last snapshot it read and
+ * only reloads the shared pointer when version(), a single atomic load,
+ * has moved on; until the next publication, getValue(), hasKey(),
+ * getAllKeys() and forEachWithPrefix() are wait-free and snapshot() costs
+ * one reference count increment. The reload after a publication goes
+ * through std::atomic_load on the shared pointer, which libstdc++ guards
+ * with a pooled mutex. Hot paths should still take one snapshot per unit
+ * of work rather than calling getValue() per item, or read through a
+ * ConfigHandle. All members are safe to call concurrently.
+ *
+ * A thread's cached snapshot stays alive until that thread reads the
+ * manager again after a change, reads another manager sharing its cache
+ * slot, or exits, so an idle reader can keep a replaced snapshot (and the
+ * file it maps) around for a while.
+ *
+ * Subscribers are told which keys changed after every publication that
+ * changed any key they are interested in (see subscribe()), so components
+ * can react to a reload without polling or restarting.
  */
 class ConfigManager {
   public:
+    /**
+     * @brief Callback for configuration changes
+     *
+     * Receives the changed keys it subscribed to, in key order, and the
+     * snapshot that introduced them. Called on the thread that published
+     * the change (e.g. a ConfigWatcher thread), after the snapshot became
+     * current; calls are serialized and follow publication order. It may
+     * read the configuration but must not modify it, subscribe or
+     * unsubscribe, and must not throw.
+     */
+    using Subscriber = std::function<void(const std::vector<ConfigChange>& changes,
+                                          const ConfigSnapshot& current)>;
+
     /**
      * @brief Construct a new Config Manager object
+     *
+     * @param storage The lookup structure used for published snapshots
      */
-    ConfigManager();
+    explicit ConfigManager(ConfigStorage storage = ConfigStorage::HASH);
 
     /**
      * @brief Destroy the Config Manager object
      */
     ~ConfigManager() = default;
 
-    // Non-copyable but movable
+    // Non-copyable but movable (a moved-from manager may only be destroyed or assigned)
     ConfigManager(const ConfigManager&) = delete;
     ConfigManager& operator=(const ConfigManager&) = delete;
     ConfigManager(ConfigManager&&) = default;
     ConfigManager& operator=(ConfigManager&&) = default;
 
+    /**
+     * @brief Get the current configuration snapshot
+     *
+     * The returned snapshot stays valid and unchanged for as long as it is
+     * held, even if the configuration is updated or reloaded meanwhile.
+     * Served from the calling thread's cache unless the version changed
+     * (see the class notes).
+     *
+     * @return std::shared_ptr<const ConfigSnapshot> The current snapshot
+     */
+    std::shared_ptr<const ConfigSnapshot> snapshot() const;
+
+    /**
+     * @brief Get the version of the current snapshot
+     *
+     * Incremented on every published change; lets readers cheaply detect
+     * that a cached snapshot is stale.
+     *
+     * @return uint64_t The current version number
+     */
+    uint64_t version() const noexcept;
+
     /**
      * @brief Load configuration from a file
      *
+     * The file is memory-mapped and parsed in a single pass: one `key=value`
+     * per line, with lines that are empty or start with '#' skipped and
+     * spaces and tabs trimmed around keys and values. The previous values
+     * are replaced as a whole; a repeated key keeps its last value.
+     *
      * @param filename The configuration file path
      * @return true if loading was successful
      * @return false if loading failed
      */
     bool loadFromFile(const std::string& filename);
 
+    /**
+     * @brief Load configuration from a file that may be rewritten meanwhile
+     *
+     * Same format and replacement semantics as loadFromFile(), but the file
+     * is read into a buffer instead of being mapped: a mapping faults
+     * (SIGBUS) if another process truncates the file mid-parse, which is
+     * what an editor or deployment tool rewriting it in place does. A
+     * concurrent rewrite can at worst yield a partial file, which the next
+     * change notification replaces. ConfigWatcher reloads with this.
+     *
+     * @param filename The configuration file path
+     * @return true if loading was successful
+     * @return false if the file could not be read
+     */
+    bool reloadFromFile(const std::string& filename);
+
+    /**
+     * @brief Load a precompiled config image (see saveImage())
+     *
+     * The image is memory-mapped and validated (header, version, checksum,
+     * bounds), then published as the current snapshot as it is: there is
+     * no parsing, no copy of its strings, and values are served as views
+     * into the mapping. Like loadFromFile(), the image replaces the previous
+     * values as a whole; a rejected image leaves them untouched.
+     *
+     * @param filename The image file path
+     * @return true if the image was loaded
+     * @return false if the file is missing or not a valid image
+     */
+    bool loadFromImage(const std::string& filename);
+
+    /**
+     * @brief Compile the current configuration into a config image file
+     *
+     * @param filename The image file to create or atomically replace
+     * @return true if the image was written
+     * @return false if writing failed
+     */
+    bool saveImage(const std::string& filename) const;
+
     /**
      * @brief Set a configuration value
      *
@@ -82,22 +384,98 @@ class ConfigManager {
      */
     std::vector<std::string> getAllKeys() const;
 
+    /**
+     * @brief Visit the current values whose keys start with @p prefix
+     *
+     * Runs against one snapshot, which is held for the duration of the call.
+     *
+     * @param prefix The key prefix, e.g. "processing."
+     * @param visit Callable invoked as visit(std::string_view key, std::string_view value)
+     */
+    template <typename Visitor>
+    void forEachWithPrefix(std::string_view prefix, Visitor&& visit) const {
+        snapshot()->forEachWithPrefix(prefix, std::forward<Visitor>(visit));
+    }
+
+    /**
+     * @brief Get notified when keys under a prefix change
+     *
+     * Publications that leave every matching key as it was (setting a key
+     * to its current value, reloading an unchanged file) do not notify.
+     *
+     * @param prefix Key prefix of interest, e.g. "processing."; empty for every key
+     * @param subscriber The callback
+     * @return uint64_t Subscription id for unsubscribe()
+     */
+    uint64_t subscribe(std::string prefix, Subscriber subscriber);
+
+    /**
+     * @brief Cancel a subscription; its callback does not run once this returns
+     *
+     * @param id The id returned by subscribe()
+     * @return true if the subscription existed
+     */
+    bool unsubscribe(uint64_t id);
+
+    /**
+     * @brief Get the lookup structure used for snapshots
+     *
+     * @return ConfigStorage The storage layout
+     */
+    ConfigStorage storage() const noexcept;
+
     /**
      * @brief Clear all configuration values
      */
     void clear();
 
   private:
-    std::map<std::string, std::string> config_data_;
-    bool is_loaded_;
+    struct Subscription {
+        uint64_t id;
+        std::string prefix;
+        Subscriber callback;
+    };
+
+    struct State {
+        uint64_t id = 0;  // Key of this manager in the per-thread snapshot caches
+        std::mutex writer_mutex;
+        std::shared_ptr<const ConfigSnapshot> current;
+        std::atomic<uint64_t> version{0};
+        ConfigStorage storage = ConfigStorage::HASH;
+        bool is_loaded = false;
+
+        // Held while notifying, so callbacks run one at a time and in order
+        std::mutex subscriber_mutex;
+        std::vector<Subscription> subscriptions;
+        std::atomic<size_t> subscription_count{0};
+        uint64_t next_subscription_id = 1;
+    };
+
+    // The calling thread's cached current snapshot, reloaded if the version
+    // changed; valid until this thread reads a manager again
+    const std::shared_ptr<const ConfigSnapshot>& cachedSnapshot() const;
+
+    // Version number for the next snapshot; the caller holds writer_mutex
+    uint64_t nextVersion() const noexcept;
+
+    // Parse configuration text and publish it as the new snapshot
+    void publishText(std::string_view text);
+
+    // Make a snapshot current and notify subscribers of what changed. Takes
+    // the writer lock the caller acquired and releases it before notifying.
+    void publish(std::unique_lock<std::mutex> writer_lock,
+                 std::shared_ptr<const ConfigSnapshot> snapshot);
+
+    std::unique_ptr<State> state_;
 };
 
 /**
  * @brief Factory function to create a ConfigManager instance
  *
+ * @param storage The lookup structure used for published snapshots
  * @return std::unique_ptr<ConfigManager> A unique pointer to the created instance
  */
-std::unique_ptr<ConfigManager> createConfigManager();
+std::unique_ptr<ConfigManager> createConfigManager(ConfigStorage storage = ConfigStorage::HASH);
 
 }  // namespace modules
 }  // namespace cpp_template
@@ -0,0 +1,24 @@
+#include "config_watcher.h"
+#include <core/trace.h>
+#include <utility>
+
+namespace cpp_template {
+namespace modules {
+
+ConfigWatcher::ConfigWatcher(ConfigManager& config, std::string filename)
+    : config_(config), watcher_(std::move(filename), [this] { reload(); }) {
+    reload();
+}
+
+void ConfigWatcher::reload() {
+    CORE_TRACE_SCOPE("ConfigWatcher::reload");
+    std::lock_guard<std::mutex> lock(reload_mutex_);
+    if (config_.reloadFromFile(watcher_.path())) {
+        reloads_.fetch_add(1, std::memory_order_acq_rel);
+    } else {
+        failures_.fetch_add(1, std::memory_order_acq_rel);
+    }
+}
+
+}  // namespace modules
+}  // namespace cpp_template
@@ -0,0 +1,94 @@
+#pragma once
+
+/**
+ * @file config_watcher.h
+ * @brief Hot reload of a ConfigManager from a watched file
+ *
+ * The watcher thread reparses the file whenever it is written or replaced
+ * and publishes the result as one new snapshot, so readers switch from the
+ * old configuration to the new one atomically and never see it half
+ * loaded. Subscribers of the manager are then told which keys changed.
+ */
+
+#include <core/file_watcher.h>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include "config_manager.h"
+
+namespace cpp_template {
+namespace modules {
+
+/**
+ * @brief Keeps a ConfigManager in sync with a configuration file
+ *
+ * Every reload replaces the configuration as a whole through
+ * ConfigManager::reloadFromFile(), which reads the file rather than mapping
+ * it, so a concurrent rewrite cannot fault the reload. A reload that fails
+ * (the file is missing or unreadable) keeps the current configuration.
+ */
+class ConfigWatcher {
+  public:
+    /**
+     * @brief Start watching @p filename, then load it once
+     *
+     * Watching starts before the initial load, so no change made after
+     * construction is missed. Loads never overlap: a change reloaded while
+     * the initial load runs is published after it, not overwritten by it.
+     *
+     * @param config The manager to load into; must outlive the watcher
+     * @param filename The configuration file; its directory must exist
+     * @throws std::system_error if the file cannot be watched
+     */
+    ConfigWatcher(ConfigManager& config, std::string filename);
+
+    /**
+     * @brief Stop watching the file
+     */
+    ~ConfigWatcher() = default;
+
+    // Non-copyable and non-movable: the watcher thread holds a pointer to the object
+    ConfigWatcher(const ConfigWatcher&) = delete;
+    ConfigWatcher& operator=(const ConfigWatcher&) = delete;
+
+    /**
+     * @brief Stop reloading; no reload runs once this returns
+     */
+    void stop() { watcher_.stop(); }
+
+    /**
+     * @brief Get the watched file
+     *
+     * @return const std::string& The configuration file path
+     */
+    const std::string& filename() const noexcept { return watcher_.path(); }
+
+    /**
+     * @brief Get the number of successful loads, the initial one included
+     *
+     * @return uint64_t The reload count
+     */
+    uint64_t reloads() const noexcept { return reloads_.load(std::memory_order_acquire); }
+
+    /**
+     * @brief Get the number of loads that failed and kept the previous configuration
+     *
+     * @return uint64_t The failure count
+     */
+    uint64_t failures() const noexcept { return failures_.load(std::memory_order_acquire); }
+
+  private:
+    void reload();
+
+    ConfigManager& config_;
+    std::atomic<uint64_t> reloads_{0};
+    std::atomic<uint64_t> failures_{0};
+    // Serializes the constructor's load with the watcher thread's, so an
+    // older read of the file is never published after a newer one
+    std::mutex reload_mutex_;
+    core::FileWatcher watcher_;  // Last, so its thread stops before the rest is destroyed
+};
+
+}  // namespace modules
+}  // namespace cpp_template
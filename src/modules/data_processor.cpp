@@ -1,21 +1,49 @@
 #include "data_processor.h"
+#include <core/cpu_topology.h>
+#include <core/memory_tracking.h>
+#include <core/string_builder.h>
+#include <core/tokenizer.h>
+#include <core/trace.h>
 #include <core/utils.h>
 #include <algorithm>
+#include <chrono>
 #include <iostream>
+#include <iterator>
+#include <optional>
 #include <sstream>
+#include <stdexcept>
+#include <thread>
 
 namespace cpp_template {
 namespace modules {
 
+namespace {
+
+// Resolve the mode once and hand the specialized processor to fn, so loops
+// inside fn are compiled per mode with no per-item dispatch
+template <typename Fn>
+decltype(auto) withProcessor(ProcessingMode mode, Fn&& fn) {
+    size_t index = static_cast<size_t>(mode);
+    if (index < BuiltinModes::kCount) {
+        return BuiltinModes::dispatch(index, std::forward<Fn>(fn));
+    }
+    return fn(BasicDataProcessor<UnknownMode>{});
+}
+
+}  // namespace
+
 DataProcessor::DataProcessor(std::shared_ptr<ConfigManager> config_manager)
-    : config_manager_(config_manager), total_processed_(0), successful_operations_(0),
-      failed_operations_(0) {
+    : config_manager_(config_manager) {
     if (!config_manager_) {
         throw std::invalid_argument("ConfigManager cannot be null");
     }
+    settings_ = std::make_unique<Settings>(*config_manager_);
+    cache_ = std::make_unique<ResultCache>();
 }
 
 ProcessingResult DataProcessor::processItem(const std::string& input, ProcessingMode mode) {
+    CORE_TRACE_SCOPE("DataProcessor::processItem");
+    CORE_MEMORY_SCOPE(DATA_PROCESSOR);
     ProcessingResult result;
 
     try {
@@ -23,22 +51,22 @@ ProcessingResult DataProcessor::processItem(const std::string& input, Processing
         if (input.empty()) {
             result.success = false;
             result.error_message = "Input cannot be empty";
-            failed_operations_++;
+            failed_operations_.add();
             return result;
         }
 
         // Apply processing based on mode
-        result.result = applyProcessing(input, mode);
+        result.result = applyTimed(input, mode);
         result.success = true;
         result.processed_items = 1;
 
-        successful_operations_++;
-        total_processed_++;
+        successful_operations_.add();
+        total_processed_.add();
 
     } catch (const std::exception& e) {
         result.success = false;
         result.error_message = e.what();
-        failed_operations_++;
+        failed_operations_.add();
     }
 
     return result;
@@ -46,40 +74,211 @@ ProcessingResult DataProcessor::processItem(const std::string& input, Processing
 
 ProcessingResult DataProcessor::processBatch(const std::vector<std::string>& inputs,
                                              ProcessingMode mode) {
+    CORE_TRACE_SCOPE("DataProcessor::processBatch");
+    CORE_MEMORY_SCOPE(DATA_PROCESSOR);
     ProcessingResult result;
     std::vector<std::string> processed_items;
 
     try {
-        // Get batch size from configuration
-        int batch_size = std::stoi(config_manager_->getValue("processing.batch_size", "10"));
-
-        if (inputs.size() > static_cast<size_t>(batch_size)) {
+        // Check the batch against the configured limits
+        int thread_count = 1;
+        int chunk_size = 1;
+        std::string error = checkBatch(inputs.size(), thread_count, chunk_size);
+        if (!error.empty()) {
             result.success = false;
-            result.error_message =
-                "Batch size exceeds configured limit of " + std::to_string(batch_size);
-            failed_operations_++;
+            result.error_message = std::move(error);
+            failed_operations_.add();
             return result;
         }
 
-        for (const auto& input : inputs) {
-            if (!input.empty()) {
-                std::string processed = applyProcessing(input, mode);
-                processed_items.push_back(processed);
+        std::vector<std::string_view> views;
+        std::shared_ptr<core::ThreadPool> pool;
+        std::optional<WorkerContexts> arenas;
+        if (thread_count != 1 && inputs.size() > static_cast<size_t>(chunk_size)) {
+            // Each chunk writes its own slots, so output order matches input order;
+            // the results live in the arena of the worker that produced them
+            pool = threadPool(static_cast<size_t>(thread_count));
+            arenas.emplace(*pool);
+            views.resize(inputs.size());
+            pool->parallelFor(inputs.size(), static_cast<size_t>(chunk_size),
+                              [&](size_t begin, size_t end) {
+                                  CORE_TRACE_SCOPE("DataProcessor::processBatch chunk");
+                                  CORE_MEMORY_SCOPE(DATA_PROCESSOR);
+                                  ProcessingContext& arena = arenas->local();
+                                  for (size_t i = begin; i < end; ++i) {
+                                      if (!inputs[i].empty()) {
+                                          views[i] = applyTimed(inputs[i], mode, arena);
+                                      }
+                                  }
+                              });
+
+            // Processed items are never empty, so empty slots mark skipped inputs
+            views.erase(std::remove_if(views.begin(), views.end(),
+                                       [](std::string_view item) { return item.empty(); }),
+                        views.end());
+        } else {
+            for (const auto& input : inputs) {
+                if (!input.empty()) {
+                    processed_items.push_back(applyTimed(input, mode));
+                }
             }
+            views.assign(processed_items.begin(), processed_items.end());
         }
 
-        // Join all processed items
-        result.result = cpp_template::core::utils::string::join(processed_items, ", ");
+        // Join all processed items into one buffer sized up front
+        CORE_TRACE_SCOPE("DataProcessor::processBatch join");
+        core::utils::string::StringBuilder joined;
+        joined.appendJoined(views, ", ");
+        result.result = std::move(joined).release();
         result.success = true;
-        result.processed_items = processed_items.size();
+        result.processed_items = views.size();
 
-        successful_operations_++;
-        total_processed_ += processed_items.size();
+        successful_operations_.add();
+        total_processed_.add(views.size());
 
     } catch (const std::exception& e) {
         result.success = false;
         result.error_message = e.what();
-        failed_operations_++;
+        failed_operations_.add();
+    }
+
+    return result;
+}
+
+ProcessingResult DataProcessor::processStream(const ItemSource& source, const ItemSink& sink,
+                                              ProcessingMode mode) {
+    CORE_TRACE_SCOPE("DataProcessor::processStream");
+    CORE_MEMORY_SCOPE(DATA_PROCESSOR);
+    ProcessingResult result;
+    size_t processed_count = 0;
+
+    try {
+        auto [thread_count, window_size] =
+            getConsistent(settings_->threads, settings_->stream_buffer);
+        if (thread_count < 0 || window_size <= 0) {
+            throw std::invalid_argument("Invalid processing.threads or processing.stream_buffer");
+        }
+
+        // Input and output slots are reused for every window
+        std::vector<std::string> window(static_cast<size_t>(window_size));
+        std::vector<std::string> outputs(window.size());
+        bool exhausted = false;
+
+        while (!exhausted) {
+            size_t filled = 0;
+            while (filled < window.size()) {
+                if (!source(window[filled])) {
+                    exhausted = true;
+                    break;
+                }
+                if (!window[filled].empty()) {
+                    ++filled;
+                }
+            }
+
+            auto process_range = [&](size_t begin, size_t end) {
+                for (size_t i = begin; i < end; ++i) {
+                    outputs[i] = applyTimed(window[i], mode);
+                }
+            };
+            if (thread_count != 1 && filled > 1) {
+                threadPool(static_cast<size_t>(thread_count))
+                    ->parallelFor(filled, 0, process_range);
+            } else {
+                process_range(0, filled);
+            }
+
+            for (size_t i = 0; i < filled; ++i) {
+                sink(std::move(outputs[i]));
+            }
+            processed_count += filled;
+        }
+
+        result.success = true;
+        result.processed_items = processed_count;
+
+        successful_operations_.add();
+        total_processed_.add(processed_count);
+
+    } catch (const std::exception& e) {
+        result.success = false;
+        result.error_message = e.what();
+        result.processed_items = processed_count;
+        failed_operations_.add();
+    }
+
+    return result;
+}
+
+ProcessingResult DataProcessor::processRecords(std::string_view input, char separator,
+                                               const RecordSink& sink, ProcessingMode mode) {
+    CORE_TRACE_SCOPE("DataProcessor::processRecords");
+    CORE_MEMORY_SCOPE(DATA_PROCESSOR);
+    ProcessingResult result;
+    size_t processed_count = 0;
+
+    try {
+        auto [thread_count, window_size] =
+            getConsistent(settings_->threads, settings_->stream_buffer);
+        if (thread_count < 0 || window_size <= 0) {
+            throw std::invalid_argument("Invalid processing.threads or processing.stream_buffer");
+        }
+
+        // The window holds views into input; only the outputs are materialized
+        std::vector<std::string_view> window;
+        window.reserve(static_cast<size_t>(window_size));
+        core::utils::string::StringBatch outputs;
+
+        withProcessor(mode, [&](auto processor) {
+            auto process_window = [&] {
+                char* output = outputs.layout(
+                    window.size(), [&](size_t i) { return processor.size(window[i]); });
+                const core::utils::string::StringBatch::offset_type* offsets = outputs.offsets();
+
+                auto write_range = [&](size_t begin, size_t end) {
+                    for (size_t i = begin; i < end; ++i) {
+                        auto start = std::chrono::steady_clock::now();
+                        processor.write(window[i], output + offsets[i]);
+                        recordLatency(mode, start);
+                    }
+                };
+                if (thread_count != 1 && window.size() > 1) {
+                    threadPool(static_cast<size_t>(thread_count))
+                        ->parallelFor(window.size(), 0, write_range);
+                } else {
+                    write_range(0, window.size());
+                }
+
+                sink(outputs);
+                processed_count += window.size();
+                window.clear();
+            };
+
+            for (std::string_view record : core::utils::string::tokens(input, separator)) {
+                if (record.empty()) {
+                    continue;
+                }
+                window.push_back(record);
+                if (window.size() == static_cast<size_t>(window_size)) {
+                    process_window();
+                }
+            }
+            if (!window.empty()) {
+                process_window();
+            }
+        });
+
+        result.success = true;
+        result.processed_items = processed_count;
+
+        successful_operations_.add();
+        total_processed_.add(processed_count);
+
+    } catch (const std::exception& e) {
+        result.success = false;
+        result.error_message = e.what();
+        result.processed_items = processed_count;
+        failed_operations_.add();
     }
 
     return result;
@@ -87,62 +286,245 @@ ProcessingResult DataProcessor::processBatch(const std::vector<std::string>& inp
 
 void DataProcessor::setProcessingConfig(const std::string& key, const std::string& value) {
     config_manager_->setValue("processing." + key, value);
+
+    static const char* const tuning_keys[] = {"batch_size", "threads", "chunk_size",
+                                              "stream_buffer", "cache_bytes"};
+    bool tuning = std::any_of(std::begin(tuning_keys), std::end(tuning_keys),
+                              [&key](const char* tuning_key) { return key == tuning_key; });
+    if (!tuning) {
+        settings_->cache_generation.fetch_add(1, std::memory_order_acq_rel);
+        cache_->clear();
+    } else if (key == "cache_bytes") {
+        // Otherwise applied on the next lookup; release memory right away
+        cache_->setCapacity(settings_->cache_bytes.get());
+    }
+}
+
+std::map<std::string, std::string> DataProcessor::getProcessingConfig() const {
+    constexpr std::string_view prefix = "processing.";
+    std::map<std::string, std::string> settings;
+    config_manager_->forEachWithPrefix(prefix, [&](std::string_view key, std::string_view value) {
+        settings.emplace(key.substr(prefix.size()), value);
+    });
+    return settings;
 }
 
 std::string DataProcessor::getStatistics() const {
+    ProcessingStatistics snapshot = getStatisticsSnapshot();
+
     std::ostringstream stats;
     stats << "Processing Statistics:\n";
-    stats << "  Total Processed: " << total_processed_ << "\n";
-    stats << "  Successful Operations: " << successful_operations_ << "\n";
-    stats << "  Failed Operations: " << failed_operations_ << "\n";
+    stats << "  Total Processed: " << snapshot.total_processed << "\n";
+    stats << "  Successful Operations: " << snapshot.successful_operations << "\n";
+    stats << "  Failed Operations: " << snapshot.failed_operations << "\n";
     stats << "  Success Rate: ";
 
-    if (successful_operations_ + failed_operations_ > 0) {
-        double success_rate = static_cast<double>(successful_operations_) /
-                              (successful_operations_ + failed_operations_) * 100.0;
-        stats << success_rate << "%";
+    if (snapshot.successful_operations + snapshot.failed_operations > 0) {
+        stats << snapshot.successRate() << "%";
     } else {
         stats << "N/A";
     }
 
+    static const char* const mode_names[kProcessingModeCount] = {"SIMPLE", "ADVANCED", "BATCH"};
+    for (size_t i = 0; i < kProcessingModeCount; ++i) {
+        const core::LatencySnapshot& latency = snapshot.latency[i];
+        if (latency.count == 0) {
+            continue;
+        }
+        stats << "\n  Latency " << mode_names[i] << ": count=" << latency.count
+              << " p50=" << latency.p50_ns << "ns p99=" << latency.p99_ns
+              << "ns max=" << latency.max_ns << "ns";
+    }
+
+    const ResultCacheStatistics& cache = snapshot.cache;
+    if (cache.capacity_bytes > 0 || cache.hits + cache.misses > 0) {
+        stats << "\n  Cache: hits=" << cache.hits << " misses=" << cache.misses
+              << " hit_rate=" << cache.hitRate() << "% entries=" << cache.entries
+              << " bytes=" << cache.bytes << "/" << cache.capacity_bytes;
+    }
+
+    for (size_t i = 0; i < core::memory::kSubsystemCount; ++i) {
+        const core::memory::AllocationStatistics& memory = snapshot.memory[i];
+        if (memory.allocations == 0 && memory.current_bytes == 0) {
+            continue;
+        }
+        auto subsystem = static_cast<core::memory::Subsystem>(i);
+        stats << "\n  Memory " << core::memory::subsystemName(subsystem)
+              << ": allocations=" << memory.allocations << " bytes=" << memory.bytes_allocated
+              << " current=" << memory.current_bytes << " peak=" << memory.peak_bytes;
+    }
+
     return stats.str();
 }
 
+ProcessingStatistics DataProcessor::getStatisticsSnapshot() const {
+    ProcessingStatistics snapshot;
+    snapshot.total_processed = total_processed_.value();
+    snapshot.successful_operations = successful_operations_.value();
+    snapshot.failed_operations = failed_operations_.value();
+    for (size_t i = 0; i < kProcessingModeCount; ++i) {
+        snapshot.latency[i] = latency_[i].snapshot();
+    }
+    snapshot.cache = cache_->statistics();
+    if (core::memory::trackingActive()) {
+        for (size_t i = 0; i < core::memory::kSubsystemCount; ++i) {
+            snapshot.memory[i] = core::memory::statistics(static_cast<core::memory::Subsystem>(i));
+        }
+    }
+    return snapshot;
+}
+
 void DataProcessor::resetStatistics() {
-    total_processed_ = 0;
-    successful_operations_ = 0;
-    failed_operations_ = 0;
+    total_processed_.reset();
+    successful_operations_.reset();
+    failed_operations_.reset();
+    for (auto& histogram : latency_) {
+        histogram.reset();
+    }
+    cache_->resetStatistics();
+}
+
+std::shared_ptr<core::ThreadPool> DataProcessor::threadPool(size_t thread_count) {
+    if (thread_count == 0) {
+        thread_count = core::effectiveConcurrency();
+    }
+    auto pool = std::atomic_load_explicit(&thread_pool_, std::memory_order_acquire);
+    if (!pool || pool->size() != thread_count) {
+        // Racing callers may each build a pool; the last one published is kept
+        pool = std::make_shared<core::ThreadPool>(thread_count,
+                                                  core::WorkerPlacement::PER_NODE);
+        std::atomic_store_explicit(&thread_pool_, pool, std::memory_order_release);
+    }
+    return pool;
+}
+
+std::string DataProcessor::applyTimed(const std::string& input, ProcessingMode mode) {
+    auto start = std::chrono::steady_clock::now();
+    std::string processed = applyProcessing(input, mode);
+    recordLatency(mode, start);
+    return processed;
+}
+
+std::string_view DataProcessor::applyTimed(const std::string& input, ProcessingMode mode,
+                                           ProcessingContext& context) {
+    auto start = std::chrono::steady_clock::now();
+    std::string_view processed;
+    if (settings_->cache_bytes.get() != 0 || cache_->enabled()) {
+        // applyProcessing() also applies capacity changes, including turning the cache off
+        processed = context.store(applyProcessing(input, mode));
+    } else {
+        size_t size = processedSize(input, mode);
+        char* output = context.allocate(size);
+        writeProcessed(input, mode, output);
+        processed = std::string_view(output, size);
+    }
+    recordLatency(mode, start);
+    return processed;
+}
+
+void DataProcessor::recordLatency(ProcessingMode mode,
+                                  std::chrono::steady_clock::time_point start) {
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    size_t index = static_cast<size_t>(mode);
+    if (index < kProcessingModeCount) {
+        latency_[index].record(static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()));
+    }
 }
 
 std::string DataProcessor::applyProcessing(const std::string& input, ProcessingMode mode) {
-    std::string processing_mode = config_manager_->getValue("processing.mode", "simple");
-
-    switch (mode) {
-        case ProcessingMode::SIMPLE:
-            // Simple processing: convert to uppercase and add prefix
-            return "[SIMPLE] " + cpp_template::core::utils::string::toUpper(input);
-
-        case ProcessingMode::ADVANCED:
-            // Advanced processing: reverse string and convert to lowercase
-            {
-                std::string reversed = input;
-                std::reverse(reversed.begin(), reversed.end());
-                return "[ADVANCED] " + cpp_template::core::utils::string::toLower(reversed);
-            }
+    size_t cache_bytes = settings_->cache_bytes.get();
+    if (cache_bytes != cache_->capacity()) {
+        cache_->setCapacity(cache_bytes);
+    }
 
-        case ProcessingMode::BATCH:
-            // Batch processing: add batch identifier and trim
-            {
-                std::string trimmed = input;
-                // Simple trim implementation
-                trimmed.erase(0, trimmed.find_first_not_of(" \t\n\r"));
-                trimmed.erase(trimmed.find_last_not_of(" \t\n\r") + 1);
-                return "[BATCH] " + trimmed;
-            }
+    // The low byte of the cache variant is the mode, the rest the generation
+    uint64_t variant = 0;
+    if (cache_->enabled()) {
+        variant = (settings_->cache_generation.load(std::memory_order_acquire) << 8) |
+                  static_cast<uint8_t>(mode);
+        if (auto cached = cache_->find(input, variant)) {
+            return std::move(*cached);
+        }
+    }
+
+    // Build the output in place instead of concatenating temporaries
+    std::string output(processedSize(input, mode), '\0');
+    writeProcessed(input, mode, output.data());
+
+    if (cache_->enabled()) {
+        cache_->insert(input, variant, output);
+    }
+    return output;
+}
+
+size_t DataProcessor::processedSize(std::string_view input, ProcessingMode mode) {
+    return withProcessor(mode, [input](auto processor) { return processor.size(input); });
+}
+
+void DataProcessor::writeProcessed(std::string_view input, ProcessingMode mode, char* output) {
+    withProcessor(mode, [input, output](auto processor) { processor.write(input, output); });
+}
+
+ProcessingResultView DataProcessor::processItem(std::string_view input, ProcessingMode mode,
+                                                ProcessingContext& context) {
+    CORE_TRACE_SCOPE("DataProcessor::processItem");
+    CORE_MEMORY_SCOPE(DATA_PROCESSOR);
+    ProcessingResultView result;
+
+    if (input.empty()) {
+        result.error_message = context.store("Input cannot be empty");
+        failed_operations_.add();
+        return result;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    size_t size = processedSize(input, mode);
+    char* output = context.allocate(size);
+    writeProcessed(input, mode, output);
+    recordLatency(mode, start);
+
+    result.result = std::string_view(output, size);
+    result.success = true;
+    result.processed_items = 1;
+
+    successful_operations_.add();
+    total_processed_.add();
+    return result;
+}
+
+ProcessingResultView DataProcessor::processBatch(const std::vector<std::string>& inputs,
+                                                 ProcessingMode mode, ProcessingContext& context) {
+    CORE_TRACE_SCOPE("DataProcessor::processBatch");
+    CORE_MEMORY_SCOPE(DATA_PROCESSOR);
+    return withProcessor(mode, [&](auto processor) {
+        return processBatchWith<typename decltype(processor)::Policy>(inputs, context);
+    });
+}
+
+ProcessingResult DataProcessor::processBatch(const core::utils::string::StringBatch& inputs,
+                                             ProcessingMode mode,
+                                             core::utils::string::StringBatch& outputs) {
+    CORE_TRACE_SCOPE("DataProcessor::processBatch columnar");
+    CORE_MEMORY_SCOPE(DATA_PROCESSOR);
+    return withProcessor(mode, [&](auto processor) {
+        return processBatchWith<typename decltype(processor)::Policy>(inputs, outputs);
+    });
+}
+
+std::string DataProcessor::checkBatch(size_t count, int& thread_count, int& chunk_size) const {
+    // One publication for all three, as a configuration change is applied as a whole
+    int batch_size = 0;
+    std::tie(batch_size, thread_count, chunk_size) =
+        getConsistent(settings_->batch_size, settings_->threads, settings_->chunk_size);
+    if (count > static_cast<size_t>(batch_size)) {
+        return "Batch size exceeds configured limit of " + std::to_string(batch_size);
+    }
 
-        default:
-            return "[UNKNOWN] " + input;
+    if (thread_count < 0 || chunk_size <= 0) {
+        throw std::invalid_argument("Invalid processing.threads or processing.chunk_size");
     }
+    return {};
 }
 
 std::unique_ptr<DataProcessor> createDataProcessor(std::shared_ptr<ConfigManager> config_manager) {
@@ -8,10 +8,27 @@
  * inter-module dependencies within the cpp-template project.
  */
 
+#include <core/memory_tracking.h>
+#include <core/statistics.h>
+#include <core/string_batch.h>
+#include <core/thread_pool.h>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <map>
 #include <memory>
+#include <stdexcept>
 #include <string>
+#include <string_view>
 #include <vector>
+#include "config_handle.h"
 #include "config_manager.h"
+#include "processing_context.h"
+#include "processing_modes.h"
+#include "result_cache.h"
 
 namespace cpp_template {
 namespace modules {
@@ -25,6 +42,49 @@ enum class ProcessingMode {
     BATCH
 };
 
+/**
+ * @brief Number of built-in processing modes
+ */
+constexpr size_t kProcessingModeCount = BuiltinModes::kCount;
+
+static_assert(BuiltinModes::indexOf<SimpleMode>() == static_cast<size_t>(ProcessingMode::SIMPLE) &&
+                  BuiltinModes::indexOf<AdvancedMode>() ==
+                      static_cast<size_t>(ProcessingMode::ADVANCED) &&
+                  BuiltinModes::indexOf<BatchMode>() == static_cast<size_t>(ProcessingMode::BATCH),
+              "BuiltinModes must be indexed by ProcessingMode values");
+
+/**
+ * @brief Point-in-time view of DataProcessor statistics
+ */
+struct ProcessingStatistics {
+    uint64_t total_processed = 0;
+    uint64_t successful_operations = 0;
+    uint64_t failed_operations = 0;
+
+    // Per-item processing latency, indexed by static_cast<size_t>(ProcessingMode)
+    std::array<core::LatencySnapshot, kProcessingModeCount> latency{};
+
+    // Result cache counters; all zero while `processing.cache_bytes` is 0
+    ResultCacheStatistics cache;
+
+    // Process-wide heap counters, indexed by static_cast<size_t>(core::memory::Subsystem); all
+    // zero unless core-memory-hooks is linked. Not cleared by DataProcessor::resetStatistics().
+    std::array<core::memory::AllocationStatistics, core::memory::kSubsystemCount> memory{};
+
+    /**
+     * @brief Get the success rate in percent
+     *
+     * @return double Successful operations over all operations, or 0 if none ran
+     */
+    double successRate() const noexcept {
+        uint64_t total = successful_operations + failed_operations;
+        if (total == 0) {
+            return 0.0;
+        }
+        return static_cast<double>(successful_operations) / static_cast<double>(total) * 100.0;
+    }
+};
+
 /**
  * @brief Result of a data processing operation
  */
@@ -37,14 +97,54 @@ struct ProcessingResult {
     ProcessingResult() : success(false), processed_items(0) {}
 };
 
+/**
+ * @brief Result of a processing operation whose strings live in a ProcessingContext
+ *
+ * The views stay valid until the context they were produced with is reset
+ * or destroyed.
+ */
+struct ProcessingResultView {
+    bool success = false;
+    std::string_view result;
+    std::string_view error_message;
+    size_t processed_items = 0;
+};
+
 /**
  * @brief Data processor for various data transformation operations
  *
  * This class demonstrates modular architecture by depending on the
  * ConfigManager module and providing data processing capabilities.
+ *
+ * The processing and statistics members may be called concurrently from any
+ * number of threads (counters are sharded, and the settings a call uses are
+ * read together from one config version); IngestPipeline relies on this to
+ * feed one processor from a pool of workers. A ProcessingContext must still
+ * not be shared.
  */
 class DataProcessor {
   public:
+    /**
+     * @brief Pull-style item source for streaming processing
+     *
+     * Called repeatedly; writes the next item into the provided (reused)
+     * string and returns false once the input is exhausted.
+     */
+    using ItemSource = std::function<bool(std::string& item)>;
+
+    /**
+     * @brief Consumer for processed items, called in input order
+     */
+    using ItemSink = std::function<void(std::string&& processed)>;
+
+    /**
+     * @brief Consumer for windows of processed records, called in input order
+     *
+     * Gets one row per non-empty input record. The batch is reused for the
+     * next window, so its rows must be consumed before the call returns.
+     */
+    using RecordSink = std::function<void(const core::utils::string::StringBatch& processed)>;
+
     /**
      * @brief Construct a new Data Processor object
      *
@@ -66,6 +166,11 @@ class DataProcessor {
     /**
      * @brief Process a single data item
      *
+     * When `processing.cache_bytes` is above 0, results are kept in a
+     * sharded LRU cache of that many bytes and repeated inputs are served
+     * from it. The string-returning processItem(), processBatch() and
+     * processStream() share the cache; the arena overloads bypass it.
+     *
      * @param input The input data to process
      * @param mode The processing mode to use
      * @return ProcessingResult The result of the processing operation
@@ -73,9 +178,30 @@ class DataProcessor {
     ProcessingResult processItem(const std::string& input,
                                  ProcessingMode mode = ProcessingMode::SIMPLE);
 
+    /**
+     * @brief Process a single data item into an arena
+     *
+     * Same semantics as processItem(), but the output and any error message
+     * are written straight into @p context with no heap allocation per call.
+     *
+     * @param input The input data to process
+     * @param mode The processing mode to use
+     * @param context The arena receiving the result strings
+     * @return ProcessingResultView The result, referencing memory in @p context
+     */
+    ProcessingResultView processItem(std::string_view input, ProcessingMode mode,
+                                     ProcessingContext& context);
+
     /**
      * @brief Process multiple data items
      *
+     * When `processing.threads` is not 1 (0 means one per CPU the process may
+     * use, see core::effectiveConcurrency()), batches larger than
+     * `processing.chunk_size` items (default 1024) are split into chunks and
+     * processed on a thread pool that is reused across calls. The pool's
+     * workers are pinned to NUMA nodes and write results into arenas of
+     * their own. The joined result keeps the input order either way.
+     *
      * @param inputs Vector of input data to process
      * @param mode The processing mode to use
      * @return ProcessingResult The result of the batch processing operation
@@ -83,42 +209,439 @@ class DataProcessor {
     ProcessingResult processBatch(const std::vector<std::string>& inputs,
                                   ProcessingMode mode = ProcessingMode::BATCH);
 
+    /**
+     * @brief Process multiple data items into an arena
+     *
+     * Same semantics and settings as processBatch(). Every item is sized
+     * first, then written directly at its final offset inside one joined
+     * buffer allocated from @p context, so no per-item strings are built.
+     *
+     * @param inputs Vector of input data to process
+     * @param mode The processing mode to use
+     * @param context The arena receiving the result strings
+     * @return ProcessingResultView The result, referencing memory in @p context
+     */
+    ProcessingResultView processBatch(const std::vector<std::string>& inputs, ProcessingMode mode,
+                                      ProcessingContext& context);
+
+    /**
+     * @brief Process multiple data items with a compile-time mode policy
+     *
+     * The arena processBatch() for any mode policy, including custom ones
+     * that have no ProcessingMode value; the per-item loop is instantiated
+     * for the policy. Latency is recorded only for the built-in modes.
+     *
+     * @tparam ModePolicy A mode policy providing kName and kPipeline
+     * @param inputs Vector of input data to process
+     * @param context The arena receiving the result strings
+     * @return ProcessingResultView The result, referencing memory in @p context
+     */
+    template <typename ModePolicy>
+    ProcessingResultView processBatchWith(const std::vector<std::string>& inputs,
+                                          ProcessingContext& context);
+
+    /**
+     * @brief Process a columnar batch into another columnar batch
+     *
+     * Same settings as processBatch(), but the results are not joined:
+     * @p outputs gets one row per input row, in order, with an empty row
+     * for every empty input. The output lengths are computed first and each
+     * row is written at its final offset in a single byte buffer, so large
+     * batches are read and written with sequential scans, and the output
+     * can be handed to an Arrow consumer as it is.
+     *
+     * @param inputs The input rows
+     * @param mode The processing mode to use
+     * @param outputs The batch receiving the processed rows; its buffers are reused
+     * @return ProcessingResult Success flag and non-empty row count; result is left empty
+     */
+    ProcessingResult processBatch(const core::utils::string::StringBatch& inputs,
+                                  ProcessingMode mode,
+                                  core::utils::string::StringBatch& outputs);
+
+    /**
+     * @brief Process a columnar batch with a compile-time mode policy
+     *
+     * The columnar processBatch() for any mode policy, including custom
+     * ones that have no ProcessingMode value.
+     *
+     * @tparam ModePolicy A mode policy providing kName and kPipeline
+     * @param inputs The input rows
+     * @param outputs The batch receiving the processed rows; may be @p inputs
+     * @return ProcessingResult Success flag and non-empty row count; result is left empty
+     */
+    template <typename ModePolicy>
+    ProcessingResult processBatchWith(const core::utils::string::StringBatch& inputs,
+                                      core::utils::string::StringBatch& outputs);
+
+    /**
+     * @brief Process a stream of items without materializing the batch
+     *
+     * Items are pulled from @p source into a window of at most
+     * `processing.stream_buffer` items (default 1024), processed (in
+     * parallel when `processing.threads` is not 1) and handed to @p sink in
+     * input order before the next window is read, so memory stays bounded
+     * by the window regardless of the stream length. Empty items are
+     * skipped. `processing.batch_size` does not apply to streams.
+     *
+     * @param source Producer of input items
+     * @param sink Consumer of processed items
+     * @param mode The processing mode to use
+     * @return ProcessingResult Success flag and item count; result is left empty
+     */
+    ProcessingResult processStream(const ItemSource& source, const ItemSink& sink,
+                                   ProcessingMode mode = ProcessingMode::BATCH);
+
+    /**
+     * @brief Process the records of an in-memory buffer without copying them out
+     *
+     * Splits @p input on @p separator into views (a trailing separator adds
+     * no record) and processes windows of `processing.stream_buffer` records
+     * like processStream(): every result is sized, then written in parallel
+     * at its offset in one reused StringBatch, which is handed to @p sink
+     * before the next window is started. Empty records are skipped. Meant
+     * for memory-mapped input, where only the output window is ever copied.
+     *
+     * @param input The records, e.g. MappedFile::view()
+     * @param separator The record separator
+     * @param sink Consumer of each window of processed records
+     * @param mode The processing mode to use
+     * @return ProcessingResult Success flag and record count; result is left empty
+     */
+    ProcessingResult processRecords(std::string_view input, char separator,
+                                    const RecordSink& sink,
+                                    ProcessingMode mode = ProcessingMode::BATCH);
+
+    /**
+     * @brief Process an input range into an output iterator via processStream
+     *
+     * @param first Beginning of the input range (elements convertible to std::string)
+     * @param last End of the input range
+     * @param out Output iterator receiving processed std::string items
+     * @param mode The processing mode to use
+     * @return ProcessingResult Success flag and item count; result is left empty
+     */
+    template <typename InputIt, typename OutputIt>
+    ProcessingResult processRange(InputIt first, InputIt last, OutputIt out,
+                                  ProcessingMode mode = ProcessingMode::BATCH) {
+        return processStream(
+            [&first, &last](std::string& item) {
+                if (first == last) {
+                    return false;
+                }
+                item = *first;
+                ++first;
+                return true;
+            },
+            [&out](std::string&& processed) {
+                *out = std::move(processed);
+                ++out;
+            },
+            mode);
+    }
+
     /**
      * @brief Set the processing configuration
      *
+     * Invalidates cached results unless the key is a pure tuning setting
+     * (batch_size, threads, chunk_size, stream_buffer, cache_bytes).
+     *
      * @param key Configuration key
      * @param value Configuration value
      */
     void setProcessingConfig(const std::string& key, const std::string& value);
 
+    /**
+     * @brief Get the processing configuration
+     *
+     * Collects only the `processing.` namespace, with the prefix stripped.
+     *
+     * @return std::map<std::string, std::string> Processing settings by key
+     */
+    std::map<std::string, std::string> getProcessingConfig() const;
+
     /**
      * @brief Get current processing statistics
      *
+     * Includes one "Memory <SUBSYSTEM>" line per subsystem that allocated
+     * when allocation tracking is active (see core/memory_tracking.h).
+     *
      * @return std::string Statistics as a formatted string
      */
     std::string getStatistics() const;
 
+    /**
+     * @brief Get current processing statistics as a structured snapshot
+     *
+     * Safe to call while other threads are processing; counters are summed
+     * from per-thread shards, so the values are a consistent-enough view
+     * for monitoring rather than an atomic cut.
+     *
+     * @return ProcessingStatistics Counters and per-mode latency summaries
+     */
+    ProcessingStatistics getStatisticsSnapshot() const;
+
     /**
      * @brief Reset processing statistics
      */
     void resetStatistics();
 
   private:
+    // Batch and stream settings, resolved once and refreshed on config changes
+    struct Settings {
+        explicit Settings(const ConfigManager& config)
+            : batch_size(config, "processing.batch_size", 10),
+              threads(config, "processing.threads", 1),
+              chunk_size(config, "processing.chunk_size", 1024),
+              stream_buffer(config, "processing.stream_buffer", 1024),
+              cache_bytes(config, "processing.cache_bytes", 0) {}
+
+        ConfigHandle<int> batch_size;
+        ConfigHandle<int> threads;
+        ConfigHandle<int> chunk_size;
+        ConfigHandle<int> stream_buffer;
+        ConfigHandle<size_t> cache_bytes;
+
+        // Bumped when a setting that may change results is written; part of
+        // every cache key, so results computed before the change never hit
+        std::atomic<uint64_t> cache_generation{0};
+    };
+
     std::shared_ptr<ConfigManager> config_manager_;
-    size_t total_processed_;
-    size_t successful_operations_;
-    size_t failed_operations_;
+    std::unique_ptr<Settings> settings_;
+    std::unique_ptr<ResultCache> cache_;
+    core::ShardedCounter total_processed_;
+    core::ShardedCounter successful_operations_;
+    core::ShardedCounter failed_operations_;
+    std::array<core::LatencyHistogram, kProcessingModeCount> latency_;
+    std::shared_ptr<core::ThreadPool> thread_pool_;
 
     /**
-     * @brief Internal method to apply processing based on mode
+     * @brief Get the batch thread pool, (re)creating it if the size changed
+     *
+     * Safe to call concurrently: the pool is published atomically and each
+     * caller keeps its own reference, so a resize never destroys a pool that
+     * another batch is still running on.
+     *
+     * Workers are placed with core::WorkerPlacement::PER_NODE.
+     *
+     * @param thread_count Requested worker count (0 = core::effectiveConcurrency())
+     * @return std::shared_ptr<core::ThreadPool> The pool to run batch chunks on
+     */
+    std::shared_ptr<core::ThreadPool> threadPool(size_t thread_count);
+
+    /**
+     * @brief Internal method to apply processing based on mode, through the result cache
      *
      * @param input The input string
      * @param mode The processing mode
      * @return std::string The processed result
      */
     std::string applyProcessing(const std::string& input, ProcessingMode mode);
+
+    /**
+     * @brief Get the length of the processed form of an input
+     *
+     * @param input The input string
+     * @param mode The processing mode
+     * @return size_t Number of characters writeProcessed() will produce
+     */
+    static size_t processedSize(std::string_view input, ProcessingMode mode);
+
+    /**
+     * @brief Write the processed form of an input into a buffer
+     *
+     * @param input The input string
+     * @param mode The processing mode
+     * @param output Buffer of at least processedSize(input, mode) characters
+     */
+    static void writeProcessed(std::string_view input, ProcessingMode mode, char* output);
+
+    /**
+     * @brief Record one processing latency sample for a mode
+     *
+     * @param mode The processing mode
+     * @param start When processing of the item started
+     */
+    void recordLatency(ProcessingMode mode, std::chrono::steady_clock::time_point start);
+
+    /**
+     * @brief Check batch limits and read the parallelism settings
+     *
+     * processing.batch_size, processing.threads and processing.chunk_size
+     * are read as of one configuration version.
+     *
+     * @param count Number of items in the batch
+     * @param thread_count Receives processing.threads
+     * @param chunk_size Receives processing.chunk_size
+     * @return std::string Empty if the batch may run, otherwise the error to report
+     * @throws std::invalid_argument if a setting is malformed or out of range
+     */
+    std::string checkBatch(size_t count, int& thread_count, int& chunk_size) const;
+
+    /**
+     * @brief Apply processing and record its latency for the mode
+     *
+     * @param input The input string
+     * @param mode The processing mode
+     * @return std::string The processed result
+     */
+    std::string applyTimed(const std::string& input, ProcessingMode mode);
+
+    /**
+     * @brief Apply processing into an arena and record its latency for the mode
+     *
+     * Uncached results are written straight into @p context; with the
+     * result cache enabled this goes through applyProcessing() and copies.
+     *
+     * @param input The input string
+     * @param mode The processing mode
+     * @param context The arena receiving the result
+     * @return std::string_view The processed result, in @p context
+     */
+    std::string_view applyTimed(const std::string& input, ProcessingMode mode,
+                                ProcessingContext& context);
 };
 
+template <typename ModePolicy>
+ProcessingResultView DataProcessor::processBatchWith(const std::vector<std::string>& inputs,
+                                                     ProcessingContext& context) {
+    using Processor = BasicDataProcessor<ModePolicy>;
+    constexpr std::string_view delimiter = ", ";
+    // Out-of-registry policies map to an index past the latency histograms
+    constexpr auto mode = static_cast<ProcessingMode>(BuiltinModes::indexOf<ModePolicy>());
+    ProcessingResultView result;
+
+    try {
+        int thread_count = 1;
+        int chunk_size = 1;
+        std::string error = checkBatch(inputs.size(), thread_count, chunk_size);
+        if (!error.empty()) {
+            result.error_message = context.store(error);
+            failed_operations_.add();
+            return result;
+        }
+
+        // Lay the joined result out up front: starts[i] is where item i's text
+        // begins; a delimiter precedes every item that does not start at 0
+        size_t* starts = static_cast<size_t*>(
+            context.allocateBytes(inputs.size() * sizeof(size_t), alignof(size_t)));
+        size_t total = 0;
+        size_t item_count = 0;
+        for (size_t i = 0; i < inputs.size(); ++i) {
+            if (inputs[i].empty()) {
+                starts[i] = total;
+                continue;
+            }
+            if (item_count++ > 0) {
+                total += delimiter.size();
+            }
+            starts[i] = total;
+            total += Processor::size(inputs[i]);
+        }
+        char* output = context.allocate(total);
+
+        auto write_range = [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                if (inputs[i].empty()) {
+                    continue;
+                }
+                auto start = std::chrono::steady_clock::now();
+                if (starts[i] != 0) {
+                    std::copy(delimiter.begin(), delimiter.end(),
+                              output + starts[i] - delimiter.size());
+                }
+                Processor::write(inputs[i], output + starts[i]);
+                recordLatency(mode, start);
+            }
+        };
+        if (thread_count != 1 && inputs.size() > static_cast<size_t>(chunk_size)) {
+            threadPool(static_cast<size_t>(thread_count))
+                ->parallelFor(inputs.size(), static_cast<size_t>(chunk_size), write_range);
+        } else {
+            write_range(0, inputs.size());
+        }
+
+        result.result = std::string_view(output, total);
+        result.success = true;
+        result.processed_items = item_count;
+
+        successful_operations_.add();
+        total_processed_.add(item_count);
+
+    } catch (const std::exception& e) {
+        result.success = false;
+        result.error_message = context.store(e.what());
+        failed_operations_.add();
+    }
+
+    return result;
+}
+
+template <typename ModePolicy>
+ProcessingResult DataProcessor::processBatchWith(const core::utils::string::StringBatch& inputs,
+                                                 core::utils::string::StringBatch& outputs) {
+    using Processor = BasicDataProcessor<ModePolicy>;
+    constexpr auto mode = static_cast<ProcessingMode>(BuiltinModes::indexOf<ModePolicy>());
+    if (&inputs == &outputs) {
+        const core::utils::string::StringBatch copy = inputs;
+        return processBatchWith<ModePolicy>(copy, outputs);
+    }
+    ProcessingResult result;
+
+    try {
+        int thread_count = 1;
+        int chunk_size = 1;
+        result.error_message = checkBatch(inputs.size(), thread_count, chunk_size);
+        if (!result.error_message.empty()) {
+            failed_operations_.add();
+            return result;
+        }
+
+        size_t item_count = 0;
+        char* output = outputs.layout(inputs.size(), [&](size_t i) -> size_t {
+            std::string_view text = inputs[i];
+            if (text.empty()) {
+                return 0;
+            }
+            ++item_count;
+            return Processor::size(text);
+        });
+        const core::utils::string::StringBatch::offset_type* offsets = outputs.offsets();
+
+        auto write_range = [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                std::string_view text = inputs[i];
+                if (text.empty()) {
+                    continue;
+                }
+                auto start = std::chrono::steady_clock::now();
+                Processor::write(text, output + offsets[i]);
+                recordLatency(mode, start);
+            }
+        };
+        if (thread_count != 1 && inputs.size() > static_cast<size_t>(chunk_size)) {
+            threadPool(static_cast<size_t>(thread_count))
+                ->parallelFor(inputs.size(), static_cast<size_t>(chunk_size), write_range);
+        } else {
+            write_range(0, inputs.size());
+        }
+
+        result.success = true;
+        result.processed_items = item_count;
+
+        successful_operations_.add();
+        total_processed_.add(item_count);
+
+    } catch (const std::exception& e) {
+        result.success = false;
+        result.error_message = e.what();
+        failed_operations_.add();
+    }
+
+    return result;
+}
+
 /**
  * @brief Factory function to create a DataProcessor instance
  *
@@ -0,0 +1,78 @@
+#include "file_processor.h"
+#include <core/file_writer.h>
+#include <core/mapped_file.h>
+#include <core/trace.h>
+#include <core/utils.h>
+#include <filesystem>
+#include <stdexcept>
+
+namespace cpp_template {
+namespace modules {
+
+ProcessingResult processFile(DataProcessor& processor, const std::string& input_path,
+                             const std::string& output_path, const FileProcessOptions& options) {
+    CORE_TRACE_SCOPE("processFile");
+    ProcessingResult result;
+
+    core::MappedFile input;
+    if (!input.open(input_path)) {
+        result.error_message = "Cannot open input file: " + input_path;
+        return result;
+    }
+    // Results go to a file next to the output that replaces it only once
+    // complete: truncating the output in place would cut the mapped input
+    // from under the reader when both name the same file, and a failed run
+    // would otherwise leave a partial output behind
+    const std::string staging = output_path + ".tmp";
+    core::FileWriter output(options.output_buffer);
+    if (!output.open(staging)) {
+        result.error_message = "Cannot create output file: " + output_path;
+        return result;
+    }
+
+    const std::string_view separator(&options.separator, 1);
+    result = processor.processRecords(
+        input.view(), options.separator,
+        [&](const core::utils::string::StringBatch& processed) {
+            for (std::string_view record : processed) {
+                if (!output.write(record) || !output.write(separator)) {
+                    throw std::runtime_error("Failed writing output file: " + output_path);
+                }
+            }
+        },
+        options.mode);
+
+    if (!output.close() && result.success) {
+        result.success = false;
+        result.error_message = "Failed writing output file: " + output_path;
+    }
+    std::error_code error;
+    if (result.success) {
+        std::filesystem::rename(staging, output_path, error);
+        if (error) {
+            result.success = false;
+            result.error_message = "Cannot replace output file: " + output_path;
+        }
+    }
+    if (!result.success) {
+        std::filesystem::remove(staging, error);
+    }
+    return result;
+}
+
+bool parseProcessingMode(std::string_view name, ProcessingMode& mode) {
+    std::string lower = core::utils::string::toLower(std::string(name));
+    if (lower == "simple") {
+        mode = ProcessingMode::SIMPLE;
+    } else if (lower == "advanced") {
+        mode = ProcessingMode::ADVANCED;
+    } else if (lower == "batch") {
+        mode = ProcessingMode::BATCH;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+}  // namespace modules
+}  // namespace cpp_template
@@ -0,0 +1,59 @@
+#pragma once
+
+/**
+ * @file file_processor.h
+ * @brief File-to-file batch processing on top of DataProcessor::processRecords()
+ *
+ * The input file is memory-mapped and split into records in place; each
+ * window of results is written, in input order, through a large output
+ * buffer that is flushed with vectored writes. This is what
+ * `cpp-template process` runs.
+ */
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include "data_processor.h"
+
+namespace cpp_template {
+namespace modules {
+
+/**
+ * @brief Options for processFile()
+ */
+struct FileProcessOptions {
+    ProcessingMode mode = ProcessingMode::BATCH;  // Mode applied to every record
+    char separator = '\n';                        // Splits input records and ends output ones
+    size_t output_buffer = 1 << 20;               // Bytes gathered per output write
+};
+
+/**
+ * @brief Process every record of one file into another
+ *
+ * Writes one output record per non-empty input record, each followed by
+ * the separator. Window size and parallelism come from the processor's
+ * `processing.stream_buffer` and `processing.threads` settings.
+ *
+ * @param processor The processor to run records through
+ * @param input_path The file to read; it is mapped, not read into memory
+ * @param output_path The file to create or replace; it may be the input file. Results
+ *        are staged in `<output_path>.tmp` and renamed over it only on success, so
+ *        a failed run leaves any existing output untouched
+ * @param options Mode, separator and output buffer size
+ * @return ProcessingResult Success flag and record count, or the I/O or processing error
+ */
+ProcessingResult processFile(DataProcessor& processor, const std::string& input_path,
+                             const std::string& output_path,
+                             const FileProcessOptions& options = {});
+
+/**
+ * @brief Parse a processing mode name such as "advanced", ignoring case
+ *
+ * @param name The mode name: simple, advanced or batch
+ * @param mode Receives the mode on success
+ * @return true if @p name is a built-in mode
+ */
+bool parseProcessingMode(std::string_view name, ProcessingMode& mode);
+
+}  // namespace modules
+}  // namespace cpp_template
@@ -0,0 +1,208 @@
+#include "ingest_pipeline.h"
+#include <core/cpu_topology.h>
+#include <algorithm>
+#include <chrono>
+#include <utility>
+
+namespace cpp_template {
+namespace modules {
+
+namespace {
+
+// Yields before a thread parks on a condition variable; short bursts are the
+// common case and are served without touching the wait mutex
+constexpr int kSpinLimit = 64;
+
+// Upper bound on a single park, so a missed wake-up costs latency, not liveness
+constexpr auto kParkTimeout = std::chrono::milliseconds(10);
+
+}  // namespace
+
+class IngestPipeline::ProducerScope {
+  public:
+    explicit ProducerScope(IngestPipeline& pipeline) : pipeline_(pipeline) {
+        pipeline_.producers_in_flight_.fetch_add(1, std::memory_order_seq_cst);
+    }
+
+    ~ProducerScope() {
+        if (pipeline_.producers_in_flight_.fetch_sub(1, std::memory_order_seq_cst) == 1 &&
+            pipeline_.closed_.load(std::memory_order_seq_cst)) {
+            // Workers of a closed pipeline wait for the last producer to leave
+            std::lock_guard<std::mutex> lock(pipeline_.wait_mutex_);
+            pipeline_.item_ready_.notify_all();
+        }
+    }
+
+    ProducerScope(const ProducerScope&) = delete;
+    ProducerScope& operator=(const ProducerScope&) = delete;
+
+  private:
+    IngestPipeline& pipeline_;
+};
+
+IngestPipeline::IngestPipeline(DataProcessor& processor, ResultSink sink, IngestOptions options)
+    : processor_(processor),
+      sink_(std::move(sink)),
+      mode_(options.mode),
+      queue_(options.queue_capacity) {
+    size_t worker_count = options.workers;
+    if (worker_count == 0) {
+        worker_count = core::effectiveConcurrency();
+    }
+    workers_.reserve(worker_count);
+    for (size_t i = 0; i < worker_count; ++i) {
+        workers_.emplace_back([this] { workerLoop(); });
+    }
+}
+
+IngestPipeline::~IngestPipeline() {
+    close();
+}
+
+bool IngestPipeline::tryPush(std::string&& item) {
+    ProducerScope scope(*this);
+    if (closed_.load(std::memory_order_seq_cst)) {
+        return false;
+    }
+    if (!queue_.tryPush(std::move(item))) {
+        rejected_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    accepted_.fetch_add(1, std::memory_order_relaxed);
+    wakeWorker();
+    return true;
+}
+
+bool IngestPipeline::push(std::string&& item) {
+    ProducerScope scope(*this);
+    for (;;) {
+        if (closed_.load(std::memory_order_seq_cst)) {
+            return false;
+        }
+        if (queue_.tryPush(std::move(item))) {
+            accepted_.fetch_add(1, std::memory_order_relaxed);
+            wakeWorker();
+            return true;
+        }
+        if (!waitForSpace()) {
+            return false;
+        }
+    }
+}
+
+void IngestPipeline::close() {
+    std::lock_guard<std::mutex> close_lock(close_mutex_);
+    {
+        std::lock_guard<std::mutex> lock(wait_mutex_);
+        closed_.store(true, std::memory_order_seq_cst);
+        item_ready_.notify_all();
+        space_ready_.notify_all();
+    }
+    for (auto& worker : workers_) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+    workers_.clear();
+}
+
+bool IngestPipeline::isClosed() const noexcept {
+    return closed_.load(std::memory_order_acquire);
+}
+
+size_t IngestPipeline::pending() const noexcept {
+    return queue_.sizeApprox();
+}
+
+size_t IngestPipeline::workerCount() const noexcept {
+    return workers_.size();
+}
+
+uint64_t IngestPipeline::accepted() const noexcept {
+    return accepted_.load(std::memory_order_relaxed);
+}
+
+uint64_t IngestPipeline::rejected() const noexcept {
+    return rejected_.load(std::memory_order_relaxed);
+}
+
+uint64_t IngestPipeline::completed() const noexcept {
+    return completed_.load(std::memory_order_relaxed);
+}
+
+void IngestPipeline::workerLoop() {
+    std::string item;
+    while (waitForItem(item)) {
+        wakeProducer();
+        ProcessingResult result = processor_.processItem(item, mode_);
+        if (sink_) {
+            sink_(std::move(result));
+        }
+        completed_.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+bool IngestPipeline::waitForItem(std::string& item) {
+    for (int spin = 0; spin < kSpinLimit; ++spin) {
+        if (queue_.tryPop(item)) {
+            return true;
+        }
+        std::this_thread::yield();
+    }
+
+    std::unique_lock<std::mutex> lock(wait_mutex_);
+    idle_workers_.fetch_add(1, std::memory_order_seq_cst);
+    for (;;) {
+        // Re-check after announcing ourselves idle; pairs with the fence in wakeWorker()
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        bool drained = closed_.load(std::memory_order_seq_cst) &&
+                       producers_in_flight_.load(std::memory_order_seq_cst) == 0;
+        // Pop after the drained check so an item pushed by the last producer is not lost
+        if (queue_.tryPop(item)) {
+            idle_workers_.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+        if (drained) {
+            idle_workers_.fetch_sub(1, std::memory_order_relaxed);
+            return false;
+        }
+        item_ready_.wait_for(lock, kParkTimeout);
+    }
+}
+
+bool IngestPipeline::waitForSpace() {
+    for (int spin = 0; spin < kSpinLimit; ++spin) {
+        if (queue_.sizeApprox() < queue_.capacity()) {
+            return true;
+        }
+        std::this_thread::yield();
+    }
+
+    std::unique_lock<std::mutex> lock(wait_mutex_);
+    waiting_producers_.fetch_add(1, std::memory_order_seq_cst);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (queue_.sizeApprox() >= queue_.capacity() && !closed_.load(std::memory_order_seq_cst)) {
+        space_ready_.wait_for(lock, kParkTimeout);
+    }
+    waiting_producers_.fetch_sub(1, std::memory_order_relaxed);
+    return !closed_.load(std::memory_order_seq_cst);
+}
+
+void IngestPipeline::wakeWorker() {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (idle_workers_.load(std::memory_order_seq_cst) > 0) {
+        std::lock_guard<std::mutex> lock(wait_mutex_);
+        item_ready_.notify_one();
+    }
+}
+
+void IngestPipeline::wakeProducer() {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (waiting_producers_.load(std::memory_order_seq_cst) > 0) {
+        std::lock_guard<std::mutex> lock(wait_mutex_);
+        space_ready_.notify_one();
+    }
+}
+
+}  // namespace modules
+}  // namespace cpp_template
@@ -0,0 +1,171 @@
+#pragma once
+
+/**
+ * @file ingest_pipeline.h
+ * @brief Multi-producer ingest stage in front of DataProcessor
+ *
+ * Producer threads hand items to a bounded lock-free queue; a fixed set of
+ * worker threads pops them, runs DataProcessor::processItem() and passes the
+ * results to a sink. Producers never contend on a lock while the queue has
+ * room, and a full queue is reported (tryPush) or waited out (push) instead
+ * of growing without bound.
+ */
+
+#include <core/mpmc_queue.h>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "data_processor.h"
+
+namespace cpp_template {
+namespace modules {
+
+/**
+ * @brief Construction options for IngestPipeline
+ */
+struct IngestOptions {
+    size_t queue_capacity = 4096;                  // Rounded up to a power of two
+    size_t workers = 0;                            // 0 = core::effectiveConcurrency()
+    ProcessingMode mode = ProcessingMode::SIMPLE;  // Mode applied to every item
+};
+
+/**
+ * @brief Bounded queue plus worker threads feeding a DataProcessor
+ *
+ * All push members may be called from any number of threads. Results are
+ * delivered in no particular order, concurrently from the worker threads.
+ */
+class IngestPipeline {
+  public:
+    /**
+     * @brief Consumer for processed items
+     *
+     * Called concurrently from worker threads, so it must be thread-safe; it
+     * must not throw.
+     */
+    using ResultSink = std::function<void(ProcessingResult&& result)>;
+
+    /**
+     * @brief Construct a new Ingest Pipeline object and start its workers
+     *
+     * @param processor The processor to run items through; must outlive the pipeline
+     * @param sink Receives every result (may be empty to only collect statistics)
+     * @param options Queue size, worker count and processing mode
+     */
+    IngestPipeline(DataProcessor& processor, ResultSink sink, IngestOptions options = {});
+
+    /**
+     * @brief Destroy the Ingest Pipeline object, draining queued items first
+     */
+    ~IngestPipeline();
+
+    // Non-copyable and non-movable: workers hold a pointer to the pipeline
+    IngestPipeline(const IngestPipeline&) = delete;
+    IngestPipeline& operator=(const IngestPipeline&) = delete;
+
+    /**
+     * @brief Queue an item if there is room, without blocking
+     *
+     * @param item The item; moved from only on success
+     * @return true if the item was queued
+     * @return false if the queue is full or the pipeline is closed
+     */
+    bool tryPush(std::string&& item);
+
+    /**
+     * @brief Queue an item, waiting while the queue is full
+     *
+     * @param item The item; moved from only on success
+     * @return true if the item was queued
+     * @return false if the pipeline is closed
+     */
+    bool push(std::string&& item);
+
+    /**
+     * @brief Stop accepting items, process everything queued and join the workers
+     *
+     * Blocked push() calls return false. Safe to call more than once.
+     */
+    void close();
+
+    /**
+     * @brief Check if close() has been called
+     *
+     * @return true if the pipeline no longer accepts items
+     */
+    bool isClosed() const noexcept;
+
+    /**
+     * @brief Get the number of queued items not yet picked up by a worker
+     *
+     * @return size_t The approximate queue length
+     */
+    size_t pending() const noexcept;
+
+    /**
+     * @brief Get the number of worker threads
+     *
+     * @return size_t The worker count
+     */
+    size_t workerCount() const noexcept;
+
+    /**
+     * @brief Get the number of items accepted by push() or tryPush()
+     *
+     * @return uint64_t The accepted item count
+     */
+    uint64_t accepted() const noexcept;
+
+    /**
+     * @brief Get the number of tryPush() calls refused because the queue was full
+     *
+     * @return uint64_t The rejected item count
+     */
+    uint64_t rejected() const noexcept;
+
+    /**
+     * @brief Get the number of items whose result has been delivered to the sink
+     *
+     * @return uint64_t The completed item count
+     */
+    uint64_t completed() const noexcept;
+
+  private:
+    // Tracks producers between their closed check and their push
+    class ProducerScope;
+
+    void workerLoop();
+    bool waitForItem(std::string& item);
+    bool waitForSpace();
+    void wakeWorker();
+    void wakeProducer();
+
+    DataProcessor& processor_;
+    ResultSink sink_;
+    ProcessingMode mode_;
+    core::MpmcQueue<std::string> queue_;
+
+    std::mutex wait_mutex_;
+    std::condition_variable item_ready_;
+    std::condition_variable space_ready_;
+    std::atomic<size_t> idle_workers_{0};
+    std::atomic<size_t> waiting_producers_{0};
+    std::atomic<size_t> producers_in_flight_{0};
+    std::atomic<bool> closed_{false};
+
+    std::atomic<uint64_t> accepted_{0};
+    std::atomic<uint64_t> rejected_{0};
+    std::atomic<uint64_t> completed_{0};
+
+    std::mutex close_mutex_;
+    std::vector<std::thread> workers_;
+};
+
+}  // namespace modules
+}  // namespace cpp_template
@@ -0,0 +1,55 @@
+#include "processing_context.h"
+#include <algorithm>
+#include <cstring>
+
+namespace cpp_template {
+namespace modules {
+
+ProcessingContext::ProcessingContext(size_t initial_capacity)
+    : capacity_(std::max<size_t>(initial_capacity, 64)),
+      bytes_used_(0),
+      block_(std::make_unique<std::byte[]>(capacity_)) {
+    resource_.emplace(block_.get(), capacity_);
+}
+
+void* ProcessingContext::allocateBytes(size_t size, size_t alignment) {
+    bytes_used_ += size + alignment - 1;
+    return resource_->allocate(std::max<size_t>(size, 1), alignment);
+}
+
+char* ProcessingContext::allocate(size_t length) {
+    return static_cast<char*>(allocateBytes(length, alignof(char)));
+}
+
+std::string_view ProcessingContext::store(std::string_view text) {
+    char* data = allocate(text.size());
+    std::memcpy(data, text.data(), text.size());
+    return std::string_view(data, text.size());
+}
+
+void ProcessingContext::reset() {
+    resource_.reset();
+    if (bytes_used_ > capacity_) {
+        // Size the first block for the peak so the next round needs no extra blocks
+        while (capacity_ < bytes_used_) {
+            capacity_ *= 2;
+        }
+        block_ = std::make_unique<std::byte[]>(capacity_);
+    }
+    resource_.emplace(block_.get(), capacity_);
+    bytes_used_ = 0;
+}
+
+WorkerContexts::WorkerContexts(const core::ThreadPool& pool, size_t initial_capacity)
+    : pool_(pool), initial_capacity_(initial_capacity), contexts_(pool.size() + 1) {}
+
+ProcessingContext& WorkerContexts::local() {
+    std::unique_ptr<ProcessingContext>& context = contexts_[pool_.currentWorker()];
+    if (!context) {
+        context = std::make_unique<ProcessingContext>(initial_capacity_);
+    }
+    return *context;
+}
+
+}  // namespace modules
+}  // namespace cpp_template
@@ -0,0 +1,139 @@
+#pragma once
+
+/**
+ * @file processing_context.h
+ * @brief Per-batch memory arena for data processing
+ */
+
+#include <core/thread_pool.h>
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+namespace cpp_template {
+namespace modules {
+
+/**
+ * @brief Monotonic arena that owns the strings produced while processing
+ *
+ * Everything allocated from a context (processed items, joined batch
+ * results, error messages) stays valid until reset() or destruction, which
+ * release it all at once instead of freeing string by string. The arena
+ * starts with one block and, on reset(), grows that block to the peak usage
+ * of the previous round, so a steady workload settles into a single
+ * allocation that is reused for every batch.
+ *
+ * A context is not thread-safe; use one per thread or per in-flight batch.
+ */
+class ProcessingContext {
+  public:
+    /**
+     * @brief Construct a new Processing Context object
+     *
+     * @param initial_capacity Size in bytes of the first arena block
+     */
+    explicit ProcessingContext(size_t initial_capacity = 64 * 1024);
+
+    // Non-copyable and non-movable: handed-out views point into the arena
+    ProcessingContext(const ProcessingContext&) = delete;
+    ProcessingContext& operator=(const ProcessingContext&) = delete;
+
+    /**
+     * @brief Get the arena as a polymorphic memory resource
+     *
+     * Usable with std::pmr containers whose lifetime ends before reset().
+     *
+     * @return std::pmr::memory_resource* The arena resource
+     */
+    std::pmr::memory_resource* resource() noexcept { return &*resource_; }
+
+    /**
+     * @brief Allocate uninitialized, aligned storage from the arena
+     *
+     * @param size Number of bytes
+     * @param alignment Required alignment (a power of two)
+     * @return void* The storage
+     */
+    void* allocateBytes(size_t size, size_t alignment);
+
+    /**
+     * @brief Allocate uninitialized characters from the arena
+     *
+     * @param length Number of characters
+     * @return char* Storage for @p length characters
+     */
+    char* allocate(size_t length);
+
+    /**
+     * @brief Copy a string into the arena
+     *
+     * @param text The characters to copy
+     * @return std::string_view View of the arena copy
+     */
+    std::string_view store(std::string_view text);
+
+    /**
+     * @brief Release everything allocated since the last reset
+     *
+     * All views previously returned by this context become dangling.
+     */
+    void reset();
+
+    /**
+     * @brief Get the number of bytes allocated since the last reset
+     *
+     * @return size_t Bytes handed out by allocateBytes(), allocate() and store()
+     */
+    size_t bytesUsed() const noexcept { return bytes_used_; }
+
+    /**
+     * @brief Get the size of the arena's first block
+     *
+     * @return size_t The block size in bytes
+     */
+    size_t capacity() const noexcept { return capacity_; }
+
+  private:
+    size_t capacity_;
+    size_t bytes_used_;
+    std::unique_ptr<std::byte[]> block_;
+    std::optional<std::pmr::monotonic_buffer_resource> resource_;
+};
+
+/**
+ * @brief One arena per worker of a thread pool, for a single parallel batch
+ *
+ * Each context is created by the first thread that asks for it, which also
+ * zeroes (and so first-touches) its block. When the pool pins its workers
+ * to NUMA nodes, every worker therefore writes its share of the batch into
+ * memory on its own node, and no two threads share an arena, so no locking
+ * is needed. The thread that calls parallelFor() gets an extra context.
+ */
+class WorkerContexts {
+  public:
+    /**
+     * @brief Construct a new Worker Contexts object; no arena is allocated yet
+     *
+     * @param pool The pool whose workers will call local()
+     * @param initial_capacity Size in bytes of each arena's first block
+     */
+    explicit WorkerContexts(const core::ThreadPool& pool, size_t initial_capacity = 16 * 1024);
+
+    /**
+     * @brief Get the calling thread's arena, creating it on first use
+     *
+     * @return ProcessingContext& The arena of the current worker, or of the calling thread
+     */
+    ProcessingContext& local();
+
+  private:
+    const core::ThreadPool& pool_;
+    size_t initial_capacity_;
+    std::vector<std::unique_ptr<ProcessingContext>> contexts_;
+};
+
+}  // namespace modules
+}  // namespace cpp_template
@@ -0,0 +1,248 @@
+#pragma once
+
+/**
+ * @file processing_modes.h
+ * @brief Compile-time processing mode policies and their registry
+ *
+ * A mode policy is a type with a name and a transform pipeline:
+ *
+ *     struct RedactMode {
+ *         static constexpr std::string_view kName = "REDACT";
+ *         static constexpr transform::Pipeline<transform::Prefix, transform::Trim> kPipeline{
+ *             transform::Prefix{"[REDACTED] "}, transform::Trim{}};
+ *     };
+ *
+ * BasicDataProcessor<RedactMode> then processes items with the pipeline
+ * inlined, and `BuiltinModes::With<RedactMode>` is a registry that can look
+ * the mode up by name or index without a hand-written switch.
+ */
+
+#include <array>
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "processing_context.h"
+#include "transform_pipeline.h"
+
+namespace cpp_template {
+namespace modules {
+
+/**
+ * @brief SIMPLE mode: prefix and uppercase
+ */
+struct SimpleMode {
+    static constexpr std::string_view kName = "SIMPLE";
+    static constexpr transform::Pipeline<transform::Prefix, transform::ToUpper> kPipeline{
+        transform::Prefix{"[SIMPLE] "}, transform::ToUpper{}};
+};
+
+/**
+ * @brief ADVANCED mode: prefix, reverse and lowercase
+ */
+struct AdvancedMode {
+    static constexpr std::string_view kName = "ADVANCED";
+    static constexpr transform::Pipeline<transform::Prefix, transform::Reverse, transform::ToLower>
+        kPipeline{transform::Prefix{"[ADVANCED] "}, transform::Reverse{}, transform::ToLower{}};
+};
+
+/**
+ * @brief BATCH mode: prefix and trim whitespace
+ */
+struct BatchMode {
+    static constexpr std::string_view kName = "BATCH";
+    static constexpr transform::Pipeline<transform::Prefix, transform::Trim> kPipeline{
+        transform::Prefix{"[BATCH] "}, transform::Trim{" \t\n\r"}};
+};
+
+/**
+ * @brief Fallback for out-of-range ProcessingMode values
+ */
+struct UnknownMode {
+    static constexpr std::string_view kName = "UNKNOWN";
+    static constexpr transform::Pipeline<transform::Prefix> kPipeline{
+        transform::Prefix{"[UNKNOWN] "}};
+};
+
+/**
+ * @brief Data processor specialized at compile time for one mode
+ *
+ * Stateless: every member is static and inlines the mode's pipeline, so a
+ * loop over millions of items contains no mode switch or indirect call. The
+ * configurable, instrumented front end is DataProcessor.
+ *
+ * @tparam ModePolicy A mode policy providing kName and kPipeline
+ */
+template <typename ModePolicy>
+class BasicDataProcessor {
+  public:
+    using Policy = ModePolicy;
+
+    /**
+     * @brief Get the mode name
+     *
+     * @return std::string_view The policy's kName
+     */
+    static constexpr std::string_view name() noexcept { return ModePolicy::kName; }
+
+    /**
+     * @brief Get the exact processed length of an input
+     *
+     * @param input The input text
+     * @return size_t Number of characters write() produces
+     */
+    static size_t size(std::string_view input) { return ModePolicy::kPipeline.size(input); }
+
+    /**
+     * @brief Write the processed input into a buffer
+     *
+     * @param input The input text
+     * @param output Buffer of at least size(input) characters
+     * @return char* One past the last character written
+     */
+    static char* write(std::string_view input, char* output) {
+        return ModePolicy::kPipeline.write(input, output);
+    }
+
+    /**
+     * @brief Process one input into a new string
+     *
+     * @param input The input text
+     * @return std::string The processed text
+     */
+    static std::string process(std::string_view input) { return ModePolicy::kPipeline(input); }
+
+    /**
+     * @brief Process a range of inputs into one joined arena string
+     *
+     * Empty inputs are skipped, as in DataProcessor::processBatch().
+     *
+     * @param inputs Range of items convertible to std::string_view
+     * @param delimiter Text placed between processed items
+     * @param context Arena that receives the result
+     * @param processed_items Receives the number of non-empty inputs
+     * @return std::string_view The joined result, valid until @p context is reset
+     */
+    template <typename Range>
+    static std::string_view processJoined(const Range& inputs, std::string_view delimiter,
+                                          ProcessingContext& context, size_t& processed_items) {
+        size_t total = 0;
+        processed_items = 0;
+        for (const auto& input : inputs) {
+            std::string_view text(input);
+            if (!text.empty()) {
+                total += (processed_items++ > 0 ? delimiter.size() : 0) + size(text);
+            }
+        }
+
+        char* const output = context.allocate(total);
+        char* cursor = output;
+        bool first = true;
+        for (const auto& input : inputs) {
+            std::string_view text(input);
+            if (text.empty()) {
+                continue;
+            }
+            if (!first) {
+                cursor = std::copy(delimiter.begin(), delimiter.end(), cursor);
+            }
+            first = false;
+            cursor = write(text, cursor);
+        }
+        return std::string_view(output, total);
+    }
+};
+
+/**
+ * @brief Compile-time list of mode policies with name and index lookup
+ *
+ * The dispatch code is generated from the type list, so adding a mode means
+ * adding a policy type rather than editing a switch.
+ *
+ * @tparam Policies The registered mode policies, in index order
+ */
+template <typename... Policies>
+struct ModeRegistry {
+    static constexpr size_t kCount = sizeof...(Policies);
+
+    /**
+     * @brief Registry with further policies appended
+     */
+    template <typename... More>
+    using With = ModeRegistry<Policies..., More...>;
+
+    /**
+     * @brief Mode names in index order
+     */
+    static constexpr std::array<std::string_view, kCount> kNames = {Policies::kName...};
+
+    /**
+     * @brief Look up a mode index by name
+     *
+     * @param name The mode name
+     * @return std::optional<size_t> The index, or nullopt if no policy has that name
+     */
+    static constexpr std::optional<size_t> find(std::string_view name) {
+        for (size_t i = 0; i < kCount; ++i) {
+            if (kNames[i] == name) {
+                return i;
+            }
+        }
+        return std::nullopt;
+    }
+
+    /**
+     * @brief Get the index of a policy type
+     *
+     * @tparam Policy The policy to look for
+     * @return size_t The index, or kCount if the policy is not registered
+     */
+    template <typename Policy>
+    static constexpr size_t indexOf() {
+        constexpr bool matches[] = {std::is_same_v<Policy, Policies>..., false};
+        for (size_t i = 0; i < kCount; ++i) {
+            if (matches[i]) {
+                return i;
+            }
+        }
+        return kCount;
+    }
+
+    /**
+     * @brief Call fn with the BasicDataProcessor for a mode index
+     *
+     * @param index The mode index; must be less than kCount
+     * @param fn Callable invoked as fn(BasicDataProcessor<Policy>{})
+     * @return The result of fn
+     */
+    template <typename Fn>
+    static decltype(auto) dispatch(size_t index, Fn&& fn) {
+        return dispatchFrom<0>(index, std::forward<Fn>(fn));
+    }
+
+  private:
+    template <size_t I, typename Fn>
+    static decltype(auto) dispatchFrom(size_t index, Fn&& fn) {
+        using Policy = std::tuple_element_t<I, std::tuple<Policies...>>;
+        if constexpr (I + 1 == kCount) {
+            return fn(BasicDataProcessor<Policy>{});
+        } else {
+            if (index == I) {
+                return fn(BasicDataProcessor<Policy>{});
+            }
+            return dispatchFrom<I + 1>(index, std::forward<Fn>(fn));
+        }
+    }
+};
+
+/**
+ * @brief The modes behind the ProcessingMode enum, indexed by its values
+ */
+using BuiltinModes = ModeRegistry<SimpleMode, AdvancedMode, BatchMode>;
+
+}  // namespace modules
+}  // namespace cpp_template
@@ -0,0 +1,159 @@
+#include "result_cache.h"
+#include <functional>
+#include <utility>
+
+namespace cpp_template {
+namespace modules {
+
+namespace {
+
+// Map key viewing the input stored in its own list entry, so the lookup key
+// can view the caller's input instead of copying it
+struct CacheKey {
+    std::string_view input;
+    uint64_t variant;
+
+    bool operator==(const CacheKey& other) const noexcept {
+        return variant == other.variant && input == other.input;
+    }
+};
+
+struct CacheKeyHash {
+    size_t operator()(const CacheKey& key) const noexcept {
+        size_t hash = std::hash<std::string_view>{}(key.input);
+        return hash ^ (std::hash<uint64_t>{}(key.variant) + 0x9e3779b97f4a7c15ULL + (hash << 6) +
+                       (hash >> 2));
+    }
+};
+
+}  // namespace
+
+struct ResultCache::Shard {
+    struct Entry {
+        std::string input;
+        uint64_t variant;
+        std::string result;
+
+        size_t cost() const noexcept { return input.size() + result.size() + kEntryOverhead; }
+    };
+    using EntryList = std::list<Entry>;
+
+    // Drop least recently used entries until the shard fits the budget
+    void evictTo(size_t budget) {
+        while (bytes > budget && !lru.empty()) {
+            const Entry& victim = lru.back();
+            bytes -= victim.cost();
+            index.erase(CacheKey{victim.input, victim.variant});
+            lru.pop_back();
+            ++evictions;
+        }
+    }
+
+    mutable std::mutex mutex;
+    EntryList lru;  // Most recently used first
+    std::unordered_map<CacheKey, EntryList::iterator, CacheKeyHash> index;
+    size_t bytes = 0;
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    uint64_t evictions = 0;
+};
+
+ResultCache::ResultCache(size_t capacity_bytes)
+    : capacity_(capacity_bytes), shards_(std::make_unique<Shard[]>(kShardCount)) {}
+
+ResultCache::~ResultCache() = default;
+
+ResultCache::Shard& ResultCache::shardFor(std::string_view input, uint64_t variant) const {
+    // Use the high bits; the low bits also pick the bucket inside the shard
+    uint64_t hash = CacheKeyHash{}(CacheKey{input, variant});
+    return shards_[((hash >> 32) ^ hash) % kShardCount];
+}
+
+std::optional<std::string> ResultCache::find(std::string_view input, uint64_t variant) {
+    if (!enabled()) {
+        return std::nullopt;
+    }
+    Shard& shard = shardFor(input, variant);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto it = shard.index.find(CacheKey{input, variant});
+    if (it == shard.index.end()) {
+        ++shard.misses;
+        return std::nullopt;
+    }
+    ++shard.hits;
+    shard.lru.splice(shard.lru.begin(), shard.lru, it->second);
+    return it->second->result;
+}
+
+void ResultCache::insert(std::string_view input, uint64_t variant, std::string_view result) {
+    size_t budget = shardCapacity();
+    if (input.size() + result.size() + kEntryOverhead > budget) {
+        return;
+    }
+
+    Shard& shard = shardFor(input, variant);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto it = shard.index.find(CacheKey{input, variant});
+    if (it != shard.index.end()) {
+        // Racing misses computed the same result; refresh it in place
+        Shard::Entry& entry = *it->second;
+        shard.bytes -= entry.cost();
+        entry.result.assign(result);
+        shard.bytes += entry.cost();
+        shard.lru.splice(shard.lru.begin(), shard.lru, it->second);
+    } else {
+        shard.lru.push_front(Shard::Entry{std::string(input), variant, std::string(result)});
+        const Shard::Entry& entry = shard.lru.front();
+        shard.index.emplace(CacheKey{entry.input, entry.variant}, shard.lru.begin());
+        shard.bytes += entry.cost();
+    }
+    shard.evictTo(budget);
+}
+
+void ResultCache::clear() {
+    for (size_t i = 0; i < kShardCount; ++i) {
+        Shard& shard = shards_[i];
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        shard.index.clear();
+        shard.lru.clear();
+        shard.bytes = 0;
+    }
+}
+
+void ResultCache::setCapacity(size_t capacity_bytes) {
+    capacity_.store(capacity_bytes, std::memory_order_relaxed);
+    size_t budget = capacity_bytes / kShardCount;
+    for (size_t i = 0; i < kShardCount; ++i) {
+        Shard& shard = shards_[i];
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        shard.evictTo(budget);
+    }
+}
+
+ResultCacheStatistics ResultCache::statistics() const {
+    ResultCacheStatistics stats;
+    stats.capacity_bytes = capacity();
+    for (size_t i = 0; i < kShardCount; ++i) {
+        const Shard& shard = shards_[i];
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        stats.hits += shard.hits;
+        stats.misses += shard.misses;
+        stats.evictions += shard.evictions;
+        stats.entries += shard.lru.size();
+        stats.bytes += shard.bytes;
+    }
+    return stats;
+}
+
+void ResultCache::resetStatistics() {
+    for (size_t i = 0; i < kShardCount; ++i) {
+        Shard& shard = shards_[i];
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        shard.hits = 0;
+        shard.misses = 0;
+        shard.evictions = 0;
+    }
+}
+
+}  // namespace modules
+}  // namespace cpp_template
@@ -0,0 +1,154 @@
+#pragma once
+
+/**
+ * @file result_cache.h
+ * @brief Bounded, sharded LRU cache of processed results
+ */
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace cpp_template {
+namespace modules {
+
+/**
+ * @brief Point-in-time view of ResultCache counters
+ */
+struct ResultCacheStatistics {
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    uint64_t evictions = 0;
+    size_t entries = 0;
+    size_t bytes = 0;
+    size_t capacity_bytes = 0;
+
+    /**
+     * @brief Get the hit rate in percent
+     *
+     * @return double Hits over lookups, or 0 if there were none
+     */
+    double hitRate() const noexcept {
+        uint64_t lookups = hits + misses;
+        return lookups == 0 ? 0.0
+                            : static_cast<double>(hits) / static_cast<double>(lookups) * 100.0;
+    }
+};
+
+/**
+ * @brief Memory-bounded cache mapping (input, variant) to a processed result
+ *
+ * The key space is split across shards by hash, each with its own lock and
+ * LRU list, so concurrent lookups of different inputs rarely contend. The
+ * variant distinguishes results computed differently from the same input
+ * (DataProcessor packs the mode and its config generation into it).
+ * Lookups hash and compare the input as a view, so a miss does not
+ * allocate; a hit copies the stored result out, since it may be evicted as
+ * soon as the shard lock is released. Each entry is charged its key and
+ * value bytes plus a fixed per-entry overhead against the byte budget.
+ */
+class ResultCache {
+  public:
+    static constexpr size_t kShardCount = 16;
+
+    /**
+     * @brief Construct a new Result Cache object
+     *
+     * @param capacity_bytes Memory budget; 0 disables the cache
+     */
+    explicit ResultCache(size_t capacity_bytes = 0);
+
+    /**
+     * @brief Destroy the Result Cache object
+     */
+    ~ResultCache();
+
+    // Non-copyable and non-movable: shards hold their own locks
+    ResultCache(const ResultCache&) = delete;
+    ResultCache& operator=(const ResultCache&) = delete;
+
+    /**
+     * @brief Look up a result and mark it most recently used
+     *
+     * @param input The input the result was computed from
+     * @param variant How the result was computed
+     * @return std::optional<std::string> A copy of the result (allocated unless it fits the
+     *         small-string buffer), or nullopt on a miss
+     */
+    std::optional<std::string> find(std::string_view input, uint64_t variant);
+
+    /**
+     * @brief Insert or replace a result, evicting least recently used entries
+     *
+     * Entries larger than a shard's share of the budget are not stored.
+     *
+     * @param input The input the result was computed from
+     * @param variant How the result was computed
+     * @param result The result
+     */
+    void insert(std::string_view input, uint64_t variant, std::string_view result);
+
+    /**
+     * @brief Drop every entry (counters are kept)
+     */
+    void clear();
+
+    /**
+     * @brief Change the memory budget
+     *
+     * A smaller budget is enforced immediately; 0 disables and empties the cache.
+     *
+     * @param capacity_bytes The new budget
+     */
+    void setCapacity(size_t capacity_bytes);
+
+    /**
+     * @brief Get the memory budget
+     *
+     * @return size_t The budget in bytes
+     */
+    size_t capacity() const noexcept { return capacity_.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Check if the cache stores anything at all
+     *
+     * @return true if the budget is not zero
+     */
+    bool enabled() const noexcept { return capacity() != 0; }
+
+    /**
+     * @brief Get counters and occupancy summed over all shards
+     *
+     * @return ResultCacheStatistics The statistics
+     */
+    ResultCacheStatistics statistics() const;
+
+    /**
+     * @brief Reset the hit, miss and eviction counters
+     */
+    void resetStatistics();
+
+    /**
+     * @brief Bookkeeping bytes charged per entry in addition to its strings
+     */
+    static constexpr size_t kEntryOverhead = 96;
+
+  private:
+    struct Shard;
+
+    Shard& shardFor(std::string_view input, uint64_t variant) const;
+    size_t shardCapacity() const noexcept { return capacity() / kShardCount; }
+
+    std::atomic<size_t> capacity_;
+    std::unique_ptr<Shard[]> shards_;
+};
+
+}  // namespace modules
+}  // namespace cpp_template
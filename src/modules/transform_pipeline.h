@@ -0,0 +1,225 @@
+#pragma once
+
+/**
+ * @file transform_pipeline.h
+ * @brief Compile-time composed, single-pass string transform pipelines
+ *
+ * A Pipeline is a list of stages fixed at compile time. Instead of running
+ * the stages one after another over temporary strings, the pipeline first
+ * narrows the input (trim), then copies it once into a pre-sized output
+ * buffer, forwards or backwards (reverse), and finally runs the character
+ * maps (case conversion, user maps) in place over the freshly written,
+ * cache-resident body. Case maps use the vectorized core kernels; a per-
+ * character fused loop cannot vectorize because of the locale fallback for
+ * non-ASCII bytes and measured about three times slower.
+ *
+ *     constexpr transform::Pipeline<transform::Prefix, transform::ToUpper> shout{
+ *         transform::Prefix{"> "}, transform::ToUpper{}};
+ *     std::string out = shout("hello");  // "> HELLO"
+ */
+
+#include <core/utils.h>
+#include <algorithm>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <utility>
+
+namespace cpp_template {
+namespace modules {
+namespace transform {
+
+/**
+ * @brief Identity behaviour for every stage hook
+ *
+ * Stages derive from this and hide only the hooks they need:
+ * - `std::string_view select(std::string_view body) const` narrows the input;
+ * - `static constexpr bool kReverses` emits the body back to front;
+ * - `void mapInPlace(char* data, size_t length) const` rewrites body characters;
+ * - `std::string_view prefix() const` / `suffix() const` add literal text.
+ *
+ * Prefix and suffix text is emitted verbatim; the other hooks apply to the
+ * input body only. Selections run in stage order on the input before it is
+ * reversed, character maps run in stage order over the emitted body, and
+ * literal text is concatenated in stage order.
+ */
+struct Stage {
+    static constexpr bool kReverses = false;
+
+    constexpr std::string_view select(std::string_view body) const { return body; }
+    void mapInPlace(char* /*data*/, size_t /*length*/) const {}
+    constexpr std::string_view prefix() const { return {}; }
+    constexpr std::string_view suffix() const { return {}; }
+};
+
+/**
+ * @brief Emit fixed text before the body
+ */
+struct Prefix : Stage {
+    constexpr explicit Prefix(std::string_view text) : text_(text) {}
+    constexpr std::string_view prefix() const { return text_; }
+
+  private:
+    std::string_view text_;
+};
+
+/**
+ * @brief Emit fixed text after the body
+ */
+struct Suffix : Stage {
+    constexpr explicit Suffix(std::string_view text) : text_(text) {}
+    constexpr std::string_view suffix() const { return text_; }
+
+  private:
+    std::string_view text_;
+};
+
+/**
+ * @brief Drop leading and trailing characters from a set
+ */
+struct Trim : Stage {
+    constexpr explicit Trim(std::string_view characters = " \t\n\r") : characters_(characters) {}
+
+    constexpr std::string_view select(std::string_view body) const {
+        size_t begin = body.find_first_not_of(characters_);
+        if (begin == std::string_view::npos) {
+            return {};
+        }
+        return body.substr(begin, body.find_last_not_of(characters_) - begin + 1);
+    }
+
+  private:
+    std::string_view characters_;
+};
+
+/**
+ * @brief Emit the body back to front
+ */
+struct Reverse : Stage {
+    static constexpr bool kReverses = true;
+};
+
+/**
+ * @brief Map characters to uppercase, matching core::utils::string::toUpper
+ */
+struct ToUpper : Stage {
+    void mapInPlace(char* data, size_t length) const {
+        core::utils::string::toUpperInPlace(data, length);
+    }
+};
+
+/**
+ * @brief Map characters to lowercase, matching core::utils::string::toLower
+ */
+struct ToLower : Stage {
+    void mapInPlace(char* data, size_t length) const {
+        core::utils::string::toLowerInPlace(data, length);
+    }
+};
+
+/**
+ * @brief Wrap any `char(char)` callable as a character-map stage
+ *
+ * @tparam Fn The callable type
+ */
+template <typename Fn>
+struct MapChars : Stage {
+    constexpr explicit MapChars(Fn fn) : fn_(std::move(fn)) {}
+
+    void mapInPlace(char* data, size_t length) const {
+        for (size_t i = 0; i < length; ++i) {
+            data[i] = fn_(data[i]);
+        }
+    }
+
+  private:
+    Fn fn_;
+};
+
+/**
+ * @brief Fused transform built from a fixed list of stages
+ *
+ * All stage calls are resolved at compile time; writing an item touches only
+ * the output buffer, with no virtual calls or temporaries.
+ *
+ * @tparam Stages The stage types, each deriving from Stage
+ */
+template <typename... Stages>
+class Pipeline {
+  public:
+    constexpr explicit Pipeline(Stages... stages) : stages_(std::move(stages)...) {}
+
+    /**
+     * @brief Get the exact output length for an input
+     *
+     * @param input The input text
+     * @return size_t Number of characters write() produces
+     */
+    size_t size(std::string_view input) const {
+        return fixedSize() + select(input).size();
+    }
+
+    /**
+     * @brief Write the transformed input into a buffer
+     *
+     * @param input The input text
+     * @param output Buffer of at least size(input) characters
+     * @return char* One past the last character written
+     */
+    char* write(std::string_view input, char* output) const {
+        std::string_view body = select(input);
+        std::apply([&](const auto&... stage) { ((output = copy(stage.prefix(), output)), ...); },
+                   stages_);
+        char* body_output = output;
+        if constexpr (kReverses) {
+            output = std::reverse_copy(body.begin(), body.end(), output);
+        } else {
+            output = std::copy(body.begin(), body.end(), output);
+        }
+        std::apply([&](const auto&... stage) { (stage.mapInPlace(body_output, body.size()), ...); },
+                   stages_);
+        std::apply([&](const auto&... stage) { ((output = copy(stage.suffix(), output)), ...); },
+                   stages_);
+        return output;
+    }
+
+    /**
+     * @brief Transform an input into a new string with a single allocation
+     *
+     * @param input The input text
+     * @return std::string The transformed text
+     */
+    std::string operator()(std::string_view input) const {
+        std::string output(size(input), '\0');
+        write(input, output.data());
+        return output;
+    }
+
+  private:
+    // An odd number of reversing stages reverses the body
+    static constexpr bool kReverses = ((Stages::kReverses ? 1 : 0) + ... + 0) % 2 == 1;
+
+    static char* copy(std::string_view text, char* output) {
+        return std::copy(text.begin(), text.end(), output);
+    }
+
+    std::string_view select(std::string_view body) const {
+        std::apply([&](const auto&... stage) { ((body = stage.select(body)), ...); }, stages_);
+        return body;
+    }
+
+    size_t fixedSize() const {
+        return std::apply(
+            [](const auto&... stage) {
+                return (size_t{0} + ... + (stage.prefix().size() + stage.suffix().size()));
+            },
+            stages_);
+    }
+
+    std::tuple<Stages...> stages_;
+};
+
+}  // namespace transform
+}  // namespace modules
+}  // namespace cpp_template
@@ -1,4 +1,3 @@
-#include <regex>
 #include "core/utils.h"  // Internal core library utils
 #include "cpp-template/utils.h"
 
@@ -6,19 +5,52 @@ namespace cpp_template {
 namespace string_utils {
 
 std::string toUpper(const std::string& input) {
-    return core::utils::string::toUpper(input);
+    std::string result = input;
+    core::utils::string::toUpperInPlace(result);
+    return result;
 }
 
 std::string toLower(const std::string& input) {
-    return core::utils::string::toLower(input);
+    std::string result = input;
+    core::utils::string::toLowerInPlace(result);
+    return result;
 }
 
 std::vector<std::string> split(const std::string& input, char delimiter) {
-    return core::utils::string::split(input, delimiter);
+    std::vector<std::string_view> parts;
+    core::utils::string::split(input, delimiter, parts);
+    return std::vector<std::string>(parts.begin(), parts.end());
 }
 
 std::string join(const std::vector<std::string>& strings, const std::string& delimiter) {
-    return core::utils::string::join(strings, delimiter);
+    std::string result;
+    core::utils::string::join(strings, delimiter, result);
+    return result;
+}
+
+void toUpperInPlace(std::string& inout) {
+    core::utils::string::toUpperInPlace(inout);
+}
+
+void toLowerInPlace(std::string& inout) {
+    core::utils::string::toLowerInPlace(inout);
+}
+
+void toUpper(std::string_view input, std::string& output) {
+    core::utils::string::toUpper(input, output);
+}
+
+void toLower(std::string_view input, std::string& output) {
+    core::utils::string::toLower(input, output);
+}
+
+size_t split(std::string_view input, char delimiter, std::vector<std::string_view>& output) {
+    return core::utils::string::split(input, delimiter, output);
+}
+
+void join(const std::vector<std::string_view>& strings, std::string_view delimiter,
+          std::string& output) {
+    core::utils::string::join(strings, delimiter, output);
 }
 
 }  // namespace string_utils
@@ -34,9 +66,13 @@ bool isAlphanumeric(const std::string& input) {
 }
 
 bool isValidEmail(const std::string& email) {
-    // Simple email validation using regex
-    const std::regex email_pattern(R"(^[a-zA-Z0-9._%+-]+@[a-zA-Z0-9.-]+\.[a-zA-Z]{2,}$)");
-    return std::regex_match(email, email_pattern);
+    // Hand-written matcher for ^[a-zA-Z0-9._%+-]+@[a-zA-Z0-9.-]+\.[a-zA-Z]{2,}$
+    return core::utils::validation::isValidEmail(email);
+}
+
+size_t validateEmails(const std::vector<std::string_view>& emails,
+                      std::vector<unsigned char>& results) {
+    return core::utils::validation::validateEmails(emails, results);
 }
 
 }  // namespace validation
@@ -0,0 +1,106 @@
+#include "modules/async_processor.h"
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include <vector>
+#include "core/thread_pool.h"
+#include "modules/config_manager.h"
+#include "modules/data_processor.h"
+
+using namespace cpp_template::modules;
+
+// Built twice: as C++17 (futures fallback) and, when available, as C++20 (coroutines)
+class AsyncProcessorTest : public ::testing::Test {
+  protected:
+    std::shared_ptr<ConfigManager> config_ = createConfigManager();
+    DataProcessor processor_{config_};
+    cpp_template::core::ThreadPool pool_{2};
+    ThreadPoolExecutor executor_{pool_};
+    AsyncDataProcessor async_{processor_, executor_, 3};
+
+    std::vector<std::string> inputs() const {
+        return {"alpha", "beta", "", "gamma", "delta", "epsilon", "zeta"};
+    }
+};
+
+#if CPP_TEMPLATE_HAS_COROUTINES
+
+namespace {
+
+Task<std::string> processTwice(AsyncDataProcessor& async, std::string input) {
+    ProcessingResult first = co_await async.processItemAsync(std::move(input));
+    ProcessingResult second =
+        co_await async.processItemAsync(first.result, ProcessingMode::BATCH);
+    co_return second.result;
+}
+
+Task<std::vector<ProcessingResult>> collect(AsyncDataProcessor& async,
+                                            std::vector<std::string> inputs) {
+    std::vector<ProcessingResult> results;
+    auto batch = async.processBatchAsync(std::move(inputs), ProcessingMode::ADVANCED);
+    while (const ProcessingResult* result = co_await batch.next()) {
+        results.push_back(*result);
+    }
+    co_return results;
+}
+
+Task<int> failing() {
+    throw std::runtime_error("boom");
+    co_return 0;
+}
+
+}  // namespace
+
+// Test chained awaits on the executor
+TEST_F(AsyncProcessorTest, CoroutineProcessItem) {
+    EXPECT_EQ(syncWait(processTwice(async_, "hello")), "[BATCH] [SIMPLE] HELLO");
+
+    InlineExecutor inline_executor;
+    AsyncDataProcessor inline_async(processor_, inline_executor);
+    auto result = syncWait(inline_async.processItemAsync(""));
+    EXPECT_FALSE(result.success);
+    EXPECT_EQ(result.error_message, "Input cannot be empty");
+}
+
+// Test the generator yields every result in input order
+TEST_F(AsyncProcessorTest, CoroutineBatchGenerator) {
+    auto expected = inputs();
+    auto results = syncWait(collect(async_, expected));
+    ASSERT_EQ(results.size(), expected.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+        EXPECT_EQ(results[i].result, processor_.processItem(expected[i], ProcessingMode::ADVANCED)
+                                         .result);
+    }
+    EXPECT_TRUE(syncWait(collect(async_, {})).empty());
+}
+
+// Test exceptions propagate through syncWait
+TEST_F(AsyncProcessorTest, CoroutineExceptionPropagates) {
+    EXPECT_THROW(syncWait(failing()), std::runtime_error);
+}
+
+#else
+
+// Test the futures fallback for single items
+TEST_F(AsyncProcessorTest, FutureProcessItem) {
+    auto future = async_.processItemAsync("hello");
+    EXPECT_EQ(future.get().result, "[SIMPLE] HELLO");
+
+    auto empty = async_.processItemAsync("");
+    EXPECT_FALSE(empty.get().success);
+}
+
+// Test the futures fallback keeps batch results in input order
+TEST_F(AsyncProcessorTest, FutureBatch) {
+    auto expected = inputs();
+    auto futures = async_.processBatchAsync(expected, ProcessingMode::ADVANCED);
+    ASSERT_EQ(futures.size(), expected.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+        EXPECT_EQ(futures[i].get().result,
+                  processor_.processItem(expected[i], ProcessingMode::ADVANCED).result);
+    }
+    EXPECT_TRUE(async_.processBatchAsync({}).empty());
+}
+
+#endif
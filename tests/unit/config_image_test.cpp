@@ -0,0 +1,158 @@
+#include "modules/config_image.h"
+#include <core/memory_tracking.h>
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "helpers/scoped_test_dir.h"
+#include "modules/config_manager.h"
+
+using namespace cpp_template::modules;
+namespace memory = cpp_template::core::memory;
+
+class ConfigImageTest : public ::testing::Test {
+  protected:
+    void SetUp() override { path_ = (dir_ / "app.cfgimg").string(); }
+
+    static std::string keyFor(size_t i) {
+        return "section" + std::to_string(i % 17) + ".key" + std::to_string(i);
+    }
+
+    std::string readImage() const {
+        std::ifstream in(path_, std::ios::binary);
+        return std::string(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    }
+
+    void writeImage(const std::string& bytes) const {
+        std::ofstream(path_, std::ios::binary | std::ios::trunc) << bytes;
+    }
+
+    ScopedTestDir dir_{"config_image_test"};
+    std::string path_;
+};
+
+// Test every key of configurations of several sizes is found, and no other key
+TEST_F(ConfigImageTest, PerfectHashFindsEveryKey) {
+    for (size_t count : {0u, 1u, 2u, 7u, 1000u, 5000u}) {
+        auto text_path = dir_ / "app.conf";
+        {
+            std::ofstream text(text_path, std::ios::binary);
+            for (size_t i = 0; i < count; ++i) {
+                text << keyFor(i) << "=value" << i << "\n";
+            }
+        }
+        ConfigManager config;
+        ASSERT_TRUE(config.loadFromFile(text_path.string()));
+        ASSERT_TRUE(config.saveImage(path_));
+
+        auto image = ConfigImage::open(path_);
+        ASSERT_NE(image, nullptr) << count;
+        ASSERT_EQ(image->size(), count);
+        for (size_t i = 0; i < count; ++i) {
+            auto value = image->find(keyFor(i));
+            ASSERT_TRUE(value.has_value()) << keyFor(i);
+            EXPECT_EQ(*value, "value" + std::to_string(i));
+        }
+        EXPECT_FALSE(image->find("missing").has_value());
+        EXPECT_FALSE(image->find("").has_value());
+        EXPECT_FALSE(image->find(keyFor(count)).has_value());
+    }
+}
+
+// Test the manager serves loaded images in place, with iteration and updates on top
+TEST_F(ConfigImageTest, ManagerLoadsImages) {
+    ConfigManager source;
+    source.setValue("processing.batch_size", "64");
+    source.setValue("processing.chunk_size", "256");
+    source.setValue("empty.value", "");
+    ASSERT_TRUE(source.saveImage(path_));
+
+    ConfigManager config;
+    uint64_t version = config.version();
+    ASSERT_TRUE(config.loadFromImage(path_));
+    EXPECT_GT(config.version(), version);
+
+    auto snapshot = config.snapshot();
+    EXPECT_EQ(snapshot->storage(), ConfigStorage::IMAGE);
+    EXPECT_EQ(snapshot->size(), source.snapshot()->size());
+    EXPECT_EQ(config.getValue("processing.batch_size"), "64");
+    EXPECT_EQ(config.getValue("app.name"), "cpp-template");
+    EXPECT_TRUE(config.hasKey("empty.value"));
+    EXPECT_EQ(config.getAllKeys(), source.getAllKeys());
+
+    std::vector<std::string> processing;
+    config.forEachWithPrefix("processing.", [&](std::string_view key, std::string_view) {
+        processing.emplace_back(key);
+    });
+    EXPECT_EQ(processing, (std::vector<std::string>{"processing.batch_size",
+                                                    "processing.chunk_size", "processing.mode"}));
+    EXPECT_TRUE(source.snapshot()->diff(*snapshot).empty());
+
+    // Updates copy the image into an ordinary snapshot; the old one stays readable
+    config.setValue("processing.batch_size", "128");
+    EXPECT_EQ(config.snapshot()->storage(), ConfigStorage::HASH);
+    EXPECT_EQ(config.getValue("processing.batch_size"), "128");
+    EXPECT_EQ(snapshot->getValue("processing.batch_size"), "64");
+}
+
+// Test lookups in a loaded image never touch the heap
+TEST_F(ConfigImageTest, LookupsDoNotAllocate) {
+    ConfigManager source;
+    for (size_t i = 0; i < 500; ++i) {
+        source.setValue(keyFor(i), "value");
+    }
+    ASSERT_TRUE(source.saveImage(path_));
+    ConfigManager config;
+    ASSERT_TRUE(config.loadFromImage(path_));
+    auto snapshot = config.snapshot();
+    std::vector<std::string> keys;
+    for (size_t i = 0; i < 500; ++i) {
+        keys.push_back(keyFor(i));
+    }
+
+    memory::setCountingEnabled(true);
+    memory::resetStatistics();
+    size_t found = 0;
+    for (const std::string& key : keys) {
+        found += snapshot->find(key).has_value() ? 1 : 0;
+    }
+    uint64_t allocations = memory::totalStatistics().allocations;
+    EXPECT_EQ(found, keys.size());
+    EXPECT_TRUE(memory::trackingActive());
+    EXPECT_EQ(allocations, 0u);
+}
+
+// Test damaged, truncated and foreign files are rejected and keep the current values
+TEST_F(ConfigImageTest, RejectsInvalidImages) {
+    ConfigManager source;
+    ASSERT_TRUE(source.saveImage(path_));
+    const std::string good = readImage();
+
+    std::string error;
+    ConfigManager config;
+    config.setValue("kept", "yes");
+    auto expectRejected = [&](const std::string& bytes, const std::string& reason) {
+        writeImage(bytes);
+        EXPECT_EQ(ConfigImage::open(path_, &error), nullptr) << reason;
+        EXPECT_NE(error.find(reason), std::string::npos) << error;
+        EXPECT_FALSE(config.loadFromImage(path_));
+        EXPECT_EQ(config.getValue("kept"), "yes");
+    };
+
+    std::string flipped = good;
+    flipped[flipped.size() - 1] ^= 0x20;
+    expectRejected(flipped, "checksum mismatch");
+    expectRejected(good.substr(0, good.size() - 1), "truncated");
+    expectRejected(good.substr(0, 10), "too small");
+    expectRejected(std::string(good.size(), 'x'), "not a config image");
+
+    std::string future = good;
+    future[8] = static_cast<char>(ConfigImage::kFormatVersion + 1);
+    expectRejected(future, "unsupported format version");
+
+    EXPECT_EQ(ConfigImage::open((dir_ / "missing").string(), &error), nullptr);
+    EXPECT_NE(error.find("cannot map"), std::string::npos);
+}
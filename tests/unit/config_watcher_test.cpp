@@ -0,0 +1,212 @@
+#include "modules/config_watcher.h"
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+#include "helpers/scoped_test_dir.h"
+#include "modules/config_manager.h"
+
+using namespace cpp_template::modules;
+
+namespace {
+
+// Owned copy of a ConfigChange, which only views the compared snapshots
+struct RecordedChange {
+    std::string key;
+    std::optional<std::string> old_value;
+    std::optional<std::string> new_value;
+
+    bool operator==(const RecordedChange& other) const {
+        return key == other.key && old_value == other.old_value && new_value == other.new_value;
+    }
+};
+
+std::vector<RecordedChange> record(const std::vector<ConfigChange>& changes) {
+    std::vector<RecordedChange> recorded;
+    for (const ConfigChange& change : changes) {
+        recorded.push_back({std::string(change.key),
+                            change.old_value ? std::optional<std::string>(*change.old_value)
+                                             : std::nullopt,
+                            change.new_value ? std::optional<std::string>(*change.new_value)
+                                             : std::nullopt});
+    }
+    return recorded;
+}
+
+}  // namespace
+
+class ConfigWatcherTest : public ::testing::Test {
+  protected:
+    void SetUp() override { path_ = (dir_ / "app.conf").string(); }
+
+    // Replace the file the way deployment tools do: write a copy, then rename it over
+    void writeConfig(const std::string& contents) {
+        auto staging = dir_ / "app.conf.tmp";
+        std::ofstream(staging, std::ios::binary) << contents;
+        std::filesystem::rename(staging, path_);
+    }
+
+    // Poll instead of blocking on a condition so a missed event fails instead of hanging
+    template <typename Predicate>
+    static bool waitFor(Predicate done) {
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (!done()) {
+            if (std::chrono::steady_clock::now() > deadline) {
+                return false;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        }
+        return true;
+    }
+
+    ScopedTestDir dir_{"config_watcher_test"};
+    std::string path_;
+};
+
+// Test diffs list added, removed and modified keys in key order
+TEST_F(ConfigWatcherTest, SnapshotDiff) {
+    ConfigSnapshot before({{"a", "1"}, {"b", "2"}, {"d", "4"}}, 1);
+    ConfigSnapshot after({{"b", "2"}, {"c", "3"}, {"d", "5"}}, 2);
+
+    std::vector<RecordedChange> expected = {
+        {"a", "1", std::nullopt}, {"c", std::nullopt, "3"}, {"d", "4", "5"}};
+    EXPECT_EQ(record(before.diff(after)), expected);
+    EXPECT_TRUE(before.diff(before).empty());
+}
+
+// Test subscribers hear only about changed keys under their prefix
+TEST_F(ConfigWatcherTest, SubscribersSeeOnlyTheirChanges) {
+    ConfigManager config;
+    std::vector<RecordedChange> processing;
+    std::vector<RecordedChange> everything;
+    uint64_t versions_seen = 0;
+    uint64_t processing_id =
+        config.subscribe("processing.", [&](const std::vector<ConfigChange>& changes,
+                                            const ConfigSnapshot& current) {
+            auto recorded = record(changes);
+            processing.insert(processing.end(), recorded.begin(), recorded.end());
+            versions_seen = current.version();
+        });
+    config.subscribe("", [&](const std::vector<ConfigChange>& changes, const ConfigSnapshot&) {
+        auto recorded = record(changes);
+        everything.insert(everything.end(), recorded.begin(), recorded.end());
+    });
+
+    config.setValue("logging.level", "debug");
+    config.setValue("processing.batch_size", "10");  // Unchanged: nobody is told
+    config.setValue("processing.threads", "4");
+    EXPECT_EQ(versions_seen, config.version());
+
+    EXPECT_EQ(processing, (std::vector<RecordedChange>{{"processing.threads", std::nullopt, "4"}}));
+    EXPECT_EQ(everything.size(), 2u);
+    EXPECT_EQ(everything[0], (RecordedChange{"logging.level", "info", "debug"}));
+
+    EXPECT_TRUE(config.unsubscribe(processing_id));
+    EXPECT_FALSE(config.unsubscribe(processing_id));
+    config.setValue("processing.threads", "8");
+    EXPECT_EQ(processing.size(), 1u);
+    EXPECT_EQ(everything.size(), 3u);
+}
+
+// Test the watcher reloads on change, skipping failed loads, and notifies once per reload
+TEST_F(ConfigWatcherTest, ReloadsOnChange) {
+    writeConfig("processing.batch_size=10\nprocessing.mode=simple\napp.name=first\n");
+    ConfigManager config;
+    std::mutex changes_mutex;
+    std::map<std::string, std::optional<std::string>> changed;
+    config.subscribe("processing.", [&](const std::vector<ConfigChange>& changes,
+                                        const ConfigSnapshot&) {
+        std::lock_guard<std::mutex> lock(changes_mutex);
+        for (const RecordedChange& change : record(changes)) {
+            changed[change.key] = change.new_value;
+        }
+    });
+
+    ConfigWatcher watcher(config, path_);
+    EXPECT_EQ(watcher.filename(), path_);
+    EXPECT_GE(watcher.reloads(), 1u);
+    EXPECT_EQ(config.getValue("app.name"), "first");
+
+    writeConfig("processing.batch_size=64\nprocessing.mode=simple\napp.name=second\n");
+    ASSERT_TRUE(waitFor([&] { return config.getValue("app.name") == "second"; }));
+    {
+        std::lock_guard<std::mutex> lock(changes_mutex);
+        // mode kept its value, so only batch_size is reported
+        EXPECT_EQ(changed.size(), 1u);
+        EXPECT_EQ(changed["processing.batch_size"], std::optional<std::string>("64"));
+    }
+
+    // Removing the file fails the reload and keeps the configuration
+    uint64_t failures = watcher.failures();
+    std::filesystem::remove(path_);
+    ASSERT_TRUE(waitFor([&] { return watcher.failures() > failures; }));
+    EXPECT_EQ(config.getValue("processing.batch_size"), "64");
+
+    watcher.stop();
+    uint64_t reloads = watcher.reloads();
+    writeConfig("app.name=stopped\n");
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_EQ(watcher.reloads(), reloads);
+    EXPECT_EQ(config.getValue("app.name"), "second");
+}
+
+// Test the initial load never publishes over a change the watcher thread already reloaded
+TEST_F(ConfigWatcherTest, InitialLoadKeepsNewerChanges) {
+    writeConfig("app.name=0\n");
+    std::atomic<bool> done{false};
+    std::atomic<int> written{0};
+    std::thread writer([&] {
+        for (int i = 1; !done.load(); ++i) {
+            writeConfig("app.name=" + std::to_string(i) + "\n");
+            written.store(i);
+        }
+    });
+    for (int round = 0; round < 20; ++round) {
+        ConfigManager config;
+        ConfigWatcher watcher(config, path_);
+        EXPECT_GE(watcher.reloads(), 1u);
+        if (round == 19) {
+            done.store(true);
+            writer.join();
+            const std::string last = std::to_string(written.load());
+            EXPECT_TRUE(waitFor([&] { return config.getValue("app.name") == last; }));
+        }
+    }
+}
+
+// Test reloading while another thread truncates and rewrites the file in place
+TEST_F(ConfigWatcherTest, ReloadToleratesInPlaceRewrites) {
+    std::string contents;
+    for (int i = 0; i < 20000; ++i) {
+        contents += "key." + std::to_string(i) + "=value " + std::to_string(i) + "\n";
+    }
+    std::ofstream(path_, std::ios::binary) << contents;
+
+    std::atomic<bool> done{false};
+    std::thread writer([&] {
+        while (!done.load()) {
+            // Leave the file empty for a moment, as a slow writer would
+            std::ofstream stream(path_, std::ios::binary | std::ios::trunc);
+            std::this_thread::sleep_for(std::chrono::microseconds(200));
+            stream << contents;
+        }
+    });
+    ConfigManager config;
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_TRUE(config.reloadFromFile(path_));
+        EXPECT_LE(config.getAllKeys().size(), 20000u);
+    }
+    done.store(true);
+    writer.join();
+
+    ASSERT_TRUE(config.reloadFromFile(path_));
+    EXPECT_EQ(config.getValue("key.19999"), "value 19999");
+    EXPECT_FALSE(config.reloadFromFile((dir_ / "missing.conf").string()));
+}
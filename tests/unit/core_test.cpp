@@ -2,6 +2,9 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 #include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
 
 using namespace cpp_template::core;
 
@@ -143,6 +146,34 @@ TEST_F(CoreTest, ProcessSpecialCharacters) {
     EXPECT_EQ(result, expected);
 }
 
+// Test processMany matches process for every input
+TEST_F(CoreTest, ProcessManyMatchesProcess) {
+    Core core(test_name_);
+    core.initialize();
+
+    std::vector<std::string_view> inputs = {"hello world", "", "MiXeD 123", "a"};
+    std::vector<std::string> results;
+    core.processMany(inputs, [&](std::string_view processed) {
+        results.emplace_back(processed);
+    });
+
+    ASSERT_EQ(results.size(), inputs.size());
+    for (size_t i = 0; i < inputs.size(); ++i) {
+        EXPECT_EQ(results[i], core.process(std::string(inputs[i])));
+    }
+
+    size_t calls = 0;
+    core.processMany(inputs.data(), 0, [&](std::string_view) { ++calls; });
+    EXPECT_EQ(calls, 0);
+}
+
+TEST_F(CoreTest, ProcessManyWithoutInitialization) {
+    Core core(test_name_);
+    std::vector<std::string_view> inputs = {"test input"};
+
+    EXPECT_THROW(core.processMany(inputs, [](std::string_view) {}), std::runtime_error);
+}
+
 // Test copy constructor and assignment
 TEST_F(CoreTest, CopyConstructor) {
     Core original(test_name_);
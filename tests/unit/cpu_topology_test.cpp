@@ -0,0 +1,116 @@
+#include "core/cpu_topology.h"
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+#include "helpers/scoped_test_dir.h"
+
+using namespace cpp_template::core;
+using ::testing::ElementsAre;
+
+class CpuTopologyTest : public ::testing::Test {
+  protected:
+    void SetUp() override {
+#ifndef __linux__
+        GTEST_SKIP() << "procfs, cgroupfs and sysfs are Linux only";
+#endif
+    }
+
+    // Create a file of the fake system tree
+    void write(const std::string& relative, const std::string& contents) {
+        std::filesystem::path file = root_ / relative;
+        std::filesystem::create_directories(file.parent_path());
+        std::ofstream(file) << contents;
+    }
+
+    CpuTopology detect() const { return detectCpuTopology(root_.path().string()); }
+
+    ScopedTestDir root_{"cpu_topology_test"};
+};
+
+// Test CPU list parsing
+TEST(CpuListTest, ParsesRangesAndRejectsGarbage) {
+    EXPECT_THAT(parseCpuList("0-3,8,10-11\n"), ElementsAre(0, 1, 2, 3, 8, 10, 11));
+    EXPECT_THAT(parseCpuList(" 5 "), ElementsAre(5));
+    EXPECT_THAT(parseCpuList("4,2,2-3"), ElementsAre(2, 3, 4));
+    EXPECT_TRUE(parseCpuList("").empty());
+    EXPECT_TRUE(parseCpuList("3-1").empty());
+    EXPECT_TRUE(parseCpuList("0-").empty());
+    EXPECT_TRUE(parseCpuList("a").empty());
+    EXPECT_TRUE(parseCpuList("0-4294967295").empty());
+}
+
+// Test the quota caps the affinity mask, rounding up partial CPUs
+TEST(CpuConcurrencyTest, QuotaCapsAllowedCpus) {
+    CpuTopology topology;
+    topology.allowed_cpus = {0, 1, 2, 3, 4, 5, 6, 7};
+    EXPECT_EQ(topology.concurrency(), 8u);
+    topology.cpu_quota = 1.5;
+    EXPECT_EQ(topology.concurrency(), 2u);
+    topology.cpu_quota = 0.1;
+    EXPECT_EQ(topology.concurrency(), 1u);
+    topology.cpu_quota = 32.0;
+    EXPECT_EQ(topology.concurrency(), 8u);
+
+    EXPECT_GE(effectiveConcurrency(), 1u);
+    EXPECT_LE(effectiveConcurrency(), std::max(1u, std::thread::hardware_concurrency()));
+}
+
+// Test cgroup v2: the tightest cpu.max between the process's cgroup and the root wins
+TEST_F(CpuTopologyTest, ReadsCgroupV2Quota) {
+    write("proc/self/status", "Name:\ttest\nCpus_allowed_list:\t0-7\n");
+    write("proc/self/cgroup", "0::/kubepods/pod1/app\n");
+    write("sys/fs/cgroup/cpu.max", "max 100000\n");
+    write("sys/fs/cgroup/kubepods/pod1/cpu.max", "250000 100000\n");
+    write("sys/fs/cgroup/kubepods/pod1/app/cpu.max", "max 100000\n");
+
+    CpuTopology topology = detect();
+    EXPECT_DOUBLE_EQ(topology.cpu_quota, 2.5);
+    EXPECT_EQ(topology.allowed_cpus.size(), 8u);
+    EXPECT_EQ(topology.concurrency(), 3u);
+}
+
+// Test cgroup v1 with the container's own cgroup mounted at the controller root
+TEST_F(CpuTopologyTest, ReadsCgroupV1Quota) {
+    write("proc/self/status", "Cpus_allowed_list:\t0-15\n");
+    write("proc/self/cgroup", "5:memory:/docker/abc\n3:cpu,cpuacct:/docker/abc\n");
+    write("sys/fs/cgroup/cpu,cpuacct/cpu.cfs_quota_us", "200000\n");
+    write("sys/fs/cgroup/cpu,cpuacct/cpu.cfs_period_us", "100000\n");
+
+    EXPECT_EQ(detect().concurrency(), 2u);
+
+    write("sys/fs/cgroup/cpu,cpuacct/cpu.cfs_quota_us", "-1\n");
+    CpuTopology unlimited = detect();
+    EXPECT_EQ(unlimited.cpu_quota, 0.0);
+    EXPECT_EQ(unlimited.concurrency(), 16u);
+}
+
+// Test NUMA nodes keep only allowed CPUs and nodes left empty are dropped
+TEST_F(CpuTopologyTest, ReadsNumaNodesWithinAffinity) {
+    write("proc/self/status", "Cpus_allowed_list:\t2-5,9\n");
+    write("sys/devices/system/node/node0/cpulist", "0-3\n");
+    write("sys/devices/system/node/node1/cpulist", "4-7\n");
+    write("sys/devices/system/node/node2/cpulist", "8,10\n");
+    write("sys/devices/system/node/online", "0-2\n");
+
+    CpuTopology topology = detect();
+    EXPECT_THAT(topology.allowed_cpus, ElementsAre(2, 3, 4, 5, 9));
+    ASSERT_EQ(topology.nodes.size(), 2u);
+    EXPECT_EQ(topology.nodes[0].id, 0u);
+    EXPECT_THAT(topology.nodes[0].cpus, ElementsAre(2, 3));
+    EXPECT_EQ(topology.nodes[1].id, 1u);
+    EXPECT_THAT(topology.nodes[1].cpus, ElementsAre(4, 5));
+    EXPECT_EQ(topology.cpu_quota, 0.0);
+}
+
+// Test a tree without NUMA information reports every allowed CPU as node 0
+TEST_F(CpuTopologyTest, FallsBackToOneNode) {
+    write("proc/self/status", "Cpus_allowed_list:\t0-3\n");
+
+    CpuTopology topology = detect();
+    ASSERT_EQ(topology.nodes.size(), 1u);
+    EXPECT_THAT(topology.nodes[0].cpus, ElementsAre(0, 1, 2, 3));
+    EXPECT_EQ(topology.concurrency(), 4u);
+}
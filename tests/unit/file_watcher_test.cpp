@@ -0,0 +1,102 @@
+#include "core/file_watcher.h"
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <system_error>
+#include <thread>
+#include "helpers/scoped_test_dir.h"
+
+using namespace cpp_template::core;
+
+class FileWatcherTest : public ::testing::Test {
+  protected:
+    void writeFile(const std::filesystem::path& path, const std::string& contents) {
+        std::ofstream(path, std::ios::binary) << contents;
+    }
+
+    // Poll instead of blocking on a condition so a missed event fails instead of hanging
+    static bool waitFor(const std::atomic<int>& counter, int expected) {
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (counter.load() < expected) {
+            if (std::chrono::steady_clock::now() > deadline) {
+                return false;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        }
+        return true;
+    }
+
+    ScopedTestDir dir_{"file_watcher_test"};
+};
+
+// Test writes, atomic replacement and removal of the file are all reported
+TEST_F(FileWatcherTest, ReportsWritesReplacementsAndRemoval) {
+    auto path = dir_ / "watched.conf";
+    writeFile(path, "a=1\n");
+    std::atomic<int> calls{0};
+    FileWatcher watcher(path.string(), [&] { ++calls; });
+    EXPECT_EQ(watcher.path(), path.string());
+
+    writeFile(path, "a=2\n");
+    ASSERT_TRUE(waitFor(calls, 1));
+
+    int seen = calls.load();
+    writeFile(dir_ / "watched.conf.tmp", "a=3\n");
+    std::filesystem::rename(dir_ / "watched.conf.tmp", path);
+    ASSERT_TRUE(waitFor(calls, seen + 1));
+
+    seen = calls.load();
+    std::filesystem::remove(path);
+    ASSERT_TRUE(waitFor(calls, seen + 1));
+}
+
+// Test other files in the directory are ignored and stop() ends the callbacks
+TEST_F(FileWatcherTest, IgnoresOtherFilesAndStops) {
+    auto path = dir_ / "watched.conf";
+    std::atomic<int> calls{0};
+    FileWatcher watcher(path.string(), [&] { ++calls; });
+
+    writeFile(dir_ / "other.conf", "ignored\n");
+    writeFile(path, "created=1\n");
+    ASSERT_TRUE(waitFor(calls, 1));
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_EQ(calls.load(), 1);
+
+    watcher.stop();
+    watcher.stop();
+    writeFile(path, "after=stop\n");
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_EQ(calls.load(), 1);
+}
+
+#ifdef __linux__
+// Test a ConfigMap-style update, which only renames a new ..data link over the old one
+TEST_F(FileWatcherTest, ReportsSymlinkSwapOfLinkedDirectory) {
+    std::filesystem::create_directories(dir_ / "..v1");
+    std::filesystem::create_directories(dir_ / "..v2");
+    writeFile(dir_ / "..v1" / "app.conf", "a=1\n");
+    writeFile(dir_ / "..v2" / "app.conf", "a=2\n");
+    std::filesystem::create_directory_symlink("..v1", dir_ / "..data");
+    std::filesystem::create_symlink("..data/app.conf", dir_ / "app.conf");
+
+    std::atomic<int> calls{0};
+    FileWatcher watcher((dir_ / "app.conf").string(), [&] { ++calls; });
+    std::filesystem::create_directory_symlink("..v2", dir_ / "..data_tmp");
+    std::filesystem::rename(dir_ / "..data_tmp", dir_ / "..data");
+    ASSERT_TRUE(waitFor(calls, 1));
+
+    std::ifstream input(dir_ / "app.conf");
+    std::string line;
+    std::getline(input, line);
+    EXPECT_EQ(line, "a=2");
+}
+#endif
+
+// Test a missing directory cannot be watched
+TEST_F(FileWatcherTest, MissingDirectoryThrows) {
+    EXPECT_THROW(FileWatcher((dir_ / "missing" / "file.conf").string(), [] {}),
+                 std::system_error);
+}
@@ -0,0 +1,68 @@
+#include "core/file_writer.h"
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include "helpers/scoped_test_dir.h"
+
+using namespace cpp_template::core;
+
+class FileWriterTest : public ::testing::Test {
+  protected:
+    std::string path(const std::string& name) const { return (dir_ / name).string(); }
+
+    static std::string readFile(const std::string& file) {
+        std::ifstream in(file, std::ios::binary);
+        return std::string(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    }
+
+    ScopedTestDir dir_{"file_writer_test"};
+};
+
+// Test small writes are buffered until flushed and arrive in order
+TEST_F(FileWriterTest, BuffersSmallWrites) {
+    FileWriter writer(64);
+    ASSERT_TRUE(writer.open(path("small.txt")));
+    EXPECT_TRUE(writer.write("alpha\n"));
+    EXPECT_TRUE(writer.write("beta\n"));
+    EXPECT_EQ(readFile(path("small.txt")), "");
+
+    EXPECT_TRUE(writer.flush());
+    EXPECT_EQ(readFile(path("small.txt")), "alpha\nbeta\n");
+    EXPECT_EQ(writer.bytesWritten(), 11u);
+    EXPECT_TRUE(writer.close());
+    EXPECT_FALSE(writer.isOpen());
+}
+
+// Test writes straddling and exceeding the buffer keep their order
+TEST_F(FileWriterTest, LargeWritesKeepOrder) {
+    std::string expected;
+    {
+        FileWriter writer(16);
+        ASSERT_TRUE(writer.open(path("large.txt")));
+        for (size_t length : {5u, 9u, 7u, 40u, 1u, 16u, 0u, 100u}) {
+            std::string piece(length, static_cast<char>('a' + length % 26));
+            ASSERT_TRUE(writer.write(piece));
+            expected += piece;
+        }
+        // Destruction flushes
+    }
+    EXPECT_EQ(readFile(path("large.txt")), expected);
+}
+
+// Test reopening truncates and failures are reported
+TEST_F(FileWriterTest, OpenTruncatesAndReportsErrors) {
+    FileWriter writer;
+    ASSERT_TRUE(writer.open(path("out.txt")));
+    EXPECT_TRUE(writer.write("first contents"));
+    ASSERT_TRUE(writer.open(path("out.txt")));
+    EXPECT_TRUE(writer.write("second"));
+    EXPECT_TRUE(writer.close());
+    EXPECT_EQ(readFile(path("out.txt")), "second");
+
+    EXPECT_FALSE(writer.open((dir_ / "missing" / "out.txt").string()));
+    EXPECT_FALSE(writer.write("x"));
+    EXPECT_FALSE(writer.flush());
+    EXPECT_FALSE(writer.close());
+}
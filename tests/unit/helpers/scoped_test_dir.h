@@ -0,0 +1,58 @@
+#pragma once
+
+/**
+ * @file scoped_test_dir.h
+ * @brief Temporary directory owned by the running test
+ */
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <filesystem>
+#include <string>
+#include <system_error>
+
+/**
+ * @brief Empty directory under the system temp directory, removed on destruction
+ *
+ * The name combines a per-binary prefix with the running test's suite and
+ * name, so tests of one binary and of different binaries run in parallel
+ * (ctest -j) never share a directory. Leftovers of an earlier, crashed run
+ * are removed first. Construct it while a test runs, e.g. as a fixture
+ * member.
+ */
+class ScopedTestDir {
+  public:
+    /**
+     * @param prefix Distinguishes the test binary, e.g. "mapped_file_test"
+     */
+    explicit ScopedTestDir(const std::string& prefix)
+        : path_(std::filesystem::temp_directory_path() / (prefix + "_" + currentTestName())) {
+        std::filesystem::remove_all(path_);
+        std::filesystem::create_directories(path_);
+    }
+
+    ~ScopedTestDir() {
+        std::error_code ignored;
+        std::filesystem::remove_all(path_, ignored);
+    }
+
+    ScopedTestDir(const ScopedTestDir&) = delete;
+    ScopedTestDir& operator=(const ScopedTestDir&) = delete;
+
+    const std::filesystem::path& path() const noexcept { return path_; }
+
+    std::filesystem::path operator/(const std::filesystem::path& name) const {
+        return path_ / name;
+    }
+
+  private:
+    static std::string currentTestName() {
+        const ::testing::TestInfo* info = ::testing::UnitTest::GetInstance()->current_test_info();
+        std::string name = std::string(info->test_suite_name()) + "_" + info->name();
+        // Parameterized and typed tests have '/' in their names
+        std::replace(name.begin(), name.end(), '/', '_');
+        return name;
+    }
+
+    std::filesystem::path path_;
+};
@@ -1,12 +1,24 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
+#include <algorithm>
+#include <atomic>
 #include <filesystem>
 #include <fstream>
+#include <iterator>
 #include <memory>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <tuple>
 #include "core/core.h"
+#include "core/string_batch.h"
 #include "core/utils.h"
+#include "helpers/scoped_test_dir.h"
+#include "modules/config_handle.h"
 #include "modules/config_manager.h"
 #include "modules/data_processor.h"
+#include "modules/file_processor.h"
+#include "modules/ingest_pipeline.h"
 
 using namespace cpp_template::modules;
 using namespace cpp_template::core;
@@ -14,10 +26,6 @@ using namespace cpp_template::core;
 class IntegrationTest : public ::testing::Test {
   protected:
     void SetUp() override {
-        // Create temporary directory for test files
-        test_dir_ = std::filesystem::temp_directory_path() / "cpp_template_test";
-        std::filesystem::create_directories(test_dir_);
-
         // Create test configuration file
         config_file_ = test_dir_ / "test_config.txt";
         createTestConfigFile();
@@ -28,11 +36,6 @@ class IntegrationTest : public ::testing::Test {
         core_instance_ = createCore("IntegrationTestCore");
     }
 
-    void TearDown() override {
-        // Clean up test files
-        std::filesystem::remove_all(test_dir_);
-    }
-
     void createTestConfigFile() {
         std::ofstream file(config_file_);
         file << "# Test configuration file\n";
@@ -45,7 +48,7 @@ class IntegrationTest : public ::testing::Test {
         file.close();
     }
 
-    std::filesystem::path test_dir_;
+    ScopedTestDir test_dir_{"cpp_template_test"};
     std::filesystem::path config_file_;
     std::shared_ptr<ConfigManager> config_manager_;
     std::unique_ptr<DataProcessor> data_processor_;
@@ -318,3 +321,701 @@ TEST_F(IntegrationTest, CrossModuleDataFlow) {
     std::string stats = data_processor_->getStatistics();
     EXPECT_TRUE(stats.find("Successful Operations: 1") != std::string::npos);
 }
+
+// Test parallel batch processing keeps results identical to the serial path
+TEST_F(IntegrationTest, ParallelBatchMatchesSerial) {
+    std::vector<std::string> inputs;
+    for (int i = 0; i < 5000; ++i) {
+        inputs.push_back(i % 17 == 0 ? "" : "  item " + std::to_string(i) + " ");
+    }
+    config_manager_->setValue("processing.batch_size", "100000");
+
+    for (auto mode : {ProcessingMode::SIMPLE, ProcessingMode::ADVANCED, ProcessingMode::BATCH}) {
+        config_manager_->setValue("processing.threads", "1");
+        auto serial = data_processor_->processBatch(inputs, mode);
+
+        config_manager_->setValue("processing.threads", "4");
+        config_manager_->setValue("processing.chunk_size", "64");
+        auto parallel = data_processor_->processBatch(inputs, mode);
+
+        ASSERT_TRUE(serial.success);
+        ASSERT_TRUE(parallel.success);
+        EXPECT_EQ(parallel.processed_items, serial.processed_items);
+        EXPECT_EQ(parallel.result, serial.result);
+    }
+
+    // Invalid thread settings are reported as a failed batch
+    config_manager_->setValue("processing.threads", "-2");
+    EXPECT_FALSE(data_processor_->processBatch(inputs, ProcessingMode::BATCH).success);
+}
+
+// Test structured statistics while several threads share one processor
+TEST_F(IntegrationTest, ConcurrentStatisticsSnapshot) {
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([this, t] {
+            for (int i = 0; i < 500; ++i) {
+                auto mode = (i % 2 == 0) ? ProcessingMode::SIMPLE : ProcessingMode::ADVANCED;
+                data_processor_->processItem("item " + std::to_string(t * 1000 + i), mode);
+            }
+            data_processor_->processItem("", ProcessingMode::SIMPLE);
+        });
+    }
+    // Scraping under load must be safe
+    for (int i = 0; i < 10; ++i) {
+        data_processor_->getStatisticsSnapshot();
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    ProcessingStatistics stats = data_processor_->getStatisticsSnapshot();
+    EXPECT_EQ(stats.total_processed, 2000);
+    EXPECT_EQ(stats.successful_operations, 2000);
+    EXPECT_EQ(stats.failed_operations, 4);
+    EXPECT_NEAR(stats.successRate(), 2000.0 / 2004.0 * 100.0, 1e-9);
+
+    const auto& simple = stats.latency[static_cast<size_t>(ProcessingMode::SIMPLE)];
+    const auto& batch = stats.latency[static_cast<size_t>(ProcessingMode::BATCH)];
+    EXPECT_EQ(simple.count, 1000);
+    EXPECT_LE(simple.p50_ns, simple.p99_ns);
+    EXPECT_LE(simple.p99_ns, simple.max_ns);
+    EXPECT_EQ(batch.count, 0);
+
+    EXPECT_TRUE(data_processor_->getStatistics().find("Latency SIMPLE: count=1000") !=
+                std::string::npos);
+
+    data_processor_->resetStatistics();
+    EXPECT_EQ(data_processor_->getStatisticsSnapshot().total_processed, 0);
+}
+
+// Test streaming processing delivers the same items as processBatch, in order
+TEST_F(IntegrationTest, StreamMatchesBatch) {
+    std::vector<std::string> inputs;
+    for (int i = 0; i < 3000; ++i) {
+        inputs.push_back(i % 11 == 0 ? "" : " stream " + std::to_string(i) + " ");
+    }
+    config_manager_->setValue("processing.batch_size", "100000");
+    config_manager_->setValue("processing.stream_buffer", "100");
+
+    for (const char* threads : {"1", "4"}) {
+        config_manager_->setValue("processing.threads", threads);
+        auto batch = data_processor_->processBatch(inputs, ProcessingMode::ADVANCED);
+
+        std::vector<std::string> streamed;
+        auto result = data_processor_->processRange(inputs.begin(), inputs.end(),
+                                                    std::back_inserter(streamed),
+                                                    ProcessingMode::ADVANCED);
+        ASSERT_TRUE(result.success);
+        EXPECT_EQ(result.processed_items, batch.processed_items);
+        EXPECT_TRUE(result.result.empty());
+        EXPECT_EQ(utils::string::join(streamed, ", "), batch.result);
+    }
+
+    // A generator source; every window is handed to the sink before the next is read
+    size_t produced = 0;
+    size_t max_outstanding = 0;
+    size_t consumed = 0;
+    auto result = data_processor_->processStream(
+        [&](std::string& item) {
+            if (produced == 1000) {
+                return false;
+            }
+            item = "gen " + std::to_string(produced++);
+            max_outstanding = std::max(max_outstanding, produced - consumed);
+            return true;
+        },
+        [&](std::string&& processed) {
+            EXPECT_EQ(processed, "[SIMPLE] GEN " + std::to_string(consumed));
+            ++consumed;
+        },
+        ProcessingMode::SIMPLE);
+    EXPECT_TRUE(result.success);
+    EXPECT_EQ(consumed, 1000);
+    EXPECT_LE(max_outstanding, 100);
+
+    config_manager_->setValue("processing.stream_buffer", "0");
+    EXPECT_FALSE(data_processor_->processStream([](std::string&) { return false; },
+                                                [](std::string&&) {})
+                     .success);
+}
+
+// Test config snapshots stay immutable while writers publish new versions
+TEST_F(IntegrationTest, ConfigSnapshotIsolation) {
+    auto before = config_manager_->snapshot();
+    uint64_t version = config_manager_->version();
+    EXPECT_EQ(before->version(), version);
+
+    config_manager_->setValue("processing.batch_size", "42");
+    EXPECT_GT(config_manager_->version(), version);
+    EXPECT_EQ(before->getValue("processing.batch_size"), "10");
+    EXPECT_EQ(config_manager_->snapshot()->getValue("processing.batch_size"), "42");
+    EXPECT_FALSE(config_manager_->snapshot()->find("missing").has_value());
+
+    ASSERT_TRUE(config_manager_->loadFromFile(config_file_.string()));
+    EXPECT_EQ(before->getValue("app.name"), "cpp-template");
+    EXPECT_EQ(config_manager_->snapshot()->getValue("app.name"), "integration-test");
+
+    // Readers racing a writer always see a complete, consistent snapshot
+    std::atomic<bool> done{false};
+    std::thread writer([&] {
+        for (int i = 0; i < 2000; ++i) {
+            config_manager_->setValue("test.counter", std::to_string(i));
+        }
+        done = true;
+    });
+    uint64_t last_version = 0;
+    while (!done) {
+        auto current = config_manager_->snapshot();
+        EXPECT_GE(current->version(), last_version);
+        EXPECT_EQ(current->getValue("app.name"), "integration-test");
+        last_version = current->version();
+    }
+    writer.join();
+    EXPECT_EQ(config_manager_->getValue("test.counter"), "1999");
+}
+
+// Test per-thread cached snapshots follow changes and never mix up managers
+TEST_F(IntegrationTest, CachedSnapshotsTrackManagers) {
+    // More managers than cache slots, read in turn, each with its own value
+    std::vector<std::unique_ptr<ConfigManager>> managers;
+    for (int i = 0; i < 9; ++i) {
+        managers.push_back(std::make_unique<ConfigManager>());
+        managers.back()->setValue("id", std::to_string(i));
+    }
+    for (int round = 0; round < 3; ++round) {
+        for (size_t i = 0; i < managers.size(); ++i) {
+            EXPECT_EQ(managers[i]->getValue("id"), std::to_string(i));
+        }
+    }
+
+    // A manager reusing a destroyed one's memory starts from its own snapshot
+    for (int i = 0; i < 20; ++i) {
+        ConfigManager manager;
+        EXPECT_FALSE(manager.hasKey("id"));
+        manager.setValue("id", "fresh");
+        EXPECT_EQ(manager.getValue("id"), "fresh");
+    }
+
+    // A change on one thread is seen by another thread's next read
+    auto another_thread = [this] { return config_manager_->getValue("processing.mode"); };
+    std::string seen;
+    std::thread([&] { seen = another_thread(); }).join();
+    EXPECT_EQ(seen, "simple");
+    std::atomic<bool> cached{false};
+    std::thread reader([&] {
+        EXPECT_EQ(another_thread(), "simple");
+        cached = true;
+        while (another_thread() != "parallel") {
+            std::this_thread::yield();
+        }
+    });
+    while (!cached) {
+        std::this_thread::yield();
+    }
+    config_manager_->setValue("processing.mode", "parallel");
+    reader.join();
+    EXPECT_EQ(config_manager_->getValue("processing.mode"), "parallel");
+}
+
+// Test typed config handles parse once and refresh only after a change
+TEST_F(IntegrationTest, TypedConfigHandles) {
+    ConfigHandle<int> batch_size(*config_manager_, "processing.batch_size", 1);
+    ConfigHandle<bool> verbose(*config_manager_, "logging.verbose", false);
+    ConfigHandle<double> ratio(*config_manager_, "processing.ratio", 0.5);
+
+    EXPECT_EQ(batch_size.get(), 10);
+    EXPECT_FALSE(verbose.get());
+    EXPECT_DOUBLE_EQ(ratio.get(), 0.5);
+
+    config_manager_->setValue("logging.verbose", "Yes");
+    config_manager_->setValue("processing.ratio", "0.25");
+    EXPECT_TRUE(verbose.get());
+    EXPECT_DOUBLE_EQ(ratio.get(), 0.25);
+
+    config_manager_->setValue("processing.batch_size", "12x");
+    EXPECT_THROW(batch_size.get(), std::invalid_argument);
+    ASSERT_TRUE(config_manager_->loadFromFile(config_file_.string()));
+    EXPECT_EQ(batch_size.get(), 3);
+    EXPECT_FALSE(verbose.get());
+
+    // Enums use a caller-supplied parser
+    ConfigHandle<ProcessingMode> mode(
+        *config_manager_, "processing.mode", ProcessingMode::SIMPLE,
+        [](std::string_view text, ProcessingMode& value) {
+            if (text == "advanced") {
+                value = ProcessingMode::ADVANCED;
+            } else if (text == "batch") {
+                value = ProcessingMode::BATCH;
+            } else if (text == "simple") {
+                value = ProcessingMode::SIMPLE;
+            } else {
+                return false;
+            }
+            return true;
+        });
+    EXPECT_EQ(mode.get(), ProcessingMode::ADVANCED);
+    config_manager_->clear();
+    EXPECT_EQ(mode.get(), ProcessingMode::SIMPLE);
+
+    // The processor's own handles follow updates between batches
+    config_manager_->setValue("processing.batch_size", "1");
+    std::vector<std::string> two = {"a", "b"};
+    EXPECT_FALSE(data_processor_->processBatch(two, ProcessingMode::SIMPLE).success);
+    config_manager_->setValue("processing.batch_size", "2");
+    EXPECT_TRUE(data_processor_->processBatch(two, ProcessingMode::SIMPLE).success);
+}
+
+// Test handles read together never mix values of two publications
+TEST_F(IntegrationTest, ConfigHandlesReadConsistently) {
+    auto first = (test_dir_ / "first.conf").string();
+    auto second = (test_dir_ / "second.conf").string();
+    std::ofstream(first) << "x=1\ny=1\nz=1\n";
+    std::ofstream(second) << "x=2\ny=2\nz=2\n";
+    ASSERT_TRUE(config_manager_->loadFromFile(first));
+
+    ConfigHandle<int> x(*config_manager_, "x", 0);
+    ConfigHandle<int> y(*config_manager_, "y", 0);
+    ConfigHandle<int> z(*config_manager_, "z", 0);
+    // Separate reads can straddle a publication; their versions tell
+    uint64_t x_version = 0;
+    uint64_t y_version = 0;
+    EXPECT_EQ(x.get(x_version), 1);
+    EXPECT_EQ(x_version, config_manager_->version());
+    ASSERT_TRUE(config_manager_->loadFromFile(second));
+    EXPECT_EQ(y.get(y_version), 2);
+    EXPECT_NE(x_version, y_version);
+    EXPECT_EQ(getConsistent(x, y, z), std::make_tuple(2, 2, 2));
+
+    std::atomic<bool> done{false};
+    std::thread writer([&] {
+        for (int i = 0; !done.load(); ++i) {
+            config_manager_->loadFromFile(i % 2 == 0 ? second : first);
+        }
+    });
+    // Keep reading until the writer has published a good number of times
+    const uint64_t start = config_manager_->version();
+    for (int i = 0; i < 20000 || config_manager_->version() < start + 100; ++i) {
+        auto [a, b, c] = getConsistent(x, y, z);
+        ASSERT_EQ(a, b);
+        ASSERT_EQ(b, c);
+    }
+    done.store(true);
+    writer.join();
+}
+
+// Test the mapped loader keeps the line, comment and whitespace rules
+TEST_F(IntegrationTest, MappedConfigLoaderSemantics) {
+    auto path = test_dir_ / "edge_config.txt";
+    {
+        std::ofstream file(path, std::ios::binary);
+        file << "# comment = ignored\n"
+             << "\n"
+             << "  # indented comments are not skipped = kept\n"
+             << "\tspaced.key \t=\t spaced value  \n"
+             << "no separator line\n"
+             << "dup=first\n"
+             << "empty.value =\n"
+             << "eq=a=b\n"
+             << "crlf=value\r\n"
+             << "dup=second\n"
+             << "last=no newline";
+    }
+    ASSERT_TRUE(config_manager_->loadFromFile(path.string()));
+
+    auto config = config_manager_->snapshot();
+    EXPECT_EQ(config->size(), 7);
+    EXPECT_EQ(config->getValue("# indented comments are not skipped"), "kept");
+    EXPECT_EQ(config->getValue("spaced.key"), "spaced value");
+    EXPECT_EQ(config->getValue("dup"), "second");
+    EXPECT_TRUE(config->hasKey("empty.value"));
+    EXPECT_EQ(config->getValue("empty.value", "default"), "");
+    EXPECT_EQ(config->getValue("eq"), "a=b");
+    EXPECT_EQ(config->getValue("crlf"), "value\r");
+    EXPECT_EQ(config->getValue("last"), "no newline");
+    EXPECT_FALSE(config->hasKey("app.name"));
+
+    auto keys = config_manager_->getAllKeys();
+    EXPECT_TRUE(std::is_sorted(keys.begin(), keys.end()));
+
+    // Setting a key copies the table once and keeps it sorted
+    config_manager_->setValue("aaa", "first");
+    config_manager_->setValue("dup", "third");
+    keys = config_manager_->getAllKeys();
+    EXPECT_TRUE(std::is_sorted(keys.begin(), keys.end()));
+    EXPECT_EQ(config_manager_->getValue("aaa"), "first");
+    EXPECT_EQ(config_manager_->getValue("dup"), "third");
+    EXPECT_EQ(config_manager_->snapshot()->size(), 8);
+    EXPECT_EQ(config->getValue("dup"), "second");
+}
+
+// Test both storage layouts answer lookups and prefix queries identically
+TEST_F(IntegrationTest, ConfigStorageBackends) {
+    for (auto storage : {ConfigStorage::SORTED, ConfigStorage::HASH}) {
+        auto config = createConfigManager(storage);
+        EXPECT_EQ(config->storage(), storage);
+        for (int i = 0; i < 500; ++i) {
+            config->setValue("tenant." + std::to_string(i) + ".flag", std::to_string(i % 2));
+        }
+        config->setValue("tenant", "root");
+        config->setValue("tenant.10.flag", "override");
+
+        auto current = config->snapshot();
+        EXPECT_EQ(current->storage(), storage);
+        EXPECT_EQ(current->getValue("tenant.499.flag"), "1");
+        EXPECT_EQ(current->getValue("tenant.10.flag"), "override");
+        EXPECT_EQ(current->getValue("app.name"), "cpp-template");
+        EXPECT_FALSE(current->find("tenant.500.flag").has_value());
+        EXPECT_FALSE(current->find("").has_value());
+
+        // Prefix visits are ordered, exact and cover only the namespace
+        std::vector<std::string_view> visited;
+        config->forEachWithPrefix("tenant.1", [&](std::string_view key, std::string_view) {
+            visited.push_back(key);
+        });
+        EXPECT_EQ(visited.size(), 111);  // 1, 10-19, 100-199
+        EXPECT_TRUE(std::is_sorted(visited.begin(), visited.end()));
+
+        size_t count = 0;
+        current->forEachWithPrefix("", [&](std::string_view, std::string_view) { ++count; });
+        EXPECT_EQ(count, current->size());
+        current->forEachWithPrefix("zzz", [&](std::string_view, std::string_view) { ++count; });
+        EXPECT_EQ(count, current->size());
+
+        ASSERT_TRUE(config->loadFromFile(config_file_.string()));
+        EXPECT_EQ(config->snapshot()->storage(), storage);
+        EXPECT_EQ(config->getValue("test.setting"), "test_value");
+    }
+
+    // DataProcessor exposes just its own namespace
+    data_processor_->setProcessingConfig("threads", "2");
+    auto settings = data_processor_->getProcessingConfig();
+    EXPECT_EQ(settings.size(), 3);
+    EXPECT_EQ(settings["threads"], "2");
+    EXPECT_EQ(settings["mode"], "simple");
+    EXPECT_EQ(settings["batch_size"], "10");
+}
+
+// Test arena-backed processing matches the std::string API
+TEST_F(IntegrationTest, ArenaProcessingMatchesStringResults) {
+    std::vector<std::string> inputs;
+    for (int i = 0; i < 3000; ++i) {
+        inputs.push_back(i % 13 == 0 ? "" : " \tArena Item " + std::to_string(i) + "\n");
+    }
+    inputs.push_back(" \t ");
+    config_manager_->setValue("processing.batch_size", "100000");
+    config_manager_->setValue("processing.chunk_size", "128");
+
+    ProcessingContext context(256);
+    for (const char* threads : {"1", "3"}) {
+        config_manager_->setValue("processing.threads", threads);
+        for (auto mode :
+             {ProcessingMode::SIMPLE, ProcessingMode::ADVANCED, ProcessingMode::BATCH}) {
+            auto expected = data_processor_->processBatch(inputs, mode);
+            auto view = data_processor_->processBatch(inputs, mode, context);
+            ASSERT_TRUE(view.success);
+            EXPECT_EQ(view.processed_items, expected.processed_items);
+            EXPECT_EQ(view.result, expected.result);
+
+            auto item = data_processor_->processItem(inputs[1], mode, context);
+            EXPECT_TRUE(item.success);
+            EXPECT_EQ(item.result, data_processor_->processItem(inputs[1], mode).result);
+            context.reset();
+        }
+    }
+
+    // After a reset the first block covers the previous peak
+    EXPECT_GE(context.capacity(), 3000u * 20u);
+    EXPECT_EQ(context.bytesUsed(), 0);
+
+    auto empty = data_processor_->processItem(std::string_view(), ProcessingMode::SIMPLE, context);
+    EXPECT_FALSE(empty.success);
+    EXPECT_EQ(empty.error_message, "Input cannot be empty");
+
+    config_manager_->setValue("processing.batch_size", "2");
+    auto too_big = data_processor_->processBatch(inputs, ProcessingMode::BATCH, context);
+    EXPECT_FALSE(too_big.success);
+    EXPECT_EQ(too_big.error_message, "Batch size exceeds configured limit of 2");
+
+    std::vector<std::string> only_empty = {"", ""};
+    auto nothing = data_processor_->processBatch(only_empty, ProcessingMode::BATCH, context);
+    EXPECT_TRUE(nothing.success);
+    EXPECT_EQ(nothing.processed_items, 0);
+    EXPECT_TRUE(nothing.result.empty());
+}
+
+// Test columnar batches produce the per-item results row for row
+TEST_F(IntegrationTest, ColumnarBatchMatchesItemResults) {
+    std::vector<std::string> inputs;
+    for (int i = 0; i < 3000; ++i) {
+        inputs.push_back(i % 13 == 0 ? "" : " \tColumn Item " + std::to_string(i) + "\n");
+    }
+    const utils::string::StringBatch batch(inputs);
+    config_manager_->setValue("processing.batch_size", "100000");
+    config_manager_->setValue("processing.chunk_size", "128");
+
+    utils::string::StringBatch outputs;
+    for (const char* threads : {"1", "3"}) {
+        config_manager_->setValue("processing.threads", threads);
+        for (auto mode :
+             {ProcessingMode::SIMPLE, ProcessingMode::ADVANCED, ProcessingMode::BATCH}) {
+            auto result = data_processor_->processBatch(batch, mode, outputs);
+            ASSERT_TRUE(result.success);
+            EXPECT_EQ(result.processed_items,
+                      data_processor_->processBatch(inputs, mode).processed_items);
+            ASSERT_EQ(outputs.size(), inputs.size());
+            for (size_t i = 0; i < inputs.size(); ++i) {
+                std::string expected =
+                    inputs[i].empty() ? "" : data_processor_->processItem(inputs[i], mode).result;
+                ASSERT_EQ(outputs[i], expected) << "row " << i;
+            }
+        }
+    }
+
+    // Processing a batch into itself works on a copy of the input
+    utils::string::StringBatch in_place(inputs);
+    ASSERT_TRUE(data_processor_->processBatch(in_place, ProcessingMode::SIMPLE, in_place).success);
+    EXPECT_EQ(in_place[1], data_processor_->processItem(inputs[1], ProcessingMode::SIMPLE).result);
+
+    config_manager_->setValue("processing.batch_size", "2");
+    auto too_big = data_processor_->processBatch(batch, ProcessingMode::BATCH, outputs);
+    EXPECT_FALSE(too_big.success);
+    EXPECT_EQ(too_big.error_message, "Batch size exceeds configured limit of 2");
+}
+
+// Test records of a buffer are processed in windows, in order, skipping empty ones
+TEST_F(IntegrationTest, ProcessRecordsKeepsOrder) {
+    std::string input;
+    std::vector<std::string> expected;
+    for (int i = 0; i < 2500; ++i) {
+        std::string record = i % 11 == 0 ? "" : "Record " + std::to_string(i);
+        input += record + "\n";
+        if (!record.empty()) {
+            expected.push_back(
+                data_processor_->processItem(record, ProcessingMode::ADVANCED).result);
+        }
+    }
+    input += "unterminated";
+    expected.push_back(
+        data_processor_->processItem("unterminated", ProcessingMode::ADVANCED).result);
+    config_manager_->setValue("processing.stream_buffer", "300");
+
+    for (const char* threads : {"1", "3"}) {
+        config_manager_->setValue("processing.threads", threads);
+        std::vector<std::string> outputs;
+        size_t windows = 0;
+        auto result = data_processor_->processRecords(
+            input, '\n',
+            [&](const utils::string::StringBatch& processed) {
+                ++windows;
+                EXPECT_LE(processed.size(), 300u);
+                outputs.insert(outputs.end(), processed.begin(), processed.end());
+            },
+            ProcessingMode::ADVANCED);
+        ASSERT_TRUE(result.success);
+        EXPECT_EQ(result.processed_items, expected.size());
+        EXPECT_EQ(windows, (expected.size() + 299) / 300);
+        EXPECT_EQ(outputs, expected);
+    }
+
+    auto empty = data_processor_->processRecords(
+        "\n\n", '\n', [](const utils::string::StringBatch&) { FAIL(); });
+    EXPECT_TRUE(empty.success);
+    EXPECT_EQ(empty.processed_items, 0u);
+}
+
+// Test file-to-file processing writes one line per non-empty input line
+TEST_F(IntegrationTest, ProcessFileWritesResultsInOrder) {
+    auto input_path = (test_dir_ / "records.txt").string();
+    auto output_path = (test_dir_ / "records.out").string();
+    std::string expected;
+    {
+        std::ofstream input(input_path, std::ios::binary);
+        for (int i = 0; i < 5000; ++i) {
+            std::string record = i % 7 == 0 ? "" : "Line " + std::to_string(i);
+            input << record << "\n";
+            if (!record.empty()) {
+                expected += data_processor_->processItem(record, ProcessingMode::BATCH).result;
+                expected += "\n";
+            }
+        }
+    }
+    config_manager_->setValue("processing.threads", "2");
+    config_manager_->setValue("processing.stream_buffer", "512");
+
+    FileProcessOptions options;
+    options.output_buffer = 4096;
+    auto result = processFile(*data_processor_, input_path, output_path, options);
+    ASSERT_TRUE(result.success) << result.error_message;
+    EXPECT_EQ(result.processed_items, 5000u - 715u);
+
+    std::ifstream output(output_path, std::ios::binary);
+    std::string written((std::istreambuf_iterator<char>(output)), std::istreambuf_iterator<char>());
+    EXPECT_EQ(written, expected);
+
+    auto missing = processFile(*data_processor_, (test_dir_ / "missing.txt").string(), output_path);
+    EXPECT_FALSE(missing.success);
+    EXPECT_THAT(missing.error_message, ::testing::HasSubstr("Cannot open input file"));
+
+    ProcessingMode mode = ProcessingMode::SIMPLE;
+    EXPECT_TRUE(parseProcessingMode("Advanced", mode));
+    EXPECT_EQ(mode, ProcessingMode::ADVANCED);
+    EXPECT_FALSE(parseProcessingMode("fast", mode));
+}
+
+// Test processing a file onto itself replaces it with the results instead of truncating it
+TEST_F(IntegrationTest, ProcessFileInPlaceReplacesInput) {
+    auto path = (test_dir_ / "in_place.txt").string();
+    std::string original;
+    std::string expected;
+    for (int i = 0; i < 2000; ++i) {
+        std::string record = "Record " + std::to_string(i);
+        original += record + "\n";
+        expected += data_processor_->processItem(record, ProcessingMode::SIMPLE).result + "\n";
+    }
+    std::ofstream(path, std::ios::binary) << original;
+
+    FileProcessOptions options;
+    options.mode = ProcessingMode::SIMPLE;
+    options.output_buffer = 256;
+    auto result = processFile(*data_processor_, path, path, options);
+    ASSERT_TRUE(result.success) << result.error_message;
+    EXPECT_EQ(result.processed_items, 2000u);
+
+    std::ifstream output(path, std::ios::binary);
+    std::string written((std::istreambuf_iterator<char>(output)), std::istreambuf_iterator<char>());
+    EXPECT_EQ(written, expected);
+    EXPECT_FALSE(std::filesystem::exists(path + ".tmp"));
+}
+
+// Test the ingest pipeline delivers every item from concurrent producers
+TEST_F(IntegrationTest, IngestPipelineProcessesConcurrentProducers) {
+    constexpr int kProducers = 4;
+    constexpr int kPerProducer = 2000;
+
+    std::mutex results_mutex;
+    std::set<std::string> results;
+    IngestOptions options;
+    options.queue_capacity = 64;
+    options.workers = 3;
+    {
+        IngestPipeline pipeline(
+            *data_processor_,
+            [&](ProcessingResult&& result) {
+                std::lock_guard<std::mutex> lock(results_mutex);
+                EXPECT_TRUE(result.success);
+                results.insert(std::move(result.result));
+            },
+            options);
+        EXPECT_EQ(pipeline.workerCount(), 3);
+
+        std::vector<std::thread> producers;
+        for (int p = 0; p < kProducers; ++p) {
+            producers.emplace_back([&pipeline, p] {
+                for (int i = 0; i < kPerProducer; ++i) {
+                    EXPECT_TRUE(pipeline.push("item " + std::to_string(p * kPerProducer + i)));
+                }
+            });
+        }
+        for (auto& producer : producers) {
+            producer.join();
+        }
+        pipeline.close();
+
+        EXPECT_TRUE(pipeline.isClosed());
+        EXPECT_EQ(pipeline.accepted(), kProducers * kPerProducer);
+        EXPECT_EQ(pipeline.completed(), kProducers * kPerProducer);
+        EXPECT_EQ(pipeline.pending(), 0);
+        EXPECT_FALSE(pipeline.push("late"));
+    }
+
+    ASSERT_EQ(results.size(), static_cast<size_t>(kProducers * kPerProducer));
+    EXPECT_EQ(results.count("[SIMPLE] ITEM 0"), 1);
+    EXPECT_EQ(results.count("[SIMPLE] ITEM 7999"), 1);
+    EXPECT_EQ(data_processor_->getStatisticsSnapshot().successful_operations,
+              static_cast<uint64_t>(kProducers * kPerProducer));
+}
+
+// Test tryPush reports a full queue without consuming the item
+TEST_F(IntegrationTest, IngestPipelineBackpressure) {
+    std::atomic<bool> release{false};
+    std::atomic<int> delivered{0};
+    IngestOptions options;
+    options.queue_capacity = 2;
+    options.workers = 1;
+    options.mode = ProcessingMode::BATCH;
+
+    IngestPipeline pipeline(
+        *data_processor_,
+        [&](ProcessingResult&& result) {
+            while (!release.load()) {
+                std::this_thread::yield();
+            }
+            EXPECT_EQ(result.result.rfind("[BATCH] ", 0), 0u);
+            delivered.fetch_add(1);
+        },
+        options);
+
+    // One item is held by the blocked worker, then the queue fills up
+    int queued = 0;
+    std::string item = "payload";
+    while (pipeline.tryPush(std::string(item))) {
+        ++queued;
+        ASSERT_LE(queued, 3);
+    }
+    EXPECT_GE(queued, 2);
+    EXPECT_GE(pipeline.rejected(), 1);
+
+    std::string kept = "kept";
+    EXPECT_FALSE(pipeline.tryPush(std::move(kept)));
+    EXPECT_EQ(kept, "kept");
+
+    release.store(true);
+    pipeline.close();
+    EXPECT_EQ(delivered.load(), queued);
+    EXPECT_FALSE(pipeline.tryPush(std::move(kept)));
+}
+
+// Test the result cache serves repeats and is invalidated by relevant settings
+TEST_F(IntegrationTest, ResultCacheServesRepeatedInputs) {
+    data_processor_->resetStatistics();
+    EXPECT_EQ(data_processor_->getStatisticsSnapshot().cache.capacity_bytes, 0);
+
+    auto uncached = data_processor_->processItem("hot item", ProcessingMode::ADVANCED);
+    EXPECT_EQ(data_processor_->getStatisticsSnapshot().cache.misses, 0);
+
+    data_processor_->setProcessingConfig("cache_bytes", "1048576");
+    for (int i = 0; i < 10; ++i) {
+        auto result = data_processor_->processItem("hot item", ProcessingMode::ADVANCED);
+        EXPECT_EQ(result.result, uncached.result);
+    }
+    EXPECT_NE(data_processor_->processItem("hot item", ProcessingMode::SIMPLE).result,
+              uncached.result);
+
+    auto stats = data_processor_->getStatisticsSnapshot();
+    EXPECT_EQ(stats.cache.hits, 9);
+    EXPECT_EQ(stats.cache.misses, 2);
+    EXPECT_EQ(stats.cache.entries, 2);
+    EXPECT_EQ(stats.successful_operations, 12);
+    EXPECT_THAT(data_processor_->getStatistics(), ::testing::HasSubstr("Cache: hits=9 misses=2"));
+
+    // Tuning settings keep the cache, other processing settings invalidate it
+    data_processor_->setProcessingConfig("threads", "2");
+    data_processor_->processItem("hot item", ProcessingMode::ADVANCED);
+    EXPECT_EQ(data_processor_->getStatisticsSnapshot().cache.hits, 10);
+
+    data_processor_->setProcessingConfig("label", "v2");
+    EXPECT_EQ(data_processor_->getStatisticsSnapshot().cache.entries, 0);
+    data_processor_->processItem("hot item", ProcessingMode::ADVANCED);
+    EXPECT_EQ(data_processor_->getStatisticsSnapshot().cache.misses, 3);
+
+    // Batches go through the same cache
+    config_manager_->setValue("processing.batch_size", "100");
+    std::vector<std::string> batch = {"hot item", "a", "a"};
+    auto result = data_processor_->processBatch(batch, ProcessingMode::ADVANCED);
+    EXPECT_TRUE(result.success);
+    EXPECT_EQ(data_processor_->getStatisticsSnapshot().cache.hits, 12);
+
+    data_processor_->setProcessingConfig("cache_bytes", "0");
+    EXPECT_EQ(data_processor_->getStatisticsSnapshot().cache.entries, 0);
+}
@@ -0,0 +1,64 @@
+#include "core/mapped_file.h"
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <utility>
+#include "helpers/scoped_test_dir.h"
+
+using namespace cpp_template::core;
+
+class MappedFileTest : public ::testing::Test {
+  protected:
+    std::string writeFile(const std::string& name, const std::string& contents) {
+        auto path = dir_ / name;
+        std::ofstream(path, std::ios::binary) << contents;
+        return path.string();
+    }
+
+    ScopedTestDir dir_{"mapped_file_test"};
+};
+
+// Test mapping exposes the exact file bytes
+TEST_F(MappedFileTest, MapsFileContents) {
+    std::string contents = "key=value\n";
+    contents.push_back('\0');
+    contents += "tail";
+    MappedFile file;
+    ASSERT_TRUE(file.open(writeFile("data.txt", contents)));
+    EXPECT_TRUE(file.isOpen());
+    EXPECT_EQ(file.size(), contents.size());
+    EXPECT_EQ(file.view(), contents);
+
+    file.close();
+    EXPECT_FALSE(file.isOpen());
+    EXPECT_TRUE(file.view().empty());
+}
+
+// Test empty, missing and non-regular files
+TEST_F(MappedFileTest, EdgeCases) {
+    MappedFile file;
+    ASSERT_TRUE(file.open(writeFile("empty.txt", "")));
+    EXPECT_TRUE(file.isOpen());
+    EXPECT_EQ(file.size(), 0);
+
+    EXPECT_FALSE(file.open((dir_ / "missing.txt").string()));
+    EXPECT_FALSE(file.isOpen());
+    EXPECT_FALSE(file.open(dir_.path().string()));
+}
+
+// Test ownership transfers on move
+TEST_F(MappedFileTest, MoveTransfersMapping) {
+    MappedFile first;
+    ASSERT_TRUE(first.open(writeFile("move.txt", "mapped")));
+
+    MappedFile second(std::move(first));
+    EXPECT_FALSE(first.isOpen());
+    EXPECT_EQ(second.view(), "mapped");
+
+    MappedFile third;
+    third = std::move(second);
+    EXPECT_FALSE(second.isOpen());
+    EXPECT_EQ(third.view(), "mapped");
+}
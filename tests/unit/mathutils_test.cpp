@@ -0,0 +1,155 @@
+#include <mathutils/mathutils.h>
+#include <mathutils/streaming.h>
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#if defined(MATHUTILS_ENABLE_PARALLEL)
+    #include <execution>
+#endif
+
+namespace {
+
+std::vector<double> makeSamples(size_t count, unsigned seed = 7) {
+    std::mt19937 generator(seed);
+    std::lognormal_distribution<double> latency(10.0, 1.0);
+    std::vector<double> samples(count);
+    for (double& sample : samples) {
+        sample = latency(generator);
+    }
+    return samples;
+}
+
+// Textbook two-pass reference
+double referenceStddev(const std::vector<double>& values) {
+    double mean = 0.0;
+    for (double value : values) {
+        mean += value;
+    }
+    mean /= static_cast<double>(values.size());
+    double sum = 0.0;
+    for (double value : values) {
+        sum += (value - mean) * (value - mean);
+    }
+    return std::sqrt(sum / static_cast<double>(values.size() - 1));
+}
+
+}  // namespace
+
+// Test the lane reductions match the reference for every tail length
+TEST(MathUtilsTest, ReductionsMatchReference) {
+    EXPECT_EQ(mathutils::mean(std::vector<double>{}), 0.0);
+    EXPECT_EQ(mathutils::standard_deviation(std::vector<double>{3.0}), 0.0);
+    EXPECT_DOUBLE_EQ(mathutils::mean(std::vector<double>{1, 2, 3, 4, 5}), 3.0);
+    EXPECT_EQ(mathutils::sum(std::vector<int>{1, 2, 3, 4, 5, 6, 7, 8, 9}.data(), 9), 45);
+
+    for (size_t count : {2u, 7u, 8u, 9u, 17u, 1000u, 100003u}) {
+        std::vector<double> samples = makeSamples(count);
+        double expected = referenceStddev(samples);
+        EXPECT_NEAR(mathutils::standard_deviation(samples), expected, expected * 1e-12) << count;
+        EXPECT_NEAR(mathutils::variance(samples.data(), samples.size()), expected * expected,
+                    expected * expected * 1e-12);
+    }
+
+#if defined(MATHUTILS_ENABLE_PARALLEL)
+    std::vector<double> samples = makeSamples(100000);
+    EXPECT_NEAR(mathutils::mean(std::execution::par_unseq, samples.data(), samples.size()),
+                mathutils::mean(samples), 1e-6);
+    EXPECT_NEAR(
+        mathutils::standard_deviation(std::execution::par_unseq, samples.data(), samples.size()),
+        mathutils::standard_deviation(samples), 1e-6);
+#endif
+}
+
+// Test single values, ranges and merged per-thread accumulators agree with the batch result
+TEST(MathUtilsTest, RunningStatsMergeMatchesBatch) {
+    std::vector<double> samples = makeSamples(10000);
+
+    mathutils::running_stats<double> one_by_one;
+    for (double sample : samples) {
+        one_by_one.add(sample);
+    }
+
+    mathutils::running_stats<double> merged;
+    for (size_t begin = 0; begin < samples.size(); begin += 1234) {
+        mathutils::running_stats<double> part;
+        part.add(samples.data() + begin, std::min<size_t>(1234, samples.size() - begin));
+        merged.merge(part);
+    }
+
+    double mean = mathutils::mean(samples);
+    double stddev = mathutils::standard_deviation(samples);
+    for (const auto* stats : {&one_by_one, &merged}) {
+        EXPECT_EQ(stats->count(), samples.size());
+        EXPECT_NEAR(stats->mean(), mean, mean * 1e-12);
+        EXPECT_NEAR(stats->standard_deviation(), stddev, stddev * 1e-9);
+        EXPECT_EQ(stats->min(), *std::min_element(samples.begin(), samples.end()));
+        EXPECT_EQ(stats->max(), *std::max_element(samples.begin(), samples.end()));
+    }
+
+    mathutils::running_stats<double> empty;
+    merged.merge(empty);
+    EXPECT_EQ(merged.count(), samples.size());
+    merged.reset();
+    EXPECT_EQ(merged.count(), 0u);
+    EXPECT_EQ(merged.variance(), 0.0);
+    EXPECT_EQ(merged.max(), 0.0);
+}
+
+// Test quantiles stay within the relative accuracy, also after merging
+TEST(MathUtilsTest, QuantileSketchWithinAccuracy) {
+    EXPECT_THROW(mathutils::quantile_sketch(0.0), std::invalid_argument);
+    EXPECT_THROW(mathutils::quantile_sketch(1.0), std::invalid_argument);
+
+    std::vector<double> samples = makeSamples(50000);
+    samples.push_back(0.0);
+    samples.push_back(-250.0);
+
+    mathutils::quantile_sketch whole(0.01);
+    mathutils::quantile_sketch first(0.01);
+    mathutils::quantile_sketch second(0.01);
+    for (size_t i = 0; i < samples.size(); ++i) {
+        whole.add(samples[i]);
+        (i % 2 == 0 ? first : second).add(samples[i]);
+    }
+    first.merge(second);
+
+    std::vector<double> sorted = samples;
+    std::sort(sorted.begin(), sorted.end());
+    for (double q : {0.0, 0.001, 0.25, 0.5, 0.9, 0.99, 0.999, 1.0}) {
+        auto rank = static_cast<size_t>(q * static_cast<double>(sorted.size() - 1));
+        double expected = sorted[rank];
+        for (const auto* sketch : {&whole, &first}) {
+            EXPECT_NEAR(sketch->quantile(q), expected, std::abs(expected) * 0.01 + 1e-12)
+                << "q " << q;
+        }
+    }
+    EXPECT_EQ(first.count(), samples.size());
+    EXPECT_EQ(first.min(), -250.0);
+    EXPECT_EQ(first.max(), sorted.back());
+
+    mathutils::quantile_sketch coarse(0.05);
+    EXPECT_THROW(coarse.merge(whole), std::invalid_argument);
+    EXPECT_EQ(coarse.quantile(0.5), 0.0);
+}
+
+// Test NaN and infinities are skipped instead of being bucketed
+TEST(MathUtilsTest, QuantileSketchIgnoresNonFinite) {
+    mathutils::quantile_sketch sketch(0.01);
+    sketch.add(std::numeric_limits<double>::infinity());
+    sketch.add(-std::numeric_limits<double>::infinity());
+    sketch.add(std::numeric_limits<double>::quiet_NaN(), 3);
+    EXPECT_EQ(sketch.count(), 0u);
+
+    sketch.add(2.0);
+    sketch.add(std::numeric_limits<double>::max());
+    sketch.add(std::numeric_limits<double>::infinity());
+    EXPECT_EQ(sketch.count(), 2u);
+    EXPECT_EQ(sketch.min(), 2.0);
+    EXPECT_EQ(sketch.max(), std::numeric_limits<double>::max());
+    EXPECT_NEAR(sketch.quantile(0.0), 2.0, 2.0 * 0.01);
+}
@@ -0,0 +1,165 @@
+#include "core/memory_tracking.h"
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <string>
+#include <thread>
+#include <vector>
+#include "core/utils.h"
+#include "modules/data_processor.h"
+
+using namespace cpp_template::core;
+using memory::Subsystem;
+
+class MemoryTrackingTest : public ::testing::Test {
+  protected:
+    void SetUp() override {
+        memory::setCountingEnabled(true);
+        memory::resetStatistics();
+    }
+
+    void TearDown() override { memory::setCountingEnabled(true); }
+};
+
+// Test the hooks are linked into this test binary
+TEST_F(MemoryTrackingTest, HooksAreActive) {
+    EXPECT_TRUE(memory::trackingActive());
+    EXPECT_TRUE(memory::countingEnabled());
+}
+
+// Test new and delete are counted with their sizes
+TEST_F(MemoryTrackingTest, CountsAllocationsAndBytes) {
+    // Called directly: new-expressions whose result is unused may be elided
+    void* block = ::operator new[](1000);
+    memory::AllocationStatistics during = memory::statistics(Subsystem::OTHER);
+    ::operator delete[](block);
+    memory::AllocationStatistics after = memory::statistics(Subsystem::OTHER);
+
+    EXPECT_EQ(during.allocations, 1u);
+    EXPECT_EQ(during.bytes_allocated, 1000u);
+    EXPECT_EQ(after.deallocations, 1u);
+    EXPECT_EQ(after.bytes_freed, 1000u);
+    EXPECT_EQ(after.current_bytes + 1000u, during.current_bytes);
+}
+
+// Test scopes charge allocations to their subsystem, the outermost scope winning
+TEST_F(MemoryTrackingTest, ScopesAttributeAllocations) {
+    std::unique_ptr<int> config_block;
+    std::unique_ptr<int> nested_block;
+    {
+        memory::AllocationScope scope(Subsystem::CONFIG);
+        config_block = std::make_unique<int>(1);
+        {
+            memory::AllocationScope inner(Subsystem::STRING_UTILS);
+            nested_block = std::make_unique<int>(2);
+        }
+    }
+    auto other_block = std::make_unique<int>(3);
+
+    EXPECT_EQ(memory::statistics(Subsystem::CONFIG).allocations, 2u);
+    EXPECT_EQ(memory::statistics(Subsystem::STRING_UTILS).allocations, 0u);
+    EXPECT_EQ(memory::statistics(Subsystem::OTHER).allocations, 1u);
+    EXPECT_EQ(memory::totalStatistics().allocations, 3u);
+}
+
+// Test a block is charged back to the subsystem that allocated it
+TEST_F(MemoryTrackingTest, FreesChargeAllocatingSubsystem) {
+    std::vector<int>* block = nullptr;
+    {
+        memory::AllocationScope scope(Subsystem::DATA_PROCESSOR);
+        block = new std::vector<int>(256);
+    }
+    uint64_t live = memory::statistics(Subsystem::DATA_PROCESSOR).current_bytes;
+    {
+        memory::AllocationScope scope(Subsystem::CORE);
+        delete block;
+    }
+
+    memory::AllocationStatistics stats = memory::statistics(Subsystem::DATA_PROCESSOR);
+    EXPECT_EQ(stats.deallocations, 2u);
+    EXPECT_EQ(stats.bytes_freed, stats.bytes_allocated);
+    EXPECT_EQ(stats.current_bytes + stats.bytes_allocated, live);
+    EXPECT_EQ(memory::statistics(Subsystem::CORE).deallocations, 0u);
+}
+
+// Test peaks keep the high-water mark and restart from the live bytes on reset
+TEST_F(MemoryTrackingTest, TracksPeakBytes) {
+    uint64_t base = memory::totalStatistics().current_bytes;
+    {
+        std::vector<char> big(1 << 20);
+        std::vector<char> small(1 << 10);
+    }
+    memory::AllocationStatistics total = memory::totalStatistics();
+    EXPECT_GE(total.peak_bytes, base + (1 << 20) + (1 << 10));
+    EXPECT_EQ(total.current_bytes, base);
+
+    auto held = std::make_unique<char[]>(4096);
+    memory::resetStatistics();
+    total = memory::totalStatistics();
+    EXPECT_EQ(total.allocations, 0u);
+    EXPECT_EQ(total.peak_bytes, total.current_bytes);
+    EXPECT_GE(total.current_bytes, base + 4096);
+}
+
+// Test over-aligned allocations are aligned and counted
+TEST_F(MemoryTrackingTest, AlignedAllocations) {
+    struct alignas(256) Aligned {
+        char data[300];
+    };
+    auto block = std::make_unique<Aligned>();
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(block.get()) % 256, 0u);
+    EXPECT_EQ(memory::statistics(Subsystem::OTHER).bytes_allocated, sizeof(Aligned));
+
+    void* raw = ::operator new(64, std::align_val_t{128}, std::nothrow);
+    ASSERT_NE(raw, nullptr);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(raw) % 128, 0u);
+    ::operator delete(raw, std::align_val_t{128});
+}
+
+// Test blocks allocated while counting is paused are never charged
+TEST_F(MemoryTrackingTest, PausedCountingSkipsBlocks) {
+    memory::setCountingEnabled(false);
+    auto* block = new std::string(1000, 'x');
+    memory::setCountingEnabled(true);
+    delete block;
+
+    memory::AllocationStatistics total = memory::totalStatistics();
+    EXPECT_EQ(total.allocations, 0u);
+    EXPECT_EQ(total.deallocations, 0u);
+}
+
+// Test every thread has its own scope
+TEST_F(MemoryTrackingTest, ScopesArePerThread) {
+    memory::AllocationScope scope(Subsystem::CONFIG);
+    uint64_t config_before = 0;
+    uint64_t config_after = 0;
+    std::thread worker([&] {
+        config_before = memory::statistics(Subsystem::CONFIG).allocations;
+        auto block = std::make_unique<int>(1);
+        config_after = memory::statistics(Subsystem::CONFIG).allocations;
+    });
+    worker.join();
+
+    EXPECT_EQ(config_after, config_before);
+}
+
+// Test library scopes and the DataProcessor report follow the build option
+TEST_F(MemoryTrackingTest, DataProcessorReportsMemory) {
+    auto processor = cpp_template::modules::DataProcessor(
+        std::make_shared<cpp_template::modules::ConfigManager>());
+    memory::resetStatistics();
+    processor.processItem(std::string(100, 'a'), cpp_template::modules::ProcessingMode::ADVANCED);
+    utils::string::toUpper(std::string(100, 'b'));
+
+#if defined(CORE_ENABLE_MEMORY_TRACKING)
+    EXPECT_GT(memory::statistics(Subsystem::DATA_PROCESSOR).allocations, 0u);
+    EXPECT_GT(memory::statistics(Subsystem::STRING_UTILS).allocations, 0u);
+    EXPECT_THAT(processor.getStatistics(), ::testing::HasSubstr("Memory DATA_PROCESSOR: "));
+#else
+    EXPECT_EQ(memory::statistics(Subsystem::DATA_PROCESSOR).allocations, 0u);
+#endif
+    EXPECT_THAT(processor.getStatistics(), ::testing::HasSubstr("allocations="));
+    EXPECT_EQ(processor.getStatisticsSnapshot().memory.size(), memory::kSubsystemCount);
+}
@@ -0,0 +1,114 @@
+#include "core/mpmc_queue.h"
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace cpp_template::core;
+
+// Test capacity rounding
+TEST(MpmcQueueTest, RoundsCapacityToPowerOfTwo) {
+    EXPECT_EQ(MpmcQueue<int>(0).capacity(), 2);
+    EXPECT_EQ(MpmcQueue<int>(5).capacity(), 8);
+    EXPECT_EQ(MpmcQueue<int>(64).capacity(), 64);
+}
+
+// Test FIFO order and full/empty reporting on one thread
+TEST(MpmcQueueTest, SingleThreadFifoAndBounds) {
+    MpmcQueue<int> queue(4);
+    int value = 0;
+    EXPECT_FALSE(queue.tryPop(value));
+
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_TRUE(queue.tryPush(i));
+    }
+    EXPECT_FALSE(queue.tryPush(99));
+    EXPECT_EQ(queue.sizeApprox(), 4);
+
+    for (int i = 0; i < 4; ++i) {
+        ASSERT_TRUE(queue.tryPop(value));
+        EXPECT_EQ(value, i);
+    }
+    EXPECT_FALSE(queue.tryPop(value));
+
+    // Wrap around the ring several times
+    for (int i = 0; i < 100; ++i) {
+        ASSERT_TRUE(queue.tryPush(i));
+        ASSERT_TRUE(queue.tryPop(value));
+        EXPECT_EQ(value, i);
+    }
+}
+
+// Test a failed push leaves the argument intact and move-only types work
+TEST(MpmcQueueTest, FailedPushKeepsValue) {
+    MpmcQueue<std::unique_ptr<int>> queue(2);
+    EXPECT_TRUE(queue.tryPush(std::make_unique<int>(1)));
+    EXPECT_TRUE(queue.tryEmplace(new int(2)));
+
+    auto extra = std::make_unique<int>(3);
+    EXPECT_FALSE(queue.tryPush(std::move(extra)));
+    ASSERT_NE(extra, nullptr);
+    EXPECT_EQ(*extra, 3);
+
+    std::unique_ptr<int> value;
+    ASSERT_TRUE(queue.tryPop(value));
+    EXPECT_EQ(*value, 1);
+}
+
+// Test the destructor releases elements still queued
+TEST(MpmcQueueTest, DestroysRemainingElements) {
+    auto tracked = std::make_shared<int>(0);
+    {
+        MpmcQueue<std::shared_ptr<int>> queue(8);
+        queue.tryPush(tracked);
+        queue.tryPush(tracked);
+        EXPECT_EQ(tracked.use_count(), 3);
+    }
+    EXPECT_EQ(tracked.use_count(), 1);
+}
+
+// Test every item is delivered exactly once under contention
+TEST(MpmcQueueTest, ConcurrentProducersAndConsumers) {
+    constexpr int kProducers = 4;
+    constexpr int kConsumers = 4;
+    constexpr int kPerProducer = 20000;
+
+    MpmcQueue<int> queue(64);
+    std::vector<std::atomic<int>> seen(kProducers * kPerProducer);
+    std::atomic<int> consumed{0};
+
+    std::vector<std::thread> threads;
+    for (int p = 0; p < kProducers; ++p) {
+        threads.emplace_back([&, p] {
+            for (int i = 0; i < kPerProducer; ++i) {
+                while (!queue.tryPush(p * kPerProducer + i)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (int c = 0; c < kConsumers; ++c) {
+        threads.emplace_back([&] {
+            int value = 0;
+            while (consumed.load() < kProducers * kPerProducer) {
+                if (queue.tryPop(value)) {
+                    seen[value].fetch_add(1);
+                    consumed.fetch_add(1);
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    for (const auto& count : seen) {
+        EXPECT_EQ(count.load(), 1);
+    }
+    EXPECT_EQ(queue.sizeApprox(), 0);
+}
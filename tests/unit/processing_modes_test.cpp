@@ -0,0 +1,96 @@
+#include "modules/processing_modes.h"
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include <vector>
+#include "modules/config_manager.h"
+#include "modules/data_processor.h"
+
+using namespace cpp_template::modules;
+
+namespace {
+
+// A custom mode registered without touching DataProcessor
+struct RedactMode {
+    static constexpr std::string_view kName = "REDACT";
+    static constexpr auto kMask = [](char c) { return (c >= '0' && c <= '9') ? '*' : c; };
+    static constexpr transform::Pipeline<transform::Prefix, transform::Trim,
+                                         transform::MapChars<decltype(kMask)>>
+        kPipeline{transform::Prefix{"[REDACT] "}, transform::Trim{},
+                  transform::MapChars<decltype(kMask)>{kMask}};
+};
+
+using ExtendedModes = BuiltinModes::With<RedactMode>;
+
+}  // namespace
+
+// Test the registry is built from the policy list at compile time
+TEST(ProcessingModesTest, RegistryLookup) {
+    static_assert(BuiltinModes::kCount == 3);
+    static_assert(ExtendedModes::kCount == 4);
+    static_assert(ExtendedModes::find("REDACT").value() == 3);
+    static_assert(ExtendedModes::indexOf<RedactMode>() == 3);
+    static_assert(BuiltinModes::indexOf<RedactMode>() == BuiltinModes::kCount);
+
+    EXPECT_EQ(BuiltinModes::kNames[static_cast<size_t>(ProcessingMode::ADVANCED)], "ADVANCED");
+    EXPECT_FALSE(ExtendedModes::find("MISSING").has_value());
+
+    auto name = ExtendedModes::dispatch(*ExtendedModes::find("BATCH"),
+                                        [](auto processor) { return processor.name(); });
+    EXPECT_EQ(name, "BATCH");
+}
+
+// Test specialized processors produce the runtime processor's output
+TEST(ProcessingModesTest, SpecializedProcessorsMatchRuntimeModes) {
+    auto config = std::shared_ptr<ConfigManager>(createConfigManager().release());
+    auto processor = createDataProcessor(config);
+
+    for (size_t index = 0; index < BuiltinModes::kCount; ++index) {
+        auto mode = static_cast<ProcessingMode>(index);
+        for (const char* input : {"Hello World", "  Mixed 42  "}) {
+            std::string expected = processor->processItem(input, mode).result;
+            BuiltinModes::dispatch(index, [&](auto specialized) {
+                EXPECT_EQ(specialized.process(input), expected);
+                EXPECT_EQ(specialized.size(input), expected.size());
+            });
+        }
+    }
+
+    ProcessingContext context;
+    std::vector<std::string> inputs = {"a", "", "B c", "  d  "};
+    size_t count = 0;
+    auto joined = BasicDataProcessor<BatchMode>::processJoined(inputs, ", ", context, count);
+    EXPECT_EQ(count, 3);
+    EXPECT_EQ(joined, processor->processBatch(inputs, ProcessingMode::BATCH).result);
+}
+
+// Test a custom mode runs through the configurable front end
+TEST(ProcessingModesTest, CustomModeThroughFrontEnd) {
+    auto config = std::shared_ptr<ConfigManager>(createConfigManager().release());
+    auto processor = createDataProcessor(config);
+    config->setValue("processing.batch_size", "10000");
+    config->setValue("processing.chunk_size", "16");
+
+    std::vector<std::string> inputs;
+    for (int i = 0; i < 200; ++i) {
+        inputs.push_back(" card " + std::to_string(1000 + i) + " ");
+    }
+
+    ProcessingContext context;
+    for (const char* threads : {"1", "4"}) {
+        config->setValue("processing.threads", threads);
+        auto result = processor->processBatchWith<RedactMode>(inputs, context);
+        ASSERT_TRUE(result.success);
+        EXPECT_EQ(result.processed_items, 200);
+        EXPECT_EQ(result.result.substr(0, 30), "[REDACT] card ****, [REDACT] c");
+    }
+
+    // Custom modes count as operations but have no latency histogram
+    auto stats = processor->getStatisticsSnapshot();
+    EXPECT_EQ(stats.total_processed, 400);
+    EXPECT_EQ(stats.latency[static_cast<size_t>(ProcessingMode::SIMPLE)].count, 0);
+
+    config->setValue("processing.batch_size", "5");
+    EXPECT_FALSE(processor->processBatchWith<RedactMode>(inputs, context).success);
+}
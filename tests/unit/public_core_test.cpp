@@ -0,0 +1,48 @@
+#include "cpp-template/core.h"
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+using cpp_template::Core;
+
+// Test the public facade forwards to the implementation
+TEST(PublicCoreTest, ForwardsToImplementation) {
+    Core core("Facade");
+    EXPECT_EQ(core.getName(), "Facade");
+    EXPECT_FALSE(core.isInitialized());
+    EXPECT_THROW(core.process("x"), std::runtime_error);
+
+    EXPECT_TRUE(core.initialize());
+    EXPECT_EQ(core.process("hello"), "[Facade] HELLO");
+    EXPECT_THROW(Core(""), std::invalid_argument);
+}
+
+// Test copies and moves of the inline-stored implementation are independent
+TEST(PublicCoreTest, CopyAndMoveKeepState) {
+    Core original("Original");
+    original.initialize();
+
+    Core copy(original);
+    copy.setName("Copy");
+    EXPECT_EQ(original.getName(), "Original");
+    EXPECT_TRUE(copy.isInitialized());
+    EXPECT_EQ(copy.process("a"), "[Copy] A");
+
+    Core assigned("Assigned");
+    assigned = copy;
+    EXPECT_EQ(assigned.getName(), "Copy");
+    EXPECT_TRUE(assigned.isInitialized());
+
+    Core moved(std::move(copy));
+    EXPECT_EQ(moved.getName(), "Copy");
+    EXPECT_TRUE(moved.isInitialized());
+
+    Core target("Target");
+    target = std::move(moved);
+    EXPECT_EQ(target.process("b"), "[Copy] B");
+
+    auto created = cpp_template::createCore("Factory");
+    EXPECT_EQ(created->getName(), "Factory");
+}
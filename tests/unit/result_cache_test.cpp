@@ -0,0 +1,117 @@
+#include "modules/result_cache.h"
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace cpp_template::modules;
+
+namespace {
+
+// Budget that fits exactly `entries` entries of the given sizes in each shard
+size_t budgetFor(size_t entries, size_t key_size, size_t value_size) {
+    return (key_size + value_size + ResultCache::kEntryOverhead) * entries *
+           ResultCache::kShardCount;
+}
+
+}  // namespace
+
+// Test a disabled cache stores and counts nothing
+TEST(ResultCacheTest, DisabledByDefault) {
+    ResultCache cache;
+    EXPECT_FALSE(cache.enabled());
+    cache.insert("key", 1, "value");
+    EXPECT_FALSE(cache.find("key", 1).has_value());
+
+    auto stats = cache.statistics();
+    EXPECT_EQ(stats.entries, 0);
+    EXPECT_EQ(stats.hits + stats.misses, 0);
+}
+
+// Test hits, misses and that variants are separate keys
+TEST(ResultCacheTest, FindAndVariants) {
+    ResultCache cache(1 << 20);
+    cache.insert("input", 1, "one");
+    cache.insert("input", 2, "two");
+
+    EXPECT_EQ(cache.find("input", 1), "one");
+    EXPECT_EQ(cache.find("input", 2), "two");
+    EXPECT_FALSE(cache.find("input", 3).has_value());
+    EXPECT_FALSE(cache.find("other", 1).has_value());
+
+    cache.insert("input", 1, "uno");
+    EXPECT_EQ(cache.find("input", 1), "uno");
+
+    auto stats = cache.statistics();
+    EXPECT_EQ(stats.hits, 3);
+    EXPECT_EQ(stats.misses, 2);
+    EXPECT_EQ(stats.entries, 2);
+    EXPECT_DOUBLE_EQ(stats.hitRate(), 60.0);
+
+    cache.resetStatistics();
+    cache.clear();
+    stats = cache.statistics();
+    EXPECT_EQ(stats.hits + stats.misses, 0);
+    EXPECT_EQ(stats.entries, 0);
+    EXPECT_EQ(stats.bytes, 0);
+}
+
+// Test the byte budget is respected and recently used entries survive
+TEST(ResultCacheTest, EvictsLeastRecentlyUsed) {
+    ResultCache cache(budgetFor(4, 4, 4));
+    std::vector<std::string> keys;
+    for (int i = 0; i < 2000; ++i) {
+        keys.push_back(std::to_string(1000 + i));
+    }
+
+    cache.insert(keys[0], 0, "hot!");
+    for (size_t i = 1; i < keys.size(); ++i) {
+        ASSERT_EQ(cache.find(keys[0], 0), "hot!");
+        cache.insert(keys[i], 0, "cold");
+    }
+
+    auto stats = cache.statistics();
+    EXPECT_LE(stats.bytes, stats.capacity_bytes);
+    EXPECT_LE(stats.entries, 4 * ResultCache::kShardCount);
+    EXPECT_GT(stats.evictions, 0);
+
+    // Oversized entries are refused rather than flushing a shard
+    cache.insert("big", 0, std::string(stats.capacity_bytes, 'x'));
+    EXPECT_FALSE(cache.find("big", 0).has_value());
+
+    cache.setCapacity(0);
+    EXPECT_FALSE(cache.enabled());
+    EXPECT_EQ(cache.statistics().entries, 0);
+}
+
+// Test concurrent readers and writers keep the cache consistent
+TEST(ResultCacheTest, ConcurrentAccess) {
+    ResultCache cache(budgetFor(8, 8, 16));
+    std::atomic<int> wrong{0};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&cache, &wrong, t] {
+            for (int i = 0; i < 5000; ++i) {
+                std::string key = "key" + std::to_string((i * 7 + t) % 300);
+                std::string value = "value:" + key;
+                if (auto cached = cache.find(key, 0)) {
+                    if (*cached != value) {
+                        wrong.fetch_add(1);
+                    }
+                } else {
+                    cache.insert(key, 0, value);
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(wrong.load(), 0);
+    auto stats = cache.statistics();
+    EXPECT_EQ(stats.hits + stats.misses, 4u * 5000u);
+    EXPECT_LE(stats.bytes, stats.capacity_bytes);
+}
@@ -0,0 +1,71 @@
+#include "core/statistics.h"
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+using namespace cpp_template::core;
+
+// Test ShardedCounter sums across threads
+TEST(ShardedCounterTest, ConcurrentAddsAreNotLost) {
+    ShardedCounter counter;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 8; ++t) {
+        threads.emplace_back([&counter] {
+            for (int i = 0; i < 10000; ++i) {
+                counter.add();
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(counter.value(), 80000);
+
+    counter.add(5);
+    EXPECT_EQ(counter.value(), 80005);
+
+    counter.reset();
+    EXPECT_EQ(counter.value(), 0);
+}
+
+// Test LatencyHistogram bucket mapping
+TEST(LatencyHistogramTest, BucketsAreMonotonicWithBoundedError) {
+    EXPECT_EQ(LatencyHistogram::bucketIndex(0), 0);
+    EXPECT_EQ(LatencyHistogram::bucketIndex(7), 7);
+    EXPECT_EQ(LatencyHistogram::bucketValue(7), 7);
+
+    size_t previous = 0;
+    for (uint64_t value = 1; value < (uint64_t{1} << 40); value += value / 3 + 1) {
+        size_t index = LatencyHistogram::bucketIndex(value);
+        EXPECT_GE(index, previous);
+        previous = index;
+
+        double representative = static_cast<double>(LatencyHistogram::bucketValue(index));
+        EXPECT_NEAR(representative, static_cast<double>(value), static_cast<double>(value) * 0.07)
+            << "value " << value;
+    }
+
+    EXPECT_EQ(LatencyHistogram::bucketIndex(~uint64_t{0}), LatencyHistogram::kBucketCount - 1);
+}
+
+// Test LatencyHistogram percentiles
+TEST(LatencyHistogramTest, SnapshotReportsPercentiles) {
+    LatencyHistogram histogram;
+    EXPECT_EQ(histogram.snapshot().count, 0);
+
+    for (uint64_t i = 1; i <= 1000; ++i) {
+        histogram.record(i * 100);
+    }
+
+    LatencySnapshot snapshot = histogram.snapshot();
+    EXPECT_EQ(snapshot.count, 1000);
+    EXPECT_EQ(snapshot.max_ns, 100000);
+    EXPECT_NEAR(static_cast<double>(snapshot.p50_ns), 50000.0, 50000.0 * 0.07);
+    EXPECT_NEAR(static_cast<double>(snapshot.p99_ns), 99000.0, 99000.0 * 0.07);
+    EXPECT_DOUBLE_EQ(snapshot.mean_ns, 50050.0);
+
+    histogram.reset();
+    EXPECT_EQ(histogram.snapshot().count, 0);
+}
@@ -0,0 +1,132 @@
+#include "core/string_batch.h"
+#include <gtest/gtest.h>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include "core/utils.h"
+
+using namespace cpp_template::core::utils::string;
+
+namespace {
+
+std::vector<std::string> rows(const StringBatch& batch) {
+    return batch.toVector();
+}
+
+}  // namespace
+
+// Test the Arrow-style layout: one buffer, size() + 1 offsets starting at 0
+TEST(StringBatchTest, LaysOutRowsContiguously) {
+    StringBatch batch{"alpha", "", "beta"};
+
+    ASSERT_EQ(batch.size(), 3u);
+    EXPECT_EQ(batch.bytes(), 9u);
+    EXPECT_EQ(std::string_view(batch.data(), batch.bytes()), "alphabeta");
+    const StringBatch::offset_type expected[] = {0, 5, 5, 9};
+    for (size_t i = 0; i < 4; ++i) {
+        EXPECT_EQ(batch.offsets()[i], expected[i]);
+    }
+    EXPECT_EQ(batch[0], "alpha");
+    EXPECT_EQ(batch[1], "");
+    EXPECT_EQ(batch[2], "beta");
+}
+
+// Test empty, cleared and moved-from batches all behave as empty
+TEST(StringBatchTest, EmptyBatches) {
+    StringBatch empty;
+    EXPECT_TRUE(empty.empty());
+    EXPECT_EQ(empty.offsets()[0], 0);
+    EXPECT_EQ(empty.begin(), empty.end());
+
+    StringBatch batch{"x", "y"};
+    StringBatch moved = std::move(batch);
+    EXPECT_EQ(moved.size(), 2u);
+    batch.append("z");
+    EXPECT_EQ(rows(batch), std::vector<std::string>{"z"});
+
+    moved.clear();
+    EXPECT_TRUE(moved.empty());
+    EXPECT_EQ(moved, StringBatch());
+}
+
+// Test building from vectors, appending and iterating
+TEST(StringBatchTest, BuildsFromRangesAndAppends) {
+    std::vector<std::string> strings = {"one", "two", "three"};
+    StringBatch batch(strings);
+    batch.append("four");
+    char* row = batch.appendRow(4);
+    std::string_view("five").copy(row, 4);
+
+    std::vector<std::string> expected = {"one", "two", "three", "four", "five"};
+    EXPECT_EQ(rows(batch), expected);
+    EXPECT_EQ(StringBatch(std::vector<std::string_view>(batch.begin(), batch.end())), batch);
+}
+
+// Test layout() sizes rows for writing in place
+TEST(StringBatchTest, LayoutReservesRows) {
+    StringBatch batch{"old"};
+    char* data = batch.layout(3, [](size_t i) { return i + 1; });
+    ASSERT_EQ(batch.size(), 3u);
+    EXPECT_EQ(batch.bytes(), 6u);
+    std::string_view("abbccc").copy(data, 6);
+    EXPECT_EQ(rows(batch), (std::vector<std::string>{"a", "bb", "ccc"}));
+}
+
+// Test adopting foreign buffers checks the offsets
+TEST(StringBatchTest, FromBuffersValidatesOffsets) {
+    StringBatch batch = StringBatch::fromBuffers({'a', 'b', 'c'}, {0, 1, 3});
+    EXPECT_EQ(rows(batch), (std::vector<std::string>{"a", "bc"}));
+
+    EXPECT_THROW(StringBatch::fromBuffers({'a'}, {}), std::invalid_argument);
+    EXPECT_THROW(StringBatch::fromBuffers({'a'}, {0, 2}), std::invalid_argument);
+    EXPECT_THROW(StringBatch::fromBuffers({'a', 'b'}, {0, 2, 1, 2}), std::invalid_argument);
+}
+
+// Test batch case mapping matches the per-string kernels
+TEST(StringBatchTest, CaseMapping) {
+    std::vector<std::string> strings = {"Hello", "", "World 42", std::string(100, 'q')};
+    StringBatch batch(strings);
+
+    StringBatch upper;
+    toUpper(batch, upper);
+    StringBatch lower;
+    toLower(upper, lower);
+    toUpperInPlace(batch);
+
+    ASSERT_EQ(upper.size(), strings.size());
+    for (size_t i = 0; i < strings.size(); ++i) {
+        EXPECT_EQ(upper[i], toUpper(strings[i]));
+        EXPECT_EQ(lower[i], toLower(strings[i]));
+    }
+    EXPECT_EQ(batch, upper);
+    toLowerInPlace(batch);
+    EXPECT_EQ(batch, lower);
+}
+
+// Test trimming keeps one row per input, including in place
+TEST(StringBatchTest, Trim) {
+    StringBatch batch{"  padded\t", "   ", "bare", "\nline\n"};
+    StringBatch trimmed;
+    trim(batch, trimmed);
+    EXPECT_EQ(rows(trimmed), (std::vector<std::string>{"padded", "", "bare", "line"}));
+
+    trim(batch, batch, " ");
+    EXPECT_EQ(rows(batch), (std::vector<std::string>{"padded\t", "", "bare", "\nline\n"}));
+}
+
+// Test splitting into and joining from a batch
+TEST(StringBatchTest, SplitAndJoin) {
+    StringBatch parts;
+    EXPECT_EQ(split("a,,b,c", ',', parts), 4u);
+    EXPECT_EQ(rows(parts), split("a,,b,c", ','));
+
+    std::string joined = "> ";
+    join(parts, "; ", joined);
+    EXPECT_EQ(joined, "> a; ; b; c");
+
+    std::string unchanged = "x";
+    join(StringBatch(), ", ", unchanged);
+    EXPECT_EQ(unchanged, "x");
+}
@@ -0,0 +1,65 @@
+#include "core/string_builder.h"
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <list>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace cpp_template::core::utils::string;
+
+// Test appending text, characters and numbers
+TEST(StringBuilderTest, AppendsHeterogeneousValues) {
+    StringBuilder builder;
+    builder.append("id=").append(42).append(' ').append(std::string_view("ratio="));
+    builder.append(0.5).append(',').append(int64_t{-7}).append(',').append(1u);
+    EXPECT_EQ(builder.view(), "id=42 ratio=0.5,-7,1");
+
+    builder.clear();
+    EXPECT_TRUE(builder.empty());
+    builder << "x" << 3 << std::string("y") << 'z' << 2.25;
+    EXPECT_EQ(builder.str(), "x3yz2.25");
+}
+
+// Test appendAll reserves once for every part
+TEST(StringBuilderTest, AppendAllReservesUpFront) {
+    StringBuilder builder;
+    std::string name = "processor";
+    builder.appendAll("name=", name, ' ', "count=", 12345678901234LL);
+    EXPECT_EQ(builder.view(), "name=processor count=12345678901234");
+    EXPECT_GE(builder.capacity(), builder.size());
+}
+
+// Test joined ranges match join() and need no growth after the up-front reserve
+TEST(StringBuilderTest, AppendJoined) {
+    std::vector<std::string> words = {"alpha", "beta", "gamma"};
+    StringBuilder builder;
+    builder.appendJoined(words, ", ");
+    EXPECT_EQ(builder.view(), "alpha, beta, gamma");
+
+    size_t capacity = builder.capacity();
+    builder.clear();
+    builder.appendJoined(words, ", ");
+    EXPECT_EQ(builder.capacity(), capacity);
+
+    builder.clear();
+    builder.appendJoined(std::vector<std::string>{}, ", ");
+    EXPECT_TRUE(builder.empty());
+
+    std::list<int> numbers = {1, 22, 333};
+    builder.append('[').appendJoined(numbers.begin(), numbers.end(), "|").append(']');
+    EXPECT_EQ(builder.view(), "[1|22|333]");
+}
+
+// Test release hands over the buffer and leaves the builder reusable
+TEST(StringBuilderTest, ReleaseMovesContents) {
+    StringBuilder builder(64);
+    EXPECT_GE(builder.capacity(), 64);
+    builder.append("payload");
+    std::string released = std::move(builder).release();
+    EXPECT_EQ(released, "payload");
+    EXPECT_TRUE(builder.empty());  // release() leaves the builder empty
+    builder.append("next");
+    EXPECT_EQ(builder.view(), "next");
+}
@@ -0,0 +1,112 @@
+#include "core/thread_pool.h"
+#include "core/cpu_topology.h"
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <atomic>
+#include <future>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+using namespace cpp_template::core;
+
+class ThreadPoolTest : public ::testing::Test {
+  protected:
+    ThreadPool pool_{4};
+};
+
+// Test pool construction
+TEST_F(ThreadPoolTest, ReportsRequestedSize) {
+    EXPECT_EQ(pool_.size(), 4);
+
+    ThreadPool automatic(0);
+    EXPECT_GE(automatic.size(), 1);
+    EXPECT_EQ(automatic.size(), effectiveConcurrency());
+}
+
+// Test workers know their index and node, and outside threads are told apart
+TEST_F(ThreadPoolTest, ReportsWorkerIndexAndNode) {
+    EXPECT_EQ(pool_.currentWorker(), pool_.size());
+
+    std::vector<std::atomic<int>> seen(pool_.size() + 1);
+    pool_.parallelFor(256, 1, [&](size_t, size_t) {
+        size_t worker = pool_.currentWorker();
+        ASSERT_LE(worker, pool_.size());
+        seen[worker]++;
+    });
+    EXPECT_GT(std::accumulate(seen.begin(), seen.end(), 0), 0);
+
+    ThreadPool placed(6, WorkerPlacement::PER_NODE);
+    const size_t nodes = cpuTopology().nodes.size();
+    for (size_t i = 0; i < placed.size(); ++i) {
+        EXPECT_LT(placed.workerNode(i), nodes);
+        if (i > 0) {
+            EXPECT_GE(placed.workerNode(i), placed.workerNode(i - 1));
+        }
+    }
+    std::atomic<size_t> total{0};
+    placed.parallelFor(1000, 10, [&](size_t begin, size_t end) { total += end - begin; });
+    EXPECT_EQ(total.load(), 1000);
+}
+
+// Test submit runs every task
+TEST_F(ThreadPoolTest, SubmitRunsAllTasks) {
+    std::atomic<int> counter{0};
+    std::vector<std::future<void>> done;
+
+    for (int i = 0; i < 1000; ++i) {
+        auto promise = std::make_shared<std::promise<void>>();
+        done.push_back(promise->get_future());
+        pool_.submit([&counter, promise] {
+            counter.fetch_add(1);
+            promise->set_value();
+        });
+    }
+    for (auto& future : done) {
+        future.wait();
+    }
+
+    EXPECT_EQ(counter.load(), 1000);
+}
+
+// Test parallelFor covers every index exactly once
+TEST_F(ThreadPoolTest, ParallelForVisitsEachIndexOnce) {
+    for (size_t count : {0, 1, 7, 1000, 12345}) {
+        for (size_t chunk : {0, 1, 64, 5000}) {
+            std::vector<int> hits(count, 0);
+            pool_.parallelFor(count, chunk, [&](size_t begin, size_t end) {
+                for (size_t i = begin; i < end; ++i) {
+                    hits[i]++;
+                }
+            });
+            EXPECT_EQ(std::count(hits.begin(), hits.end(), 1), static_cast<long>(count))
+                << "count " << count << " chunk " << chunk;
+        }
+    }
+}
+
+// Test exceptions propagate to the caller
+TEST_F(ThreadPoolTest, ParallelForRethrowsExceptions) {
+    EXPECT_THROW(pool_.parallelFor(100, 10,
+                                   [](size_t begin, size_t) {
+                                       if (begin == 50) {
+                                           throw std::runtime_error("chunk failed");
+                                       }
+                                   }),
+                 std::runtime_error);
+
+    // The pool stays usable afterwards
+    std::atomic<size_t> total{0};
+    pool_.parallelFor(100, 10, [&](size_t begin, size_t end) { total += end - begin; });
+    EXPECT_EQ(total.load(), 100);
+}
+
+// Test nested parallelFor from inside a pool task does not deadlock
+TEST_F(ThreadPoolTest, NestedParallelFor) {
+    std::atomic<size_t> total{0};
+    pool_.parallelFor(8, 1, [&](size_t, size_t) {
+        pool_.parallelFor(100, 10, [&](size_t begin, size_t end) { total += end - begin; });
+    });
+    EXPECT_EQ(total.load(), 800);
+}
@@ -0,0 +1,133 @@
+#include "core/tokenizer.h"
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "core/utils.h"
+
+using namespace cpp_template::core::utils::string;
+
+namespace {
+
+std::vector<std::string> collect(std::string_view input, Delimiter delimiter) {
+    std::vector<std::string> parts;
+    for (std::string_view token : tokens(input, delimiter)) {
+        parts.emplace_back(token);
+    }
+    return parts;
+}
+
+// The semantics split() had when it was a std::getline loop
+std::vector<std::string> getlineSplit(const std::string& input, char delimiter) {
+    std::vector<std::string> parts;
+    std::istringstream stream(input);
+    std::string part;
+    while (std::getline(stream, part, delimiter)) {
+        parts.push_back(part);
+    }
+    return parts;
+}
+
+}  // namespace
+
+// Test single-character tokens follow split() semantics
+TEST(TokenizerTest, CharacterDelimiter) {
+    EXPECT_THAT(collect("a,b,c", ','), ::testing::ElementsAre("a", "b", "c"));
+    EXPECT_THAT(collect(",a,,b,", ','), ::testing::ElementsAre("", "a", "", "b"));
+    EXPECT_THAT(collect("abc", ','), ::testing::ElementsAre("abc"));
+    EXPECT_TRUE(collect("", ',').empty());
+    EXPECT_THAT(collect(",", ','), ::testing::ElementsAre(""));
+}
+
+// Test multi-character sequences, including partial matches at the end
+TEST(TokenizerTest, SequenceDelimiter) {
+    auto delimiter = Delimiter::sequence("::");
+    EXPECT_THAT(collect("a::b::c", delimiter), ::testing::ElementsAre("a", "b", "c"));
+    EXPECT_THAT(collect("a:b::c:", delimiter), ::testing::ElementsAre("a:b", "c:"));
+    EXPECT_THAT(collect("::a::", delimiter), ::testing::ElementsAre("", "a"));
+    EXPECT_THAT(collect("a:::b", delimiter), ::testing::ElementsAre("a", ":b"));
+    EXPECT_THAT(collect("x->y", Delimiter::sequence("-")), ::testing::ElementsAre("x", ">y"));
+    EXPECT_THROW(Delimiter::sequence(""), std::invalid_argument);
+}
+
+// Test sets of delimiter characters
+TEST(TokenizerTest, AnyOfDelimiter) {
+    auto whitespace = Delimiter::anyOf(" \t\n");
+    EXPECT_THAT(collect("a b\tc\n\nd", whitespace), ::testing::ElementsAre("a", "b", "c", "", "d"));
+    EXPECT_THAT(collect("a;b", Delimiter::anyOf(";")), ::testing::ElementsAre("a", "b"));
+    EXPECT_THAT(collect("a b", Delimiter::anyOf("")), ::testing::ElementsAre("a b"));
+    // Past the inline scan too, where NUL bytes must not match an empty set
+    const std::string zeros(100, '\0');
+    EXPECT_THAT(collect(zeros, Delimiter::anyOf("")), ::testing::ElementsAre(zeros));
+    std::vector<std::string> empties(100, "");
+    empties.push_back("a");
+    EXPECT_EQ(collect(zeros + "a", Delimiter::anyOf(std::string_view("\0b", 2))), empties);
+    EXPECT_THAT(collect("a\xff"
+                        "b",
+                        Delimiter::anyOf("\xff\x01")),
+                ::testing::ElementsAre("a", "b"));
+}
+
+// Test set delimiters past the inline scan, on the vector and the bitmap paths
+TEST(TokenizerTest, AnyOfDelimiterLongTokens) {
+    std::mt19937 generator(11);
+    const std::string sets[] = {";\xff", " \t\n\r,;:|", " \t\n\r,;:|!"};
+    for (const std::string& set : sets) {
+        auto delimiter = Delimiter::anyOf(set);
+        for (int round = 0; round < 200; ++round) {
+            // Tokens of 0 to 100 bytes, so hits land at every offset of a vector block
+            std::string input;
+            std::vector<std::string> expected;
+            const int count = static_cast<int>(generator() % 6);
+            for (int t = 0; t < count; ++t) {
+                std::string token(generator() % 101, 'x');
+                for (char& c : token) {
+                    c = static_cast<char>('a' + generator() % 26);
+                }
+                expected.push_back(token);
+                input += token;
+                input += set[generator() % set.size()];
+            }
+            EXPECT_EQ(collect(input, delimiter), expected) << "set size " << set.size();
+        }
+    }
+}
+
+// Test bulk offsets describe the same tokens and reuse the vector
+TEST(TokenizerTest, OffsetsMatchTokens) {
+    std::string_view line = "GET /index.html 200 1532";
+    TokenOffsets offsets;
+    EXPECT_EQ(tokenOffsets(line, ' ', offsets), 4);
+    ASSERT_EQ(offsets.size(), 4);
+    EXPECT_EQ(offsets[1], std::make_pair(uint32_t{4}, uint32_t{11}));
+
+    size_t i = 0;
+    for (std::string_view token : tokens(line, ' ')) {
+        EXPECT_EQ(line.substr(offsets[i].first, offsets[i].second), token);
+        ++i;
+    }
+
+    EXPECT_EQ(tokenOffsets("", ' ', offsets), 0);
+    EXPECT_TRUE(offsets.empty());
+    EXPECT_EQ(tokenOffsets("a||b", Delimiter::sequence("||"), offsets), 2);
+}
+
+// Test tokens() and split() agree with a std::getline reference on random inputs
+TEST(TokenizerTest, MatchesSplit) {
+    std::mt19937 generator(7);
+    std::uniform_int_distribution<int> pick(0, 3);
+    const char alphabet[] = {'a', 'b', ',', ','};
+    for (int round = 0; round < 500; ++round) {
+        std::string input;
+        for (int i = generator() % 12; i > 0; --i) {
+            input += alphabet[pick(generator)];
+        }
+        std::vector<std::string> expected = getlineSplit(input, ',');
+        EXPECT_EQ(collect(input, ','), expected) << "input: " << input;
+        EXPECT_EQ(split(input, ','), expected) << "input: " << input;
+    }
+}
@@ -0,0 +1,183 @@
+#include "core/trace.h"
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstring>
+#include <set>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace cpp_template::core;
+
+class TraceTest : public ::testing::Test {
+  protected:
+    void SetUp() override {
+        trace::setEnabled(true);
+        trace::clear();
+    }
+
+    void TearDown() override {
+        trace::setEnabled(true);
+        trace::clear();
+    }
+
+    static std::vector<trace::TraceEvent> eventsNamed(const char* name) {
+        std::vector<trace::TraceEvent> events = trace::collect();
+        events.erase(std::remove_if(events.begin(), events.end(),
+                                    [name](const trace::TraceEvent& event) {
+                                        return std::strcmp(event.name, name) != 0;
+                                    }),
+                     events.end());
+        return events;
+    }
+};
+
+// Test nested zones are recorded with the inner one inside the outer one
+TEST_F(TraceTest, RecordsNestedZones) {
+    {
+        trace::Zone outer("outer");
+        trace::Zone inner("inner");
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    auto outer = eventsNamed("outer");
+    auto inner = eventsNamed("inner");
+    ASSERT_EQ(outer.size(), 1u);
+    ASSERT_EQ(inner.size(), 1u);
+    EXPECT_GE(inner[0].duration_ns, 500000u);
+    EXPECT_LE(outer[0].begin_ns, inner[0].begin_ns);
+    EXPECT_GE(outer[0].begin_ns + outer[0].duration_ns, inner[0].begin_ns + inner[0].duration_ns);
+    EXPECT_EQ(outer[0].thread, inner[0].thread);
+}
+
+// Test nothing is recorded while recording is off
+TEST_F(TraceTest, DisabledZonesAreNotRecorded) {
+    trace::setEnabled(false);
+    EXPECT_FALSE(trace::enabled());
+    { trace::Zone zone("disabled"); }
+    trace::setEnabled(true);
+    { trace::Zone zone("enabled"); }
+
+    EXPECT_TRUE(eventsNamed("disabled").empty());
+    EXPECT_EQ(eventsNamed("enabled").size(), 1u);
+}
+
+// Test clear() forgets earlier zones only
+TEST_F(TraceTest, ClearDropsEarlierZones) {
+    { trace::Zone zone("before"); }
+    trace::clear();
+    { trace::Zone zone("after"); }
+
+    EXPECT_TRUE(eventsNamed("before").empty());
+    EXPECT_EQ(eventsNamed("after").size(), 1u);
+}
+
+// Test the ring keeps only the most recent zones of a thread
+TEST_F(TraceTest, RingBufferKeepsNewestZones) {
+    for (size_t i = 0; i < trace::kEventsPerThread + 100; ++i) {
+        trace::Zone zone(i < 100 ? "old" : "new");
+    }
+
+    EXPECT_TRUE(eventsNamed("old").empty());
+    EXPECT_EQ(eventsNamed("new").size(), trace::kEventsPerThread - 1);
+}
+
+// Test every thread records into its own buffer
+TEST_F(TraceTest, ThreadsRecordSeparately) {
+    constexpr int kThreads = 4;
+    constexpr int kZonesPerThread = 1000;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreads; ++t) {
+        threads.emplace_back([] {
+            for (int i = 0; i < kZonesPerThread; ++i) {
+                trace::Zone zone("worker");
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    auto events = eventsNamed("worker");
+    EXPECT_EQ(events.size(), static_cast<size_t>(kThreads * kZonesPerThread));
+    std::set<uint32_t> ids;
+    for (const auto& event : events) {
+        ids.insert(event.thread);
+    }
+    EXPECT_EQ(ids.size(), static_cast<size_t>(kThreads));
+}
+
+// Test finished threads hand their buffers on instead of growing the registry
+TEST_F(TraceTest, ReusesBuffersOfFinishedThreads) {
+    { trace::Zone zone("main"); }
+    std::thread([] { trace::Zone zone("warmup"); }).join();
+    trace::collect();
+    const size_t buffers = trace::bufferCount();
+
+    std::set<uint32_t> ids;
+    for (int round = 0; round < 100; ++round) {
+        std::thread([] { trace::Zone zone("churn"); }).join();
+        // The finished thread's zone is readable until collected, under a new thread id
+        size_t fresh = 0;
+        for (const auto& event : eventsNamed("churn")) {
+            fresh += ids.insert(event.thread).second ? 1 : 0;
+        }
+        ASSERT_EQ(fresh, 1u);
+    }
+    EXPECT_EQ(trace::bufferCount(), buffers);
+
+    // Uncollected zones are kept for a bounded number of finished threads
+    trace::clear();
+    for (size_t round = 0; round < trace::kRetainedExitedThreads * 2; ++round) {
+        std::thread([] { trace::Zone zone("unread"); }).join();
+    }
+    EXPECT_LE(trace::bufferCount(), buffers + trace::kRetainedExitedThreads + 1);
+    EXPECT_EQ(eventsNamed("unread").size(), trace::kRetainedExitedThreads + 1);
+}
+
+// Test collecting while another thread records returns only whole zones
+TEST_F(TraceTest, CollectWhileRecording) {
+    std::atomic<bool> stop{false};
+    std::thread writer([&stop] {
+        while (!stop.load(std::memory_order_relaxed)) {
+            trace::Zone zone("concurrent");
+        }
+    });
+
+    for (int round = 0; round < 50; ++round) {
+        for (const auto& event : trace::collect()) {
+            ASSERT_NE(event.name, nullptr);
+        }
+    }
+    stop = true;
+    writer.join();
+    EXPECT_LE(eventsNamed("concurrent").size(), trace::kEventsPerThread);
+}
+
+// Test the Chrome trace output contains complete events with escaped names
+TEST_F(TraceTest, WritesChromeTraceJson) {
+    { trace::Zone zone("say \"hi\"\\"); }
+    std::ostringstream out;
+    out.precision(9);
+    trace::writeChromeTrace(out);
+
+    std::string json = out.str();
+    EXPECT_EQ(json.rfind("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[", 0), 0u);
+    EXPECT_THAT(json, ::testing::HasSubstr("\"name\":\"say \\\"hi\\\"\\\\\""));
+    EXPECT_THAT(json, ::testing::HasSubstr("\"ph\":\"X\""));
+    EXPECT_THAT(json, ::testing::HasSubstr("\"dur\":"));
+    EXPECT_EQ(json.substr(json.size() - 4), "\n]}\n");
+    EXPECT_EQ(out.precision(), 9);
+}
+
+// Test CORE_TRACE_SCOPE records only when tracing is compiled in
+TEST_F(TraceTest, ScopeMacroFollowsBuildOption) {
+    { CORE_TRACE_SCOPE("macro"); }
+#if defined(CORE_ENABLE_TRACING)
+    EXPECT_EQ(eventsNamed("macro").size(), 1u);
+#else
+    EXPECT_TRUE(eventsNamed("macro").empty());
+#endif
+}
@@ -0,0 +1,61 @@
+#include "modules/transform_pipeline.h"
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <string>
+#include "core/utils.h"
+
+using namespace cpp_template::modules::transform;
+
+// Test the built-in stages against the step-by-step string operations
+TEST(TransformPipelineTest, MatchesUnfusedOperations) {
+    const Pipeline<Prefix, Reverse, ToLower> advanced{Prefix{"[ADVANCED] "}, Reverse{}, ToLower{}};
+    const Pipeline<Prefix, ToUpper> simple{Prefix{"[SIMPLE] "}, ToUpper{}};
+
+    for (std::string input : {"", "a", "Hello World", "MiXeD 123 \xC3\xA9 Text", "  padded  "}) {
+        std::string reversed(input.rbegin(), input.rend());
+        EXPECT_EQ(advanced(input),
+                  "[ADVANCED] " + cpp_template::core::utils::string::toLower(reversed));
+        EXPECT_EQ(simple(input), "[SIMPLE] " + cpp_template::core::utils::string::toUpper(input));
+        EXPECT_EQ(simple.size(input), simple(input).size());
+    }
+}
+
+// Test trimming, suffixes and stage ordering rules
+TEST(TransformPipelineTest, SelectionAndLiterals) {
+    const Pipeline<Prefix, Trim, Suffix> framed{Prefix{"<"}, Trim{}, Suffix{">"}};
+    EXPECT_EQ(framed(" \t value \r\n"), "<value>");
+    EXPECT_EQ(framed(" \t "), "<>");
+    EXPECT_EQ(framed.size(" x "), 3);
+
+    // Literal text is not affected by character maps
+    const Pipeline<ToUpper, Prefix, Suffix> literal{ToUpper{}, Prefix{"pre:"}, Suffix{":post"}};
+    EXPECT_EQ(literal("mid"), "pre:MID:post");
+
+    // Two reversals cancel out; custom trim sets work from both ends
+    const Pipeline<Reverse, Trim, Reverse> twice{Reverse{}, Trim{"-"}, Reverse{}};
+    EXPECT_EQ(twice("--abc-"), "abc");
+
+    // Writing into a buffer returns the end of the output
+    char buffer[16] = {};
+    char* end = framed.write(" hi ", buffer);
+    EXPECT_EQ(std::string(buffer, end), "<hi>");
+}
+
+// Test user-supplied character maps run in stage order
+TEST(TransformPipelineTest, UserStages) {
+    auto mask_digits = [](char c) { return (c >= '0' && c <= '9') ? '#' : c; };
+    auto dot_to_dash = [](char c) { return c == '.' ? '-' : c; };
+    using MaskDigits = MapChars<decltype(mask_digits)>;
+    using DotToDash = MapChars<decltype(dot_to_dash)>;
+    const Pipeline<MaskDigits, DotToDash, ToUpper> masked{MaskDigits{mask_digits},
+                                                          DotToDash{dot_to_dash}, ToUpper{}};
+    EXPECT_EQ(masked("ip 10.0.0.1"), "IP ##-#-#-#");
+
+    // A stage type defined outside the library
+    struct TakeFirstThree : Stage {
+        std::string_view select(std::string_view body) const { return body.substr(0, 3); }
+    };
+    const Pipeline<TakeFirstThree, Reverse> head{TakeFirstThree{}, Reverse{}};
+    EXPECT_EQ(head("abcdef"), "cba");
+}
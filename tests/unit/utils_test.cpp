@@ -1,6 +1,13 @@
 #include "core/utils.h"
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
+#include <cctype>
+#include <random>
+#include <regex>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
 
 using namespace cpp_template::core::utils;
 
@@ -150,6 +157,98 @@ TEST_F(StringUtilsTest, SplitJoinRoundTrip) {
     EXPECT_EQ(joined, original);
 }
 
+// Test the buffer-based string_view API
+TEST_F(StringUtilsTest, ToUpperInPlace) {
+    std::string value = mixed_case_string_;
+    string::toUpperInPlace(value);
+    EXPECT_EQ(value, "HELLO WORLD");
+}
+
+TEST_F(StringUtilsTest, ToLowerInPlace) {
+    std::string value = mixed_case_string_;
+    string::toLowerInPlace(value);
+    EXPECT_EQ(value, "hello world");
+}
+
+TEST_F(StringUtilsTest, ToUpperIntoBufferReplacesContents) {
+    std::string buffer = "previous contents that are longer";
+    string::toUpper(std::string_view(simple_string_), buffer);
+    EXPECT_EQ(buffer, "HELLO");
+
+    string::toLower(std::string_view("ABC"), buffer);
+    EXPECT_EQ(buffer, "abc");
+}
+
+TEST_F(StringUtilsTest, SplitIntoViewsMatchesSplit) {
+    // std::getline semantics: no token after a trailing delimiter, none for empty input
+    const std::vector<std::pair<std::string, std::vector<std::string>>> cases = {
+        {"", {}},
+        {"a,b,c", {"a", "b", "c"}},
+        {"a,,b,", {"a", "", "b"}},
+        {",,,", {"", "", ""}},
+        {"hello", {"hello"}},
+        {",leading", {"", "leading"}},
+    };
+    std::vector<std::string_view> views;
+    for (const auto& [input, expected] : cases) {
+        EXPECT_EQ(string::split(input, ','), expected) << "input: " << input;
+        size_t count = string::split(input, ',', views);
+        ASSERT_EQ(count, expected.size()) << "input: " << input;
+        EXPECT_EQ(std::vector<std::string>(views.begin(), views.end()), expected)
+            << "input: " << input;
+    }
+}
+
+TEST_F(StringUtilsTest, SplitIntoViewsReferencesSource) {
+    std::string source = "alpha beta";
+    std::vector<std::string_view> views;
+    string::split(source, ' ', views);
+    ASSERT_EQ(views.size(), 2);
+    EXPECT_EQ(views[0].data(), source.data());
+    EXPECT_EQ(views[1].data(), source.data() + 6);
+}
+
+TEST_F(StringUtilsTest, JoinAppendsToBuffer) {
+    std::vector<std::string_view> parts = {"a", "", "b"};
+    std::string buffer = "prefix:";
+    string::join(parts, ", ", buffer);
+    EXPECT_EQ(buffer, "prefix:a, , b");
+
+    std::vector<std::string> empty_vec;
+    string::join(empty_vec, ",", buffer);
+    EXPECT_EQ(buffer, "prefix:a, , b");
+}
+
+// Long inputs exercise the vectorized ASCII kernels and their scalar fallback
+TEST_F(StringUtilsTest, CaseConversionMatchesScalarOnLongInputs) {
+    std::string input;
+    for (int i = 0; i < 300; ++i) {
+        input += static_cast<char>(i % 128);
+    }
+    input += unicode_string_;
+    input += "Mixed CASE tail after non-ASCII bytes 0123456789 ABCxyz";
+
+    std::string expected_upper = input;
+    std::string expected_lower = input;
+    for (size_t i = 0; i < input.size(); ++i) {
+        auto c = static_cast<unsigned char>(input[i]);
+        expected_upper[i] = static_cast<char>(std::toupper(c));
+        expected_lower[i] = static_cast<char>(std::tolower(c));
+    }
+
+    // Every offset/length combination hits a different head/block/tail split
+    for (size_t offset = 0; offset < 40; ++offset) {
+        for (size_t length : {0, 1, 15, 16, 17, 31, 32, 33, 64, 200}) {
+            if (offset + length > input.size()) {
+                continue;
+            }
+            std::string slice = input.substr(offset, length);
+            EXPECT_EQ(string::toUpper(slice), expected_upper.substr(offset, length));
+            EXPECT_EQ(string::toLower(slice), expected_lower.substr(offset, length));
+        }
+    }
+}
+
 // Test fixture for validation utilities
 class ValidationUtilsTest : public ::testing::Test {
   protected:
@@ -248,6 +347,112 @@ TEST_F(ValidationUtilsTest, IsAlphanumericSingleCharacter) {
     EXPECT_FALSE(validation::isAlphanumeric("@"));
 }
 
+TEST_F(ValidationUtilsTest, ClassificationOnLongInputs) {
+    std::string alnum(100, 'a');
+    for (size_t i = 0; i < alnum.size(); ++i) {
+        alnum[i] = "aZ09"[i % 4];
+    }
+    EXPECT_TRUE(validation::isAlphanumeric(alnum));
+
+    std::string spaces(100, ' ');
+    for (size_t i = 0; i < spaces.size(); ++i) {
+        spaces[i] = " \t\n\v\f\r"[i % 6];
+    }
+    EXPECT_TRUE(validation::isEmpty(spaces));
+
+    // A single offending byte anywhere must be detected, including non-ASCII
+    for (size_t pos = 0; pos < 100; pos += 7) {
+        for (char bad : {'@', '[', '`', '{', '/', ':', '\x80', '\xff'}) {
+            std::string broken = alnum;
+            broken[pos] = bad;
+            EXPECT_FALSE(validation::isAlphanumeric(broken)) << "pos " << pos;
+        }
+        for (char bad : {'a', '\x08', '\x0e', '\x80'}) {
+            std::string broken = spaces;
+            broken[pos] = bad;
+            EXPECT_FALSE(validation::isEmpty(broken)) << "pos " << pos;
+        }
+    }
+}
+
+// Test validation::isValidEmail against the reference regex
+TEST_F(ValidationUtilsTest, IsValidEmailBasicCases) {
+    EXPECT_TRUE(validation::isValidEmail("test@example.com"));
+    EXPECT_TRUE(validation::isValidEmail("first.last+tag%x_y-z@sub.domain-1.org"));
+    EXPECT_TRUE(validation::isValidEmail("a@.b.cc"));
+    EXPECT_TRUE(validation::isValidEmail("a@b..cc"));
+    EXPECT_FALSE(validation::isValidEmail(""));
+    EXPECT_FALSE(validation::isValidEmail("@example.com"));
+    EXPECT_FALSE(validation::isValidEmail("user@.com"));
+    EXPECT_FALSE(validation::isValidEmail("user@example.c"));
+    EXPECT_FALSE(validation::isValidEmail("user@example.c0m"));
+    EXPECT_FALSE(validation::isValidEmail("user@example"));
+    EXPECT_FALSE(validation::isValidEmail("user@@example.com"));
+    EXPECT_FALSE(validation::isValidEmail("us er@example.com"));
+    EXPECT_FALSE(validation::isValidEmail(std::string_view("user@example.com\0", 17)));
+}
+
+TEST_F(ValidationUtilsTest, IsValidEmailMatchesRegexOnFuzzedCorpus) {
+    const std::regex reference(R"(^[a-zA-Z0-9._%+-]+@[a-zA-Z0-9.-]+\.[a-zA-Z]{2,}$)");
+    const std::string alphabet = "aZ9._%+-@.-.@ !#\t\x80";
+    const std::vector<std::string> seeds = {"user@example.com", "a.b@c.de", "x@y.z", "x@y.zz",
+                                            "first+tag@sub.domain.org", "@a.bc", "a@b.c1"};
+
+    std::mt19937 gen(20240601);
+    std::uniform_int_distribution<size_t> pick_char(0, alphabet.size() - 1);
+    std::uniform_int_distribution<size_t> pick_len(0, 16);
+    std::uniform_int_distribution<int> coin(0, 3);
+
+    size_t accepted = 0;
+    for (int i = 0; i < 20000; ++i) {
+        std::string candidate;
+        if (coin(gen) == 0) {
+            // Completely random string over the interesting alphabet
+            size_t length = pick_len(gen);
+            for (size_t j = 0; j < length; ++j) {
+                candidate += alphabet[pick_char(gen)];
+            }
+        } else {
+            // Mutate a near-valid seed: replace, insert or delete a few characters
+            candidate = seeds[static_cast<size_t>(i) % seeds.size()];
+            int mutations = coin(gen);
+            for (int m = 0; m < mutations && !candidate.empty(); ++m) {
+                size_t pos = pick_len(gen) % candidate.size();
+                switch (coin(gen)) {
+                    case 0:
+                        candidate.erase(pos, 1);
+                        break;
+                    case 1:
+                        candidate.insert(pos, 1, alphabet[pick_char(gen)]);
+                        break;
+                    default:
+                        candidate[pos] = alphabet[pick_char(gen)];
+                        break;
+                }
+            }
+        }
+
+        bool expected = std::regex_match(candidate, reference);
+        ASSERT_EQ(validation::isValidEmail(candidate), expected) << "input: '" << candidate << "'";
+        accepted += expected ? 1 : 0;
+    }
+
+    // The corpus must exercise both outcomes to be meaningful
+    EXPECT_GT(accepted, 1000);
+    EXPECT_LT(accepted, 19000);
+}
+
+TEST_F(ValidationUtilsTest, ValidateEmailsBatch) {
+    std::vector<std::string_view> emails = {"a@b.cc", "invalid", "", "x.y@z.org"};
+    std::vector<unsigned char> results;
+    EXPECT_EQ(validation::validateEmails(emails, results), 2);
+    EXPECT_EQ(results, (std::vector<unsigned char>{1, 0, 0, 1}));
+
+    emails.clear();
+    EXPECT_EQ(validation::validateEmails(emails, results), 0);
+    EXPECT_TRUE(results.empty());
+}
+
 // Performance and stress tests
 TEST_F(StringUtilsTest, LargeStringSplit) {
     // Create a large string with many parts
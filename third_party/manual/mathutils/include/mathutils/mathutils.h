@@ -1,44 +1,199 @@
 // MathUtils - Example header-only manual dependency
 #pragma once
 
+#include <algorithm>
 #include <cmath>
+#include <cstddef>
+#include <functional>
+#include <type_traits>
 #include <vector>
 #include <numeric>
 
+#if defined(MATHUTILS_ENABLE_PARALLEL)
+#include <execution>
+#endif
+
+#if __has_include(<span>)
+#include <span>
+#endif
+
 namespace mathutils {
-    
+
+    namespace detail {
+
+        // Independent partial sums per iteration; enough to fill one AVX-512
+        // register of doubles and to let the compiler vectorize the reduction,
+        // which it may not reorder on its own for floating point
+        constexpr std::size_t kLanes = 8;
+
+        template<typename T>
+        T fold_lanes(const T (&lanes)[kLanes], T tail) {
+            // Pairwise, which also keeps the rounding error low
+            T quad[4] = {lanes[0] + lanes[4], lanes[1] + lanes[5],
+                         lanes[2] + lanes[6], lanes[3] + lanes[7]};
+            return ((quad[0] + quad[2]) + (quad[1] + quad[3])) + tail;
+        }
+
+        template<typename T>
+        T lane_sum(const T* data, std::size_t size) {
+            T lanes[kLanes] = {};
+            std::size_t i = 0;
+            for (; i + kLanes <= size; i += kLanes) {
+                for (std::size_t lane = 0; lane < kLanes; ++lane) {
+                    lanes[lane] += data[i + lane];
+                }
+            }
+            T tail = T{};
+            for (; i < size; ++i) {
+                tail += data[i];
+            }
+            return fold_lanes(lanes, tail);
+        }
+
+        template<typename T>
+        T lane_sum_sq_diff(const T* data, std::size_t size, T center) {
+            T lanes[kLanes] = {};
+            std::size_t i = 0;
+            for (; i + kLanes <= size; i += kLanes) {
+                for (std::size_t lane = 0; lane < kLanes; ++lane) {
+                    T diff = data[i + lane] - center;
+                    lanes[lane] += diff * diff;
+                }
+            }
+            T tail = T{};
+            for (; i < size; ++i) {
+                T diff = data[i] - center;
+                tail += diff * diff;
+            }
+            return fold_lanes(lanes, tail);
+        }
+
+    } // namespace detail
+
+    /**
+     * Sum a contiguous range of values, several lanes at a time
+     */
+    template<typename T>
+    T sum(const T* data, std::size_t size) {
+        return detail::lane_sum(data, size);
+    }
+
+    /**
+     * Calculate the mean of a contiguous range of values
+     */
+    template<typename T>
+    T mean(const T* data, std::size_t size) {
+        if (size == 0) {
+            return T{};
+        }
+        return detail::lane_sum(data, size) / static_cast<T>(size);
+    }
+
     /**
      * Calculate the mean of a vector of values
      */
     template<typename T>
     T mean(const std::vector<T>& values) {
-        if (values.empty()) {
+        return mean(values.data(), values.size());
+    }
+
+    /**
+     * Calculate the sample variance of a contiguous range of values
+     */
+    template<typename T>
+    T variance(const T* data, std::size_t size) {
+        if (size <= 1) {
             return T{};
         }
-        T sum = std::accumulate(values.begin(), values.end(), T{});
-        return sum / static_cast<T>(values.size());
+        T avg = mean(data, size);
+        return detail::lane_sum_sq_diff(data, size, avg) / static_cast<T>(size - 1);
     }
-    
+
+    /**
+     * Calculate the sample variance of a vector of values
+     */
+    template<typename T>
+    T variance(const std::vector<T>& values) {
+        return variance(values.data(), values.size());
+    }
+
+    /**
+     * Calculate the standard deviation of a contiguous range of values
+     */
+    template<typename T>
+    T standard_deviation(const T* data, std::size_t size) {
+        return std::sqrt(variance(data, size));
+    }
+
     /**
      * Calculate the standard deviation of a vector of values
      */
     template<typename T>
     T standard_deviation(const std::vector<T>& values) {
-        if (values.size() <= 1) {
+        return standard_deviation(values.data(), values.size());
+    }
+
+#if defined(__cpp_lib_span) && __cpp_lib_span >= 202002L
+    /**
+     * Span overloads of the reductions above (C++20)
+     */
+    template<typename T, std::size_t Extent>
+    std::remove_const_t<T> sum(std::span<T, Extent> values) {
+        return sum(values.data(), values.size());
+    }
+
+    template<typename T, std::size_t Extent>
+    std::remove_const_t<T> mean(std::span<T, Extent> values) {
+        return mean(values.data(), values.size());
+    }
+
+    template<typename T, std::size_t Extent>
+    std::remove_const_t<T> variance(std::span<T, Extent> values) {
+        return variance(values.data(), values.size());
+    }
+
+    template<typename T, std::size_t Extent>
+    std::remove_const_t<T> standard_deviation(std::span<T, Extent> values) {
+        return standard_deviation(values.data(), values.size());
+    }
+#endif
+
+#if defined(MATHUTILS_ENABLE_PARALLEL)
+    /**
+     * Mean using a standard execution policy, e.g. std::execution::par_unseq
+     *
+     * Opt-in with MATHUTILS_ENABLE_PARALLEL: with libstdc++ the parallel
+     * policies need TBB, which then has to be linked.
+     */
+    template<typename ExecutionPolicy, typename T,
+             typename = std::enable_if_t<
+                 std::is_execution_policy_v<std::decay_t<ExecutionPolicy>>>>
+    T mean(ExecutionPolicy&& policy, const T* data, std::size_t size) {
+        if (size == 0) {
             return T{};
         }
-        
-        T avg = mean(values);
-        T sum_sq_diff = T{};
-        
-        for (const auto& value : values) {
-            T diff = value - avg;
-            sum_sq_diff += diff * diff;
+        T total = std::reduce(std::forward<ExecutionPolicy>(policy), data, data + size, T{});
+        return total / static_cast<T>(size);
+    }
+
+    /**
+     * Standard deviation using a standard execution policy
+     */
+    template<typename ExecutionPolicy, typename T,
+             typename = std::enable_if_t<
+                 std::is_execution_policy_v<std::decay_t<ExecutionPolicy>>>>
+    T standard_deviation(ExecutionPolicy&& policy, const T* data, std::size_t size) {
+        if (size <= 1) {
+            return T{};
         }
-        
-        return std::sqrt(sum_sq_diff / static_cast<T>(values.size() - 1));
+        T avg = mean(policy, data, size);
+        T sum_sq_diff = std::transform_reduce(
+            std::forward<ExecutionPolicy>(policy), data, data + size, T{}, std::plus<T>(),
+            [avg](T value) { return (value - avg) * (value - avg); });
+        return std::sqrt(sum_sq_diff / static_cast<T>(size - 1));
     }
-    
+#endif
+
     /**
      * Linear interpolation between two values
      */
@@ -46,7 +201,7 @@ namespace mathutils {
     T lerp(T a, T b, T t) {
         return a + t * (b - a);
     }
-    
+
     /**
      * Clamp a value between min and max
      */
@@ -54,7 +209,7 @@ namespace mathutils {
     T clamp(T value, T min_val, T max_val) {
         return std::max(min_val, std::min(value, max_val));
     }
-    
+
     /**
      * Check if a number is approximately equal to another (for floating point comparison)
      */
@@ -62,5 +217,5 @@ namespace mathutils {
     bool approximately_equal(T a, T b, T epsilon = static_cast<T>(1e-9)) {
         return std::abs(a - b) < epsilon;
     }
-    
-} // namespace mathutils
\ No newline at end of file
+
+} // namespace mathutils
@@ -0,0 +1,301 @@
+// MathUtils - Single-pass statistics that never store their samples
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+#include "mathutils.h"
+
+namespace mathutils {
+
+    /**
+     * Online mean, variance, min and max (Welford's algorithm)
+     *
+     * Uses constant memory however many values are added. Accumulators
+     * filled on different threads can be combined with merge() (Chan et
+     * al.'s pairwise update), which gives the same result as adding every
+     * value to one accumulator, up to rounding.
+     */
+    template<typename T = double>
+    class running_stats {
+    public:
+        /**
+         * Add one value
+         */
+        void add(T value) {
+            ++count_;
+            T delta = value - mean_;
+            mean_ += delta / static_cast<T>(count_);
+            m2_ += delta * (value - mean_);
+            min_ = std::min(min_, value);
+            max_ = std::max(max_, value);
+        }
+
+        /**
+         * Add a contiguous range of values
+         *
+         * Runs the vectorized two-pass reductions over the range and merges
+         * the result, which is faster than adding the values one by one.
+         */
+        void add(const T* data, std::size_t size) {
+            if (size == 0) {
+                return;
+            }
+            running_stats block;
+            block.count_ = size;
+            block.mean_ = mathutils::mean(data, size);
+            block.m2_ = detail::lane_sum_sq_diff(data, size, block.mean_);
+            auto range = std::minmax_element(data, data + size);
+            block.min_ = *range.first;
+            block.max_ = *range.second;
+            merge(block);
+        }
+
+        /**
+         * Combine another accumulator into this one
+         */
+        void merge(const running_stats& other) {
+            if (other.count_ == 0) {
+                return;
+            }
+            if (count_ == 0) {
+                *this = other;
+                return;
+            }
+            std::size_t total = count_ + other.count_;
+            T delta = other.mean_ - mean_;
+            T weight = static_cast<T>(other.count_) / static_cast<T>(total);
+            mean_ += delta * weight;
+            m2_ += other.m2_ + delta * delta * static_cast<T>(count_) * weight;
+            count_ = total;
+            min_ = std::min(min_, other.min_);
+            max_ = std::max(max_, other.max_);
+        }
+
+        /**
+         * Discard every value
+         */
+        void reset() {
+            *this = running_stats();
+        }
+
+        std::size_t count() const { return count_; }
+
+        T mean() const { return mean_; }
+
+        /**
+         * Sample variance; 0 for fewer than two values
+         */
+        T variance() const {
+            return count_ > 1 ? m2_ / static_cast<T>(count_ - 1) : T{};
+        }
+
+        /**
+         * Population variance; 0 when empty
+         */
+        T population_variance() const {
+            return count_ > 0 ? m2_ / static_cast<T>(count_) : T{};
+        }
+
+        T standard_deviation() const { return std::sqrt(variance()); }
+
+        /**
+         * Smallest value; 0 when empty
+         */
+        T min() const { return count_ > 0 ? min_ : T{}; }
+
+        /**
+         * Largest value; 0 when empty
+         */
+        T max() const { return count_ > 0 ? max_ : T{}; }
+
+    private:
+        std::size_t count_ = 0;
+        T mean_{};
+        T m2_{};
+        T min_ = std::numeric_limits<T>::max();
+        T max_ = std::numeric_limits<T>::lowest();
+    };
+
+    /**
+     * Mergeable streaming quantile sketch with a relative error bound
+     *
+     * Values are counted in logarithmic buckets (the DDSketch scheme): every
+     * quantile is returned within relative_accuracy of the true value of
+     * that rank. Memory grows with the logarithm of the value range, not
+     * with the number of values; nanosecond latencies from 1 ns to one hour
+     * need about 1,500 buckets at 1% accuracy. Sketches with the same
+     * accuracy can be merged, e.g. one per thread.
+     */
+    class quantile_sketch {
+    public:
+        /**
+         * Create an empty sketch
+         *
+         * @throws std::invalid_argument unless 0 < relative_accuracy < 1
+         */
+        explicit quantile_sketch(double relative_accuracy = 0.01)
+            : accuracy_(relative_accuracy) {
+            if (!(relative_accuracy > 0.0 && relative_accuracy < 1.0)) {
+                throw std::invalid_argument("quantile_sketch accuracy must be in (0, 1)");
+            }
+            gamma_ = (1.0 + relative_accuracy) / (1.0 - relative_accuracy);
+            log_gamma_ = std::log(gamma_);
+        }
+
+        /**
+         * Add a value, or @p weight copies of it; NaN and infinities are ignored
+         */
+        void add(double value, std::uint64_t weight = 1) {
+            // An infinity has no logarithmic bucket (its index would not fit an int)
+            if (!std::isfinite(value) || weight == 0) {
+                return;
+            }
+            if (value >= kMinIndexable) {
+                positive_.add(index(value), weight);
+            } else if (value <= -kMinIndexable) {
+                negative_.add(index(-value), weight);
+            } else {
+                zero_count_ += weight;
+            }
+            count_ += weight;
+            min_ = std::min(min_, value);
+            max_ = std::max(max_, value);
+        }
+
+        /**
+         * Combine another sketch into this one
+         *
+         * @throws std::invalid_argument if the accuracies differ
+         */
+        void merge(const quantile_sketch& other) {
+            if (other.accuracy_ != accuracy_) {
+                throw std::invalid_argument("quantile_sketch accuracies differ");
+            }
+            positive_.merge(other.positive_);
+            negative_.merge(other.negative_);
+            zero_count_ += other.zero_count_;
+            count_ += other.count_;
+            min_ = std::min(min_, other.min_);
+            max_ = std::max(max_, other.max_);
+        }
+
+        /**
+         * Get the value at a quantile
+         *
+         * @param q The quantile in [0, 1], e.g. 0.99
+         * @return The estimate, clamped to [min(), max()]; 0 when empty
+         */
+        double quantile(double q) const {
+            if (count_ == 0) {
+                return 0.0;
+            }
+            q = clamp(q, 0.0, 1.0);
+            auto rank = static_cast<std::uint64_t>(q * static_cast<double>(count_ - 1));
+
+            // Ascending value order: large negatives, zero, then positives
+            std::uint64_t seen = 0;
+            for (std::size_t i = negative_.counts.size(); i-- > 0;) {
+                seen += negative_.counts[i];
+                if (seen > rank) {
+                    return clamp(-value(negative_.offset + static_cast<int>(i)), min_, max_);
+                }
+            }
+            seen += zero_count_;
+            if (seen > rank) {
+                return clamp(0.0, min_, max_);
+            }
+            for (std::size_t i = 0; i < positive_.counts.size(); ++i) {
+                seen += positive_.counts[i];
+                if (seen > rank) {
+                    return clamp(value(positive_.offset + static_cast<int>(i)), min_, max_);
+                }
+            }
+            return max_;
+        }
+
+        /**
+         * Discard every value
+         */
+        void reset() {
+            positive_ = store();
+            negative_ = store();
+            zero_count_ = 0;
+            count_ = 0;
+            min_ = std::numeric_limits<double>::infinity();
+            max_ = -std::numeric_limits<double>::infinity();
+        }
+
+        std::uint64_t count() const { return count_; }
+
+        double relative_accuracy() const { return accuracy_; }
+
+        /**
+         * Smallest value added; 0 when empty
+         */
+        double min() const { return count_ > 0 ? min_ : 0.0; }
+
+        /**
+         * Largest value added; 0 when empty
+         */
+        double max() const { return count_ > 0 ? max_ : 0.0; }
+
+    private:
+        // Magnitudes below this are counted as zero
+        static constexpr double kMinIndexable = 1e-300;
+
+        // Dense bucket counts for indices [offset, offset + counts.size())
+        struct store {
+            std::vector<std::uint64_t> counts;
+            int offset = 0;
+
+            void add(int bucket, std::uint64_t weight) {
+                if (counts.empty()) {
+                    offset = bucket;
+                    counts.push_back(weight);
+                    return;
+                }
+                if (bucket < offset) {
+                    counts.insert(counts.begin(), static_cast<std::size_t>(offset - bucket), 0);
+                    offset = bucket;
+                } else if (bucket >= offset + static_cast<int>(counts.size())) {
+                    counts.resize(static_cast<std::size_t>(bucket - offset) + 1, 0);
+                }
+                counts[static_cast<std::size_t>(bucket - offset)] += weight;
+            }
+
+            void merge(const store& other) {
+                for (std::size_t i = 0; i < other.counts.size(); ++i) {
+                    if (other.counts[i] != 0) {
+                        add(other.offset + static_cast<int>(i), other.counts[i]);
+                    }
+                }
+            }
+        };
+
+        // Bucket i holds magnitudes in (gamma^(i-1), gamma^i]
+        int index(double magnitude) const {
+            return static_cast<int>(std::ceil(std::log(magnitude) / log_gamma_));
+        }
+
+        // The point of bucket i whose relative distance to both bounds is the accuracy
+        double value(int bucket) const {
+            return 2.0 * std::pow(gamma_, bucket) / (gamma_ + 1.0);
+        }
+
+        double accuracy_;
+        double gamma_ = 0.0;
+        double log_gamma_ = 0.0;
+        store positive_;
+        store negative_;
+        std::uint64_t zero_count_ = 0;
+        std::uint64_t count_ = 0;
+        double min_ = std::numeric_limits<double>::infinity();
+        double max_ = -std::numeric_limits<double>::infinity();
+    };
+
+} // namespace mathutils